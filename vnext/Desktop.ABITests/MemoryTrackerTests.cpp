@@ -5,6 +5,9 @@
 #include <winrt/base.h>
 #include <winrt/facebook.react.h>
 
+#include <chrono>
+#include <thread>
+
 #include "SimpleMessageQueue.h"
 
 using namespace winrt::facebook::react;
@@ -78,6 +81,50 @@ TEST_CLASS(MemoryTrackerTests) {
     TestCheck(tracker.RemoveThresholdHandler(registrationToken));
   }
 
+  TEST_METHOD(ThresholdHandler_CalledAgainAfterIntervalWithoutGrowth) {
+    IMessageQueue callbackMessageQueue = ::winrt::make<SimpleMessageQueue>();
+    MemoryTracker tracker{callbackMessageQueue};
+
+    tracker.Initialize(500);
+
+    std::vector<uint64_t> actualCallbacks;
+
+    uint32_t registrationToken = tracker.AddThresholdHandler(
+         1000,
+         50,
+        [&actualCallbacks](uint64_t currentUsage) {
+          actualCallbacks.push_back(currentUsage);
+        });
+
+    tracker.OnAllocation(1000);
+    TestCheck(callbackMessageQueue.as<SimpleMessageQueue>()->DispatchOne());
+
+    // Within the interval, the usage above the threshold is not reported again.
+    tracker.OnAllocation(10);
+    tracker.OnDeallocation(10);
+    TestCheck(callbackMessageQueue.as<SimpleMessageQueue>()->IsEmpty());
+
+    // Once the interval has passed, flat usage is reported on the next allocation.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    tracker.OnAllocation(10);
+    tracker.OnDeallocation(10);
+    TestCheck(callbackMessageQueue.as<SimpleMessageQueue>()->DispatchOne());
+
+    // So is declining usage that stays above the threshold.
+    tracker.OnDeallocation(200);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    tracker.OnAllocation(10);
+    TestCheck(callbackMessageQueue.as<SimpleMessageQueue>()->DispatchOne());
+    TestCheck(callbackMessageQueue.as<SimpleMessageQueue>()->IsEmpty());
+
+    TestCheckEqual(static_cast<size_t>(3), actualCallbacks.size());
+    TestCheckEqual(1500ull, actualCallbacks[0]);
+    TestCheckEqual(1510ull, actualCallbacks[1]);
+    TestCheckEqual(1310ull, actualCallbacks[2]);
+
+    TestCheck(tracker.RemoveThresholdHandler(registrationToken));
+  }
+
 };
 
 // clange-format on
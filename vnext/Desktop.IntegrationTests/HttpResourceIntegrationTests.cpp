@@ -3,15 +3,44 @@
 
 #include <CppUnitTest.h>
 #include <IHttpResource.h>
+#include <Test/HttpServer.h>
+
+// Standard Library
+#include <atomic>
+#include <future>
 
 using namespace Microsoft::React;
 using namespace folly;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
+namespace http = boost::beast::http;
+
+using std::promise;
 using std::string;
 using std::vector;
 
 TEST_CLASS (HttpResourceIntegrationTest) {
+  static std::shared_ptr<Test::HttpServer> MakeServer(
+      std::uint16_t port,
+      std::atomic_int & acceptCount,
+      std::atomic_int *getCount = nullptr) {
+    auto server = std::make_shared<Test::HttpServer>("127.0.0.1", port);
+    server->SetOnAccept([&acceptCount]() { ++acceptCount; });
+    server->SetOnGet([getCount](const http::request<http::string_body> &request) -> http::response<http::dynamic_body> {
+      if (getCount)
+        ++*getCount;
+
+      http::response<http::dynamic_body> response{http::status::ok, request.version()};
+      response.body() = Test::CreateStringResponseBody("some response content");
+      response.keep_alive(request.keep_alive());
+      response.prepare_payload();
+
+      return response;
+    });
+
+    return server;
+  }
+
   TEST_METHOD(MakeIsNotNull) {
     auto rc = IHttpResource::Make();
     Assert::IsFalse(nullptr == rc);
@@ -37,11 +66,114 @@ TEST_CLASS (HttpResourceIntegrationTest) {
 
   TEST_METHOD(RequestGetFails) {
     auto rc = IHttpResource::Make();
-    string error;
-    rc->SetOnError([&error](const string &message) { error = message; });
+    promise<string> error;
+    rc->SetOnError([&error](const string &message) { error.set_value(message); });
 
     rc->SendRequest("GET", "http://nonexistinghost", {}, dynamic(), "text", false, 1000, [](int64_t) {});
 
-    Assert::AreEqual(string("No such host is known"), error);
+    Assert::AreEqual(string("No such host is known"), error.get_future().get());
+  }
+
+  TEST_METHOD(RequestGetFromServerSucceeds) {
+    std::atomic_int acceptCount{0};
+    auto server = MakeServer(5557, acceptCount);
+    server->Start();
+
+    auto rc = IHttpResource::Make();
+    bool sent = false;
+    promise<string> response;
+    rc->SetOnRequest([&sent]() { sent = true; });
+    rc->SetOnResponse([&response](const string &message) { response.set_value(message); });
+    rc->SetOnError([&response](const string &message) { response.set_value("Error: " + message); });
+
+    rc->SendRequest("GET", "http://127.0.0.1:5557/", {}, dynamic(), "text", false, 1000, [](int64_t) {});
+
+    Assert::AreEqual(string("some response content"), response.get_future().get());
+    Assert::IsTrue(sent);
+
+    server->Stop();
+  }
+
+  TEST_METHOD(SequentialRequestsReuseConnection) {
+    constexpr int requestCount = 5;
+    std::atomic_int acceptCount{0};
+    auto server = MakeServer(5558, acceptCount);
+    server->Start();
+
+    auto rc = IHttpResource::Make();
+    for (int i = 0; i < requestCount; ++i) {
+      promise<string> error;
+      rc->SetOnResponse([&error](const string &) { error.set_value({}); });
+      rc->SetOnError([&error](const string &message) { error.set_value(message); });
+
+      rc->SendRequest("GET", "http://127.0.0.1:5558/", {}, dynamic(), "text", false, 1000, [](int64_t) {});
+
+      Assert::AreEqual(string(), error.get_future().get());
+    }
+
+    Assert::AreEqual(1, acceptCount.load());
+
+    server->Stop();
+  }
+
+  TEST_METHOD(ConcurrentRequestsArePipelined) {
+    constexpr int requestCount = 32;
+    std::atomic_int acceptCount{0};
+    std::atomic_int getCount{0};
+    std::atomic_int responseCount{0};
+    std::atomic_int completedCount{0};
+    promise<void> done;
+    auto server = MakeServer(5559, acceptCount, &getCount);
+    server->Start();
+
+    auto onDone = [&]() {
+      if (++completedCount == requestCount)
+        done.set_value();
+    };
+
+    vector<std::unique_ptr<IHttpResource>> resources;
+    for (int i = 0; i < requestCount; ++i) {
+      auto rc = IHttpResource::Make();
+      rc->SetOnResponse([&](const string &) {
+        ++responseCount;
+        onDone();
+      });
+      rc->SetOnError([&](const string &) { onDone(); });
+
+      rc->SendRequest("GET", "http://127.0.0.1:5559/", {}, dynamic(), "text", false, 5000, [](int64_t) {});
+      resources.push_back(std::move(rc));
+    }
+
+    done.get_future().wait();
+
+    Assert::AreEqual(requestCount, responseCount.load());
+    Assert::AreEqual(requestCount, getCount.load());
+    // Bounded by the default maximum connections per host.
+    Assert::IsTrue(acceptCount <= 6);
+    // More requests than connections: connections carried several requests, reused or pipelined.
+    Assert::IsTrue(acceptCount > 0 && acceptCount < getCount);
+
+    server->Stop();
+  }
+
+  TEST_METHOD(RequestTimesOut) {
+    auto server = std::make_shared<Test::HttpServer>("127.0.0.1", 5560);
+    server->SetOnGet([](const http::request<http::string_body> &request) -> http::response<http::dynamic_body> {
+      std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+      return {http::status::ok, request.version()};
+    });
+    server->Start();
+
+    auto rc = IHttpResource::Make();
+    promise<string> error;
+    rc->SetOnResponse([&error](const string &) { error.set_value({}); });
+    rc->SetOnError([&error](const string &message) { error.set_value(message); });
+
+    rc->SendRequest("GET", "http://127.0.0.1:5560/", {}, dynamic(), "text", false, 100, [](int64_t) {});
+
+    Assert::AreNotEqual(string(), error.get_future().get());
+
+    server->Stop();
   }
 };
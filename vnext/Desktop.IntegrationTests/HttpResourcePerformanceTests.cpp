@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <IHttpResource.h>
+#include <Test/HttpServer.h>
+
+// Standard Library
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <sstream>
+
+using namespace Microsoft::React;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace http = boost::beast::http;
+
+using folly::dynamic;
+using std::promise;
+using std::string;
+using std::vector;
+
+// Compares requests over kept-alive connections against requests that open a new connection each time.
+// Results are written to the test log. This test must be run in isolation (no other tests running concurrently),
+// so it is ignored in the regular run. Remove TEST_IGNORE() locally to run it.
+TEST_CLASS (HttpResourcePerformanceTest) {
+  struct Result {
+    std::chrono::microseconds SequentialLatency;
+    std::chrono::milliseconds ConcurrentDuration;
+    int Connections;
+  };
+
+  static Result Measure(std::uint16_t port, const IHttpResource::Headers &headers) {
+    constexpr int requestCount = 200;
+    std::atomic_int acceptCount{0};
+
+    auto server = std::make_shared<Test::HttpServer>("127.0.0.1", port);
+    server->SetOnAccept([&acceptCount]() { ++acceptCount; });
+    server->SetOnGet([](const http::request<http::string_body> &request) -> http::response<http::dynamic_body> {
+      http::response<http::dynamic_body> response{http::status::ok, request.version()};
+      response.body() = Test::CreateStringResponseBody(string(1024, 'x'));
+      response.keep_alive(request.keep_alive());
+      response.prepare_payload();
+
+      return response;
+    });
+    server->Start();
+
+    auto url = "http://127.0.0.1:" + std::to_string(port) + "/";
+    auto rc = IHttpResource::Make();
+    Result result{};
+
+    // Sequential latency: each request waits for the previous response.
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < requestCount; ++i) {
+      promise<void> received;
+      rc->SetOnResponse([&received](const string &) { received.set_value(); });
+      rc->SetOnError([&received](const string &) { received.set_value(); });
+      rc->SendRequest("GET", url, headers, dynamic(), "text", false, 5000, [](int64_t) {});
+      received.get_future().wait();
+    }
+    result.SequentialLatency =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) / requestCount;
+
+    // Concurrent throughput: every request is issued at once.
+    std::atomic_int completed{0};
+    promise<void> done;
+    vector<std::unique_ptr<IHttpResource>> resources;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < requestCount; ++i) {
+      auto concurrent = IHttpResource::Make();
+      auto onDone = [&completed, &done]() {
+        if (++completed == requestCount)
+          done.set_value();
+      };
+      concurrent->SetOnResponse([onDone](const string &) { onDone(); });
+      concurrent->SetOnError([onDone](const string &) { onDone(); });
+      concurrent->SendRequest("GET", url, headers, dynamic(), "text", false, 5000, [](int64_t) {});
+      resources.push_back(std::move(concurrent));
+    }
+    done.get_future().wait();
+    result.ConcurrentDuration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    result.Connections = acceptCount;
+    server->Stop();
+
+    return result;
+  }
+
+  static void Log(const char *name, const Result &result) {
+    std::wostringstream message;
+    message << name << L": " << result.SequentialLatency.count() << L" us/request sequential, "
+            << result.ConcurrentDuration.count() << L" ms for concurrent batch, " << result.Connections
+            << L" connections";
+    Logger::WriteMessage(message.str().c_str());
+  }
+
+  BEGIN_TEST_METHOD_ATTRIBUTE(ConnectionReuse)
+  TEST_IGNORE()
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(ConnectionReuse) {
+    auto reused = Measure(5561, {});
+    auto notReused = Measure(5562, {{"Connection", "close"}});
+
+    Log("Keep-alive", reused);
+    Log("Connection: close", notReused);
+
+    Assert::IsTrue(reused.Connections < notReused.Connections);
+  }
+};
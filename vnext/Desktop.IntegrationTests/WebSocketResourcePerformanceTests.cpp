@@ -13,12 +13,14 @@
 // Standard library includes
 #include <math.h>
 #include <atomic>
+#include <chrono>
 #include <future>
 
 using namespace Microsoft::React;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 using Microsoft::Common::Unicode::Utf8ToUtf16;
+using std::promise;
 using std::shared_ptr;
 using std::string;
 using std::vector;
@@ -128,4 +130,59 @@ TEST_CLASS (WebSocketResourcePerformanceTest) {
     Assert::AreNotEqual(finalThreadCount, 0);
     Assert::IsTrue(threadsPerResource <= expectedThreadsPerResource);
   }
+
+  ///
+  /// Echo binary messages through the test server, first as Base64 strings and then as
+  /// raw bytes, and log the throughput of both paths.
+  ///
+  TEST_METHOD(BinaryMessageThroughput) {
+    const size_t messageCount = 200;
+    // "AQID" decodes to [ 01 02 03 ].
+    const size_t chunkCount = 16 * 1024;
+
+    string base64Message;
+    vector<uint8_t> rawMessage;
+    for (size_t i = 0; i < chunkCount; i++) {
+      base64Message += "AQID";
+      rawMessage.insert(rawMessage.end(), {1, 2, 3});
+    }
+
+    auto server = std::make_shared<Test::WebSocketServer>(5556);
+    server->SetMessageFactory([](vector<uint8_t> &&message) { return std::move(message); });
+    server->Start();
+
+    auto ws = IWebSocketResource::Make("ws://localhost:5556/");
+    string errorMessage;
+    promise<size_t> responsePromise;
+    ws->SetOnMessage([&responsePromise](size_t size, const string &message, bool isBinary) {
+      responsePromise.set_value(message.size());
+    });
+    ws->SetOnError([&errorMessage](IWebSocketResource::Error &&error) { errorMessage = error.Message; });
+    ws->Connect();
+
+    auto measure = [&](const char *name, std::function<void()> send) {
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < messageCount && errorMessage.empty(); i++) {
+        send();
+        auto future = responsePromise.get_future();
+        future.wait();
+        responsePromise = promise<size_t>();
+      }
+      auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      double megabytes = static_cast<double>(rawMessage.size() * messageCount) / (1024 * 1024);
+      Logger::WriteMessage((string{name} + ": " + std::to_string(megabytes / elapsed) + " MB/s\n").c_str());
+    };
+
+    measure("Base64", [&]() { ws->SendBinary(string{base64Message}); });
+
+    ws->SetOnBinaryMessage(
+        [&responsePromise](vector<uint8_t> &&message) { responsePromise.set_value(message.size()); });
+    measure("Raw bytes", [&]() { ws->SendBinary(vector<uint8_t>{rawMessage}); });
+
+    ws->Close(IWebSocketResource::CloseCode::Normal, "Closing after reading");
+    server->Stop();
+
+    Assert::AreEqual({}, errorMessage);
+  }
 };
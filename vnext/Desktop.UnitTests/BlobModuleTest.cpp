@@ -0,0 +1,361 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Modules/BlobModule.h>
+#include <Modules/FileReaderModule.h>
+#include <Modules/NetworkingModule.h>
+#include <Modules/WebSocketModule.h>
+#include "InstanceMocks.h"
+#include "WebSocketMocks.h"
+
+// Standard Library
+#include <stdexcept>
+
+using namespace facebook::react;
+using namespace facebook::xplat::module;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using folly::dynamic;
+using std::make_shared;
+using std::make_unique;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+// Creates an instance whose executor records the events emitted to JavaScript.
+shared_ptr<Instance> CreateInstance(vector<dynamic> &events) {
+  auto jsef = make_shared<MockJSExecutorFactory>();
+  jsef->CreateJSExecutorMock = [&events](shared_ptr<ExecutorDelegate>, shared_ptr<MessageQueueThread>) {
+    auto jse = make_unique<MockJSExecutor>();
+    jse->CallFunctionMock = [&events](const string & /*module*/, const string & /*method*/, const dynamic &args) {
+      events.push_back(args);
+    };
+
+    return std::move(jse);
+  };
+
+  return CreateMockInstance(jsef);
+}
+
+CxxModule::Method GetMethod(CxxModule &module, const string &name) {
+  for (auto &method : module.getMethods()) {
+    if (method.name == name)
+      return method;
+  }
+
+  throw std::out_of_range(name);
+}
+
+void Invoke(CxxModule &module, const string &name, dynamic args) {
+  GetMethod(module, name).func(std::move(args), [](vector<dynamic>) {}, [](vector<dynamic>) {});
+}
+
+string ToString(const BlobRegistry::Slice &slice) {
+  return string(reinterpret_cast<const char *>(slice.Data()), slice.Size);
+}
+
+} // namespace
+
+TEST_CLASS (BlobModuleTest) {
+  TEST_METHOD(CreateModule) {
+    const char *methodNames[static_cast<size_t>(BlobModule::MethodId::SIZE)]{
+        "addNetworkingHandler",
+        "addWebSocketHandler",
+        "removeWebSocketHandler",
+        "sendOverSocket",
+        "createFromParts",
+        "release"};
+    auto module = make_unique<BlobModule>();
+
+    Assert::AreEqual(string("BlobModule"), module->getName());
+
+    auto methods = module->getMethods();
+    for (size_t i = 0; i < static_cast<size_t>(BlobModule::MethodId::SIZE); i++) {
+      Assert::AreEqual(string(methodNames[i]), string(methods[i].name));
+    }
+
+    Assert::AreEqual(string("blob"), module->getConstants()["BLOB_URI_SCHEME"].getString());
+  }
+
+  TEST_METHOD(CreateFileReaderModule) {
+    auto module = make_unique<FileReaderModule>();
+
+    Assert::AreEqual(string("FileReaderModule"), module->getName());
+
+    auto methods = module->getMethods();
+    Assert::AreEqual(string("readAsDataURL"), string(methods[FileReaderModule::MethodId::ReadAsDataURL].name));
+    Assert::AreEqual(string("readAsText"), string(methods[FileReaderModule::MethodId::ReadAsText].name));
+  }
+
+  TEST_METHOD(SlicesShareStoredBuffer) {
+    BlobRegistry registry;
+    auto blobId = registry.Store(vector<uint8_t>{'a', 'b', 'c', 'd'});
+
+    auto slice = registry.Resolve(blobId, 1, 2);
+    Assert::IsTrue(slice.has_value());
+    Assert::AreEqual(static_cast<size_t>(2), slice->Size);
+    Assert::AreEqual(string("bc"), string(reinterpret_cast<const char *>(slice->Data()), slice->Size));
+
+    registry.Store("sliced", std::move(*slice));
+    auto nested = registry.Resolve("sliced", 1, 1);
+    Assert::IsTrue(nested.has_value());
+    Assert::AreEqual(static_cast<uint8_t>('c'), *nested->Data());
+    Assert::IsTrue(nested->Buffer == registry.Resolve(blobId, 0, 4)->Buffer);
+  }
+
+  TEST_METHOD(ResolveRejectsOutOfRangeSlices) {
+    BlobRegistry registry;
+    auto blobId = registry.Store(vector<uint8_t>(4));
+
+    Assert::IsFalse(registry.Resolve(blobId, 2, 3).has_value());
+    Assert::IsFalse(registry.Resolve(blobId, 5, 0).has_value());
+    Assert::IsFalse(registry.Resolve("unknown", 0, 0).has_value());
+    Assert::IsTrue(registry.Resolve(dynamic::object("blobId", blobId)("offset", 1)("size", 3)).has_value());
+  }
+
+  TEST_METHOD(ReleaseKeepsSharedBuffersAlive) {
+    BlobRegistry registry;
+    auto blobId = registry.Store(vector<uint8_t>{1, 2, 3});
+    registry.Store("slice", std::move(*registry.Resolve(blobId, 0, 3)));
+
+    registry.Release(blobId);
+
+    Assert::AreEqual(static_cast<size_t>(1), registry.Size());
+    Assert::IsFalse(registry.Resolve(blobId, 0, 0).has_value());
+    Assert::AreEqual(static_cast<uint8_t>(3), registry.Resolve("slice", 2, 1)->Data()[0]);
+  }
+
+  TEST_METHOD(WebSocketHandlersAreTracked) {
+    BlobRegistry registry;
+
+    registry.AddWebSocketHandler(7);
+    Assert::IsTrue(registry.HandlesWebSocket(7));
+    Assert::IsFalse(registry.HandlesWebSocket(8));
+
+    registry.RemoveWebSocketHandler(7);
+    Assert::IsFalse(registry.HandlesWebSocket(7));
+  }
+
+  TEST_METHOD(WebSocketsAreTracked) {
+    BlobRegistry registry;
+    auto webSocket = make_shared<MockWebSocketResource>();
+
+    registry.AddWebSocket(7, webSocket);
+    Assert::IsTrue(registry.GetWebSocket(7) == webSocket);
+    Assert::IsTrue(registry.GetWebSocket(8) == nullptr);
+
+    registry.RemoveWebSocket(7);
+    Assert::IsTrue(registry.GetWebSocket(7) == nullptr);
+  }
+
+  TEST_METHOD(CreateFromPartsConcatenatesParts) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto module = make_unique<BlobModule>();
+    module->setInstance(instance);
+    auto registry = BlobRegistry::Get(instance);
+    auto blobId = registry->Store(vector<uint8_t>{'x', 'c', 'd', 'x'});
+
+    auto parts = dynamic::array(
+        dynamic::object("type", "string")("data", "ab"),
+        dynamic::object("type", "blob")("data", dynamic::object("blobId", blobId)("offset", 1)("size", 2)));
+    Invoke(*module, "createFromParts", dynamic::array(std::move(parts), "joined"));
+
+    auto joined = registry->Resolve("joined", 0, 4);
+    Assert::IsTrue(joined.has_value());
+    Assert::AreEqual(string("abcd"), ToString(*joined));
+  }
+
+  TEST_METHOD(CreateFromSinglePartSharesBuffer) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto module = make_unique<BlobModule>();
+    module->setInstance(instance);
+    auto registry = BlobRegistry::Get(instance);
+    auto blobId = registry->Store(vector<uint8_t>{'a', 'b', 'c'});
+
+    auto blob = dynamic::object("blobId", blobId)("offset", 1)("size", 2);
+    auto parts = dynamic::array(dynamic::object("type", "blob")("data", std::move(blob)));
+    Invoke(*module, "createFromParts", dynamic::array(std::move(parts), "single"));
+
+    auto single = registry->Resolve("single", 0, 2);
+    Assert::IsTrue(single.has_value());
+    Assert::AreEqual(string("bc"), ToString(*single));
+    Assert::IsTrue(single->Buffer == registry->Resolve(blobId, 0, 3)->Buffer);
+  }
+
+  TEST_METHOD(CreateFromPartsRejectsInvalidParts) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto module = make_unique<BlobModule>();
+    module->setInstance(instance);
+    auto registry = BlobRegistry::Get(instance);
+
+    Assert::ExpectException<std::invalid_argument>([&module]() {
+      Invoke(
+          *module,
+          "createFromParts",
+          dynamic::array(dynamic::array(dynamic::object("type", "number")("data", 1)), "invalid"));
+    });
+    Assert::ExpectException<std::invalid_argument>([&module]() {
+      auto blob = dynamic::object("blobId", "unknown")("offset", 0)("size", 1);
+      Invoke(
+          *module,
+          "createFromParts",
+          dynamic::array(dynamic::array(dynamic::object("type", "blob")("data", std::move(blob))), "invalid"));
+    });
+    Assert::AreEqual(static_cast<size_t>(0), registry->Size());
+  }
+
+  TEST_METHOD(RegistriesAreSeparatePerInstance) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto other = CreateInstance(events);
+
+    auto registry = BlobRegistry::Get(instance);
+    Assert::IsTrue(registry == BlobRegistry::Get(instance));
+    Assert::IsTrue(registry == BlobRegistry::Find(instance));
+    Assert::IsTrue(registry != BlobRegistry::Get(other));
+
+    registry.reset();
+    Assert::IsTrue(BlobRegistry::Find(instance) == nullptr);
+  }
+
+  TEST_METHOD(SendOverSocketSendsBlobSlice) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto module = make_unique<BlobModule>();
+    module->setInstance(instance);
+    Invoke(*module, "addNetworkingHandler", dynamic::array());
+
+    auto webSocketModule = make_unique<WebSocketModule>();
+    webSocketModule->setInstance(instance);
+    vector<uint8_t> sent;
+    webSocketModule->SetResourceFactory([&sent](const string &) {
+      auto rc = make_shared<MockWebSocketResource>();
+      rc->Mocks.SendBinaryBytes = [&sent](vector<uint8_t> &&message) { sent = std::move(message); };
+
+      return rc;
+    });
+    Invoke(*webSocketModule, "connect", dynamic::array("ws://localhost:0", dynamic(), dynamic(), /*id*/ 3));
+
+    auto blobId = BlobRegistry::Get(instance)->Store(vector<uint8_t>{1, 2, 3, 4});
+    Invoke(
+        *module,
+        "sendOverSocket",
+        dynamic::array(dynamic::object("blobId", blobId)("offset", 1)("size", 2), /*id*/ 3));
+
+    Assert::IsTrue(vector<uint8_t>{2, 3} == sent);
+  }
+
+  TEST_METHOD(ClosedWebSocketsAreForgotten) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto module = make_unique<BlobModule>();
+    module->setInstance(instance);
+    Invoke(*module, "addNetworkingHandler", dynamic::array());
+
+    auto webSocketModule = make_unique<WebSocketModule>();
+    webSocketModule->setInstance(instance);
+    vector<shared_ptr<MockWebSocketResource>> webSockets;
+    webSocketModule->SetResourceFactory([&webSockets](const string &) {
+      webSockets.push_back(make_shared<MockWebSocketResource>());
+      return webSockets.back();
+    });
+    Invoke(*webSocketModule, "connect", dynamic::array("ws://localhost:0", dynamic(), dynamic(), /*id*/ 3));
+    Invoke(*webSocketModule, "connect", dynamic::array("ws://localhost:0", dynamic(), dynamic(), /*id*/ 4));
+
+    auto registry = BlobRegistry::Find(instance);
+    Assert::IsTrue(registry->GetWebSocket(3) != nullptr);
+    Assert::IsTrue(registry->GetWebSocket(4) != nullptr);
+
+    webSockets[0]->OnClose(IWebSocketResource::CloseCode::Normal, {});
+    webSockets[1]->OnError({"Failed", IWebSocketResource::ErrorType::Connection});
+
+    Assert::IsTrue(registry->GetWebSocket(3) == nullptr);
+    Assert::IsTrue(registry->GetWebSocket(4) == nullptr);
+  }
+
+  TEST_METHOD(WebSocketsDoNotCreateRegistry) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto webSocketModule = make_unique<WebSocketModule>();
+    webSocketModule->setInstance(instance);
+    webSocketModule->SetResourceFactory([](const string &) { return make_shared<MockWebSocketResource>(); });
+
+    Invoke(*webSocketModule, "connect", dynamic::array("ws://localhost:0", dynamic(), dynamic(), /*id*/ 3));
+
+    Assert::IsTrue(BlobRegistry::Find(instance) == nullptr);
+  }
+
+  TEST_METHOD(WebSocketBinaryMessageIsStoredAsBlob) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto module = make_unique<BlobModule>();
+    module->setInstance(instance);
+    Invoke(*module, "addWebSocketHandler", dynamic::array(/*id*/ 5));
+
+    auto webSocketModule = make_unique<WebSocketModule>();
+    webSocketModule->setInstance(instance);
+    webSocketModule->SetResourceFactory([](const string &) {
+      auto rc = make_shared<MockWebSocketResource>();
+      rc->Mocks.Connect = [rc](const IWebSocketResource::Protocols &, const IWebSocketResource::Options &) {
+        rc->OnBinaryMessage({1, 2, 3});
+      };
+
+      return rc;
+    });
+    Invoke(*webSocketModule, "connect", dynamic::array("ws://localhost:0", dynamic(), dynamic(), /*id*/ 5));
+
+    Assert::AreEqual(static_cast<size_t>(1), events.size());
+    Assert::AreEqual(string("websocketMessage"), events[0][0].asString());
+    Assert::AreEqual(string("blob"), events[0][1]["type"].asString());
+
+    auto slice = BlobRegistry::Find(instance)->Resolve(events[0][1]["data"]);
+    Assert::IsTrue(slice.has_value());
+    Assert::IsTrue(vector<uint8_t>{1, 2, 3} == vector<uint8_t>(slice->Data(), slice->Data() + slice->Size));
+  }
+
+  TEST_METHOD(NetworkingFailsBlobRequestsWithoutRegistry) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto module = make_unique<NetworkingModule>();
+    module->setInstance(instance);
+
+    Invoke(
+        *module,
+        "sendRequest",
+        dynamic::array(dynamic::object("method", "GET")("url", "http://localhost:0")("headers", dynamic::object())(
+            "data", dynamic::object())("responseType", "blob")("incrementalUpdates", false)("timeout", 0.0)));
+
+    Assert::AreEqual(static_cast<size_t>(1), events.size());
+    Assert::AreEqual(string("didCompleteNetworkResponse"), events[0][0].asString());
+    Assert::AreEqual(string("Blob module is not available"), events[0][1][1].asString());
+  }
+
+  TEST_METHOD(NetworkingFailsUnknownBlobBodies) {
+    vector<dynamic> events;
+    auto instance = CreateInstance(events);
+    auto registry = BlobRegistry::Get(instance);
+    auto module = make_unique<NetworkingModule>();
+    module->setInstance(instance);
+
+    auto body = dynamic::object("blob", dynamic::object("blobId", "unknown")("offset", 0)("size", 1));
+    Invoke(
+        *module,
+        "sendRequest",
+        dynamic::array(dynamic::object("method", "POST")("url", "http://localhost:0")("headers", dynamic::object())(
+            "data", std::move(body))("responseType", "text")("incrementalUpdates", false)("timeout", 0.0)));
+
+    Assert::AreEqual(static_cast<size_t>(1), events.size());
+    Assert::AreEqual(string("didCompleteNetworkResponse"), events[0][0].asString());
+    Assert::AreEqual(string("Unknown blob"), events[0][1][1].asString());
+  }
+};
+
+} // namespace Microsoft::React::Test
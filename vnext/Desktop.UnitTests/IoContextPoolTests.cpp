@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <IoContextPool.h>
+#include <boost/asio/post.hpp>
+#include <future>
+#include <stdexcept>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using boost::asio::io_context;
+using Microsoft::React::Beast::IoContextPool;
+using std::promise;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (IoContextPoolTest) {
+  TEST_METHOD(DefaultSizeMatchesHardwareThreads) {
+    IoContextPool pool{0};
+
+    Assert::AreEqual(static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())), pool.Size());
+  }
+
+  TEST_METHOD(ContextsAreAssignedRoundRobin) {
+    IoContextPool pool{2};
+
+    io_context &first = pool.GetContext();
+    io_context &second = pool.GetContext();
+    io_context &third = pool.GetContext();
+
+    Assert::IsTrue(&first != &second);
+    Assert::IsTrue(&first == &third);
+  }
+
+  TEST_METHOD(HandlersRunOnWorkerThreads) {
+    IoContextPool pool{2};
+    promise<bool> ranOnWorker;
+
+    Assert::IsFalse(IoContextPool::IsWorkerThread());
+    boost::asio::post(pool.GetContext(), [&ranOnWorker]() { ranOnWorker.set_value(IoContextPool::IsWorkerThread()); });
+
+    Assert::IsTrue(ranOnWorker.get_future().get());
+  }
+
+  TEST_METHOD(ThrowingHandlerDoesNotStopContext) {
+    IoContextPool pool{1};
+    promise<void> ranNext;
+
+    auto &context = pool.GetContext();
+    boost::asio::post(context, []() { throw std::runtime_error{"Handler failure"}; });
+    boost::asio::post(context, [&ranNext]() { ranNext.set_value(); });
+
+    ranNext.get_future().get();
+    Assert::IsFalse(context.stopped());
+  }
+
+  TEST_METHOD(SharedPoolIsReleasedWithLastReference) {
+    std::weak_ptr<IoContextPool> weakPool;
+    {
+      auto pool = IoContextPool::Shared();
+      weakPool = pool;
+
+      Assert::IsTrue(pool == IoContextPool::Shared());
+    }
+
+    Assert::IsTrue(weakPool.expired());
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <RAMBundle.h>
+
+#include <windows.h>
+
+// Standard Library
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using facebook::react::JSModulesUnbundle;
+using Microsoft::ReactNative::FileRAMBundle;
+using Microsoft::ReactNative::IndexedRAMBundle;
+using std::string;
+using std::uint32_t;
+using std::vector;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint32_t MagicNumber = 0xFB0BD1E5;
+
+fs::path GetTestDirectoryPath() {
+  return fs::temp_directory_path() / ("RAMBundleTests_" + std::to_string(GetCurrentProcessId()));
+}
+
+fs::path GetTestDirectory() {
+  auto directory = GetTestDirectoryPath();
+  fs::create_directories(directory);
+
+  return directory;
+}
+
+void AppendUInt32(string &content, uint32_t value) {
+  content.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// Lays out an indexed RAM bundle. Empty modules get no code, like in bundles produced by Metro.
+string MakeIndexedBundle(const string &startupCode, const vector<string> &modules) {
+  string table;
+  string code = startupCode + '\0';
+  for (const auto &module : modules) {
+    AppendUInt32(table, module.empty() ? 0 : static_cast<uint32_t>(code.size()));
+    AppendUInt32(table, module.empty() ? 0 : static_cast<uint32_t>(module.size() + 1));
+    if (!module.empty())
+      code += module + '\0';
+  }
+
+  string bundle;
+  AppendUInt32(bundle, MagicNumber);
+  AppendUInt32(bundle, static_cast<uint32_t>(modules.size()));
+  AppendUInt32(bundle, static_cast<uint32_t>(startupCode.size() + 1));
+
+  return bundle + table + code;
+}
+
+void WriteTestFile(const fs::path &path, const string &content) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(content.data(), content.size());
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (RAMBundleTests) {
+  TEST_METHOD_CLEANUP(CleanUp) {
+    std::error_code error;
+    fs::remove_all(GetTestDirectoryPath(), error);
+  }
+
+  TEST_METHOD(IndexedBundleModulesAreReadFromTable) {
+    auto path = (GetTestDirectory() / "indexed.bundle").u8string();
+    WriteTestFile(path, MakeIndexedBundle("startup();", {"module0();", "", "module2();"}));
+
+    Assert::IsTrue(IndexedRAMBundle::IsIndexedRAMBundle(path));
+    Assert::IsFalse(FileRAMBundle::IsFileRAMBundle(path));
+
+    IndexedRAMBundle bundle{path};
+    auto startupCode = bundle.GetStartupCode();
+    Assert::AreEqual(string("startup();"), string(startupCode->c_str(), startupCode->size()));
+
+    auto module = bundle.getModule(2);
+    Assert::AreEqual(string("2.js"), module.name);
+    Assert::AreEqual(string("module2();"), module.code);
+  }
+
+  TEST_METHOD(IndexedBundleRejectsMissingModules) {
+    auto path = (GetTestDirectory() / "missing.bundle").u8string();
+    WriteTestFile(path, MakeIndexedBundle("startup();", {"", "module1();"}));
+
+    IndexedRAMBundle bundle{path};
+
+    Assert::ExpectException<JSModulesUnbundle::ModuleNotFound>([&bundle]() { bundle.getModule(0); });
+    Assert::ExpectException<JSModulesUnbundle::ModuleNotFound>([&bundle]() { bundle.getModule(2); });
+  }
+
+  TEST_METHOD(IndexedBundleRejectsOversizedModuleTable) {
+    auto path = (GetTestDirectory() / "oversized.bundle").u8string();
+
+    // 0x20000000 table entries take 4 GiB, which would wrap the table size around in 32-bit builds.
+    string bundle;
+    AppendUInt32(bundle, MagicNumber);
+    AppendUInt32(bundle, 0x20000000);
+    AppendUInt32(bundle, 1);
+    WriteTestFile(path, bundle + '\0');
+
+    Assert::ExpectException<std::runtime_error>([&path]() { IndexedRAMBundle bundle{path}; });
+  }
+
+  TEST_METHOD(IndexedBundleRejectsUnterminatedStartupCode) {
+    auto path = (GetTestDirectory() / "unterminated.bundle").u8string();
+    auto bundle = MakeIndexedBundle("startup();", {});
+    bundle.back() = ';';
+    WriteTestFile(path, bundle);
+
+    Assert::ExpectException<std::runtime_error>([&path]() { IndexedRAMBundle bundle{path}; });
+  }
+
+  TEST_METHOD(PlainBundleIsNotRAMBundle) {
+    auto path = (GetTestDirectory() / "plain.bundle").u8string();
+    WriteTestFile(path, "var plain = true;");
+
+    Assert::IsFalse(Microsoft::ReactNative::IsRAMBundle(path));
+  }
+
+  TEST_METHOD(FileBundleModulesAreReadFromModuleFiles) {
+    auto directory = GetTestDirectory() / "file";
+    fs::create_directories(directory / "js-modules");
+
+    string magic;
+    AppendUInt32(magic, MagicNumber);
+    WriteTestFile(directory / "js-modules" / "UNBUNDLE", magic);
+    WriteTestFile(directory / "js-modules" / "7.js", "module7();");
+    WriteTestFile(directory / "index.bundle", "startup();");
+
+    auto path = (directory / "index.bundle").u8string();
+    Assert::IsTrue(FileRAMBundle::IsFileRAMBundle(path));
+
+    FileRAMBundle bundle{path};
+    auto startupCode = bundle.GetStartupCode();
+    Assert::AreEqual(string("startup();"), string(startupCode->c_str(), startupCode->size()));
+    Assert::AreEqual('\0', startupCode->c_str()[startupCode->size()]);
+    Assert::AreEqual(string("module7();"), bundle.getModule(7).code);
+    Assert::ExpectException<JSModulesUnbundle::ModuleNotFound>([&bundle]() { bundle.getModule(8); });
+  }
+};
+
+} // namespace Microsoft::React::Test
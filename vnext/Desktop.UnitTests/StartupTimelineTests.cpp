@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <StartupTimeline.h>
+
+// Standard Library
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using std::string;
+using std::vector;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (StartupTimelineTests) {
+  TEST_METHOD(MarkersAreRecordedInOrder) {
+    StartupTimeline timeline;
+
+    timeline.Mark(StartupMarker::ReadBundleStart, "index.bundle");
+    timeline.Mark(StartupMarker::ReadBundleStop, "index.bundle");
+    timeline.Mark(StartupMarker::ByteCodeCacheMiss);
+
+    auto entries = timeline.GetEntries();
+    Assert::AreEqual(static_cast<size_t>(3), entries.size());
+    Assert::IsTrue(StartupMarker::ReadBundleStart == entries[0].Marker);
+    Assert::AreEqual(string("index.bundle"), entries[0].Tag);
+    Assert::IsTrue(StartupMarker::ByteCodeCacheMiss == entries[2].Marker);
+    Assert::IsTrue(entries[2].Tag.empty());
+    Assert::IsTrue(entries[0].ElapsedMilliseconds <= entries[1].ElapsedMilliseconds);
+    Assert::IsTrue(entries[1].ElapsedMilliseconds <= entries[2].ElapsedMilliseconds);
+  }
+
+  TEST_METHOD(FirstViewMarkersAreRecordedOnce) {
+    StartupTimeline timeline;
+
+    timeline.Mark(StartupMarker::FirstCreateView, "RCTView");
+    timeline.Mark(StartupMarker::FirstCreateView, "RCTText");
+    timeline.Mark(StartupMarker::FirstLayout);
+    timeline.Mark(StartupMarker::FirstLayout);
+
+    auto entries = timeline.GetEntries();
+    Assert::AreEqual(static_cast<size_t>(2), entries.size());
+    Assert::AreEqual(string("RCTView"), entries[0].Tag);
+    Assert::IsTrue(StartupMarker::FirstLayout == entries[1].Marker);
+  }
+
+  TEST_METHOD(ListenerReceivesMarkers) {
+    StartupTimeline timeline;
+    vector<string> names;
+    timeline.SetListener([&names](const StartupMarkerEntry &entry) {
+      names.push_back(StartupTimeline::GetMarkerName(entry.Marker));
+    });
+
+    timeline.Mark(StartupMarker::EvaluateBundleStart);
+    timeline.Mark(StartupMarker::EvaluateBundleStop);
+
+    Assert::AreEqual(static_cast<size_t>(2), names.size());
+    Assert::AreEqual(string("EvaluateBundleStart"), names[0]);
+    Assert::AreEqual(string("EvaluateBundleStop"), names[1]);
+  }
+};
+
+} // namespace Microsoft::React::Test
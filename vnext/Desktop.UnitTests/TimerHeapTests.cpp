@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Modules/TimerHeap.h>
+
+// Standard Library
+#include <chrono>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using std::vector;
+using std::chrono::milliseconds;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+using TimePoint = std::chrono::time_point<std::chrono::steady_clock, milliseconds>;
+
+TimePoint At(int64_t ms) {
+  return TimePoint{milliseconds{ms}};
+}
+
+vector<int64_t> PopDue(TimerHeap<TimePoint> &timers, TimePoint time) {
+  vector<int64_t> ids;
+  timers.PopDue(time, [&ids](const auto &timer) { ids.push_back(timer.Id); });
+  return ids;
+}
+
+} // namespace
+
+TEST_CLASS (TimerHeapTests) {
+  TEST_METHOD(TimersFireInDueOrder) {
+    TimerHeap<TimePoint> timers;
+    timers.Push(1, At(30), milliseconds{30}, false);
+    timers.Push(2, At(10), milliseconds{10}, false);
+    timers.Push(3, At(20), milliseconds{20}, false);
+    timers.Push(4, At(10), milliseconds{10}, false);
+
+    Assert::IsTrue(vector<int64_t>{2, 4} == PopDue(timers, At(15)));
+    Assert::IsTrue(vector<int64_t>{3, 1} == PopDue(timers, At(30)));
+    Assert::IsTrue(timers.IsEmpty());
+  }
+
+  TEST_METHOD(RemovedTimersDoNotFire) {
+    TimerHeap<TimePoint> timers;
+    for (int64_t id = 0; id < 100; id++) {
+      timers.Push(id, At(id * 7 % 100), milliseconds{0}, false);
+    }
+    for (int64_t id = 0; id < 100; id += 2) {
+      Assert::IsTrue(timers.Remove(id));
+    }
+    Assert::IsFalse(timers.Remove(0));
+    Assert::AreEqual(static_cast<size_t>(50), timers.Size());
+
+    // The remaining timers still fire in due order.
+    auto ids = PopDue(timers, At(100));
+    Assert::AreEqual(static_cast<size_t>(50), ids.size());
+    for (size_t i = 1; i < ids.size(); i++) {
+      Assert::IsTrue(ids[i] % 2 == 1);
+      Assert::IsTrue(ids[i - 1] * 7 % 100 < ids[i] * 7 % 100);
+    }
+  }
+
+  TEST_METHOD(RepeatingTimersDoNotDrift) {
+    TimerHeap<TimePoint> timers;
+    timers.Push(1, At(100), milliseconds{100}, true);
+
+    // Firing late does not push back the following periods, and missed periods are skipped.
+    Assert::IsTrue(vector<int64_t>{1} == PopDue(timers, At(130)));
+    Assert::IsTrue(At(200) == timers.Front().DueTime);
+    Assert::IsTrue(vector<int64_t>{1} == PopDue(timers, At(470)));
+    Assert::IsTrue(At(500) == timers.Front().DueTime);
+  }
+
+  TEST_METHOD(WakeupsCoalesceWithinSlack) {
+    TimerHeap<TimePoint> timers{milliseconds{10}};
+    timers.Push(1, At(100), milliseconds{100}, false);
+    timers.Push(2, At(105), milliseconds{105}, false);
+    timers.Push(3, At(120), milliseconds{120}, false);
+
+    // The wakeup is not delayed by the slack, but serves the timers due within it.
+    Assert::IsTrue(At(100) == timers.WakeupTime());
+    Assert::IsTrue(vector<int64_t>{1, 2} == PopDue(timers, timers.WakeupTime()));
+    Assert::IsTrue(At(120) == timers.WakeupTime());
+  }
+
+  TEST_METHOD(RepeatingTimersFireOncePerWakeupWithinSlack) {
+    TimerHeap<TimePoint> timers{milliseconds{10}};
+    timers.Push(1, At(100), milliseconds{3}, true);
+    timers.Push(2, At(108), milliseconds{100}, false);
+
+    Assert::IsTrue(vector<int64_t>{1, 2} == PopDue(timers, At(100)));
+    Assert::IsTrue(At(103) == timers.WakeupTime());
+  }
+};
+
+} // namespace Microsoft::React::Test
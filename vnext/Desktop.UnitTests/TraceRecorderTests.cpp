@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <tracing/TraceRecorder.h>
+#include <tracing/fbsystrace.h>
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using facebook::react::tracing::TraceFormat;
+using facebook::react::tracing::TraceRecord;
+using facebook::react::tracing::TraceRecorder;
+using facebook::react::tracing::TraceRecordType;
+using std::string;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+// Returns the values of the counter records with the name, in the order of the Chrome JSON trace.
+std::vector<int64_t> GetCounterValues(const string &json, const string &name) {
+  const string prefix = "\"name\":\"" + name + "\",\"args\":{\"value\":";
+  std::vector<int64_t> values;
+  for (size_t pos = json.find(prefix); pos != string::npos; pos = json.find(prefix, pos + 1)) {
+    values.push_back(std::stoll(json.substr(pos + prefix.size())));
+  }
+  return values;
+}
+
+} // namespace
+
+// We turn clang format off here because it does not work with some of the
+// test macros.
+// clang-format off
+
+TEST_CLASS(TraceRecorderTest) {
+
+  TEST_METHOD_CLEANUP(MethodCleanup) {
+    TraceRecorder::Stop();
+  }
+
+  TEST_METHOD(TraceRecorderTest_RecordsNothingWhenStopped) {
+    TraceRecorder::Start();
+    TraceRecorder::Stop();
+    Assert::IsFalse(TraceRecorder::IsEnabled());
+    TraceRecorder::Record(TraceRecordType::SectionBegin, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Stopped");
+
+    std::ostringstream stream;
+    Assert::IsTrue(TraceRecorder::Write(stream, TraceFormat::ChromeJson));
+    Assert::AreEqual(string::npos, stream.str().find("TraceRecorderTest_Stopped"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_WritesChromeJson) {
+    TraceRecorder::Start();
+    TraceRecorder::Record(
+        TraceRecordType::SectionBegin, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Section", "TraceRecorderTest_Args");
+    TraceRecorder::Record(TraceRecordType::SectionEnd, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Section");
+    std::thread([]() {
+      TraceRecorder::Record(TraceRecordType::Counter, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Counter", {}, 42);
+    }).join();
+
+    std::ostringstream stream;
+    Assert::IsTrue(TraceRecorder::Write(stream, TraceFormat::ChromeJson));
+    string json = stream.str();
+    Assert::AreNotEqual(string::npos, json.find("\"ph\":\"B\""));
+    Assert::AreNotEqual(string::npos, json.find("\"ph\":\"E\""));
+    Assert::AreNotEqual(string::npos, json.find("\"name\":\"TraceRecorderTest_Section\""));
+    Assert::AreNotEqual(string::npos, json.find("\"args\":{\"args\":\"TraceRecorderTest_Args\"}"));
+    Assert::AreNotEqual(string::npos, json.find("\"cat\":\"react_apps\",\"name\":\"TraceRecorderTest_Counter\",\"args\":{\"value\":42}"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_TruncatesLongText) {
+    TraceRecorder::Start();
+    // The name fills all but one byte, so the two byte character of the arguments does not fit.
+    string name(TraceRecord::MaxTextLength - 1, 'n');
+    TraceRecorder::Record(TraceRecordType::SectionBegin, TRACE_TAG_REACT_APPS, name, "\xC3\xA9");
+    TraceRecorder::Record(TraceRecordType::SectionBegin, TRACE_TAG_REACT_APPS, string(1000, 'm'), "args");
+
+    std::ostringstream stream;
+    Assert::IsTrue(TraceRecorder::Write(stream, TraceFormat::ChromeJson));
+    string json = stream.str();
+    Assert::AreNotEqual(string::npos, json.find("\"name\":\"" + name + "\"}"));
+    Assert::AreNotEqual(string::npos, json.find("\"name\":\"" + string(TraceRecord::MaxTextLength, 'm') + "\"}"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_KeepsNewestRecords) {
+    TraceRecorder::Start(4);
+    for (int i = 0; i < 10; ++i) {
+      TraceRecorder::Record(TraceRecordType::Counter, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Ring", {}, i);
+    }
+
+    std::ostringstream stream;
+    Assert::IsTrue(TraceRecorder::Write(stream, TraceFormat::ChromeJson));
+    Assert::IsTrue(std::vector<int64_t>{6, 7, 8, 9} == GetCounterValues(stream.str(), "TraceRecorderTest_Ring"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_KeepsNewestRecordsAcrossWrapBoundary) {
+    for (int count = 3; count <= 9; ++count) {
+      TraceRecorder::Start(4);
+      for (int i = 0; i < count; ++i) {
+        TraceRecorder::Record(TraceRecordType::Counter, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Wrap", {}, i);
+      }
+
+      std::vector<int64_t> expected;
+      for (int i = std::max(0, count - 4); i < count; ++i) {
+        expected.push_back(i);
+      }
+
+      std::ostringstream stream;
+      Assert::IsTrue(TraceRecorder::Write(stream, TraceFormat::ChromeJson));
+      Assert::IsTrue(expected == GetCounterValues(stream.str(), "TraceRecorderTest_Wrap"));
+    }
+  }
+
+  TEST_METHOD(TraceRecorderTest_SnapshotWhileWritingHasNoTornRecords) {
+    TraceRecorder::Start(16);
+    std::atomic<bool> isDone{false};
+    std::thread writer([&isDone]() {
+      for (int64_t i = 0; !isDone; ++i) {
+        // The name repeats the value, so that a record mixing two writes does not match.
+        TraceRecorder::Record(
+            TraceRecordType::Counter, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Torn" + std::to_string(i), {}, i);
+      }
+    });
+
+    for (int i = 0; i < 200; ++i) {
+      std::ostringstream stream;
+      Assert::IsTrue(TraceRecorder::Write(stream, TraceFormat::ChromeJson));
+      string json = stream.str();
+
+      const string namePrefix = "\"name\":\"TraceRecorderTest_Torn";
+      int64_t previous = -1;
+      size_t count = 0;
+      for (size_t pos = json.find(namePrefix); pos != string::npos; pos = json.find(namePrefix, pos + 1)) {
+        int64_t nameValue = std::stoll(json.substr(pos + namePrefix.size()));
+        size_t valuePos = json.find("{\"value\":", pos);
+        int64_t value = std::stoll(json.substr(valuePos + 9));
+        Assert::AreEqual(nameValue, value);
+        Assert::IsTrue(value > previous);
+        previous = value;
+        ++count;
+      }
+      Assert::IsTrue(count <= 16);
+    }
+
+    isDone = true;
+    writer.join();
+  }
+
+  TEST_METHOD(TraceRecorderTest_WritesPerfetto) {
+    TraceRecorder::Start();
+    TraceRecorder::Record(TraceRecordType::AsyncSectionBegin, TRACE_TAG_REACT_APPS, "TraceRecorderTest_Async", {}, 7);
+
+    std::ostringstream stream;
+    Assert::IsTrue(TraceRecorder::Write(stream, TraceFormat::Perfetto));
+    string trace = stream.str();
+
+    // Trace.packet field, length delimited.
+    Assert::AreEqual('\x0A', trace[0]);
+    Assert::AreNotEqual(string::npos, trace.find("TraceRecorderTest_Async"));
+  }
+};
+
+// clang-format on
+
+} // namespace Microsoft::React::Test
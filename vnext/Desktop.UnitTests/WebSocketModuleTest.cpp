@@ -92,6 +92,49 @@ TEST_CLASS (WebSocketModuleTest) {
     Assert::AreEqual({"emit"}, methodName);
     Assert::AreEqual({"websocketOpen"}, eventName);
   }
+
+  TEST_METHOD(BinaryMessageSendsBase64EventWithoutJsi) {
+    string eventName;
+    string data;
+    string type;
+    auto jsef = make_shared<MockJSExecutorFactory>();
+    jsef->CreateJSExecutorMock = [&eventName, &data, &type](
+                                     shared_ptr<ExecutorDelegate>, shared_ptr<MessageQueueThread>) {
+      auto jse = make_unique<MockJSExecutor>();
+      jse->CallFunctionMock = [&eventName, &data, &type](
+                                  const string & /*module*/, const string & /*method*/, const dynamic &args) {
+        eventName = args.at(0).asString();
+        if (eventName == "websocketMessage") {
+          data = args.at(1).at("data").asString();
+          type = args.at(1).at("type").asString();
+        }
+      };
+
+      return std::move(jse);
+    };
+
+    auto instance = CreateMockInstance(jsef);
+    auto module = make_unique<WebSocketModule>();
+    module->setInstance(instance);
+    module->SetResourceFactory([](const string &) {
+      auto rc = make_shared<MockWebSocketResource>();
+      rc->Mocks.Connect = [rc](const IWebSocketResource::Protocols &, const IWebSocketResource::Options &) {
+        rc->OnBinaryMessage({1, 2, 3});
+      };
+
+      return rc;
+    });
+
+    auto connect = module->getMethods().at(WebSocketModule::MethodId::Connect);
+    connect.func(
+        dynamic::array("ws://localhost:0", dynamic(), dynamic(), /*id*/ 0),
+        [](vector<dynamic>) {},
+        [](vector<dynamic>) {});
+
+    Assert::AreEqual({"websocketMessage"}, eventName);
+    Assert::AreEqual({"AQID"}, data);
+    Assert::AreEqual({"binary"}, type);
+  }
 };
 
 } // namespace Microsoft::React::Test
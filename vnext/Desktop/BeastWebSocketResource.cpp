@@ -35,16 +35,56 @@ namespace Beast {
 #pragma region BaseWebSocketResource members
 
 template <typename SocketLayer, typename Stream>
-BaseWebSocketResource<SocketLayer, Stream>::BaseWebSocketResource(Url &&url) : m_url{std::move(url)} {}
+BaseWebSocketResource<SocketLayer, Stream>::BaseWebSocketResource(Url &&url)
+    : m_url{std::move(url)}, m_pool{IoContextPool::Shared()}, m_context{m_pool->GetContext()} {}
 
 template <typename SocketLayer, typename Stream>
 BaseWebSocketResource<SocketLayer, Stream>::~BaseWebSocketResource() noexcept {
-  if (!m_context.stopped()) {
-    if (!m_closeRequested)
-      Close(CloseCode::GoingAway, "Terminating instance");
-    else if (!m_closeInProgress)
-      PerformClose();
+  // Pending handlers hold a reference to this instance, so none is left to wait for.
+  // Close a connection that is still open, handing the stream over to the close handler.
+  if (!m_stream || ReadyState::Open != m_readyState || m_closeInProgress)
+    return;
+
+  auto reason = m_closeRequested
+      ? websocket::close_reason{ToBeastCloseCode(m_closeCodeRequest), m_closeReasonRequest}
+      : websocket::close_reason{websocket::close_code::going_away, "Terminating instance"};
+
+  post(m_context, [stream = shared_ptr<Stream>{std::move(m_stream)}, reason, pool = m_pool]() {
+    stream->async_close(reason, [stream, pool](error_code) {});
+  });
+}
+
+template <typename SocketLayer, typename Stream>
+template <typename Handler>
+auto BaseWebSocketResource<SocketLayer, Stream>::TrackOperation(Handler &&handler) {
+  {
+    std::lock_guard<std::mutex> lock{m_pendingOperationsMutex};
+    ++m_pendingOperations;
   }
+
+  // The wrapped handler keeps this instance alive until the decrement below.
+  return [this, handler = std::forward<Handler>(handler)](auto &&... args) mutable {
+    // Decrements on every exit path, including an error handler that throws, so Stop does not wait forever.
+    struct PendingOperationGuard {
+      ~PendingOperationGuard() {
+        std::lock_guard<std::mutex> lock{Resource.m_pendingOperationsMutex};
+        if (--Resource.m_pendingOperations == 0)
+          Resource.m_pendingOperationsDone.notify_all();
+      }
+
+      BaseWebSocketResource &Resource;
+    } guard{*this};
+
+    try {
+      handler(std::forward<decltype(args)>(args)...);
+    } catch (const std::exception &e) {
+      if (m_errorHandler)
+        m_errorHandler({e.what(), ErrorType::None});
+    } catch (...) {
+      if (m_errorHandler)
+        m_errorHandler({"Unknown error", ErrorType::None});
+    }
+  };
 }
 
 template <typename SocketLayer, typename Stream>
@@ -54,7 +94,7 @@ void BaseWebSocketResource<SocketLayer, Stream>::Handshake() {
   m_stream->async_handshake(
       m_url.host,
       m_url.Target(),
-      bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnHandshake, SharedFromThis()));
+      TrackOperation(bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnHandshake, SharedFromThis())));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -94,7 +134,8 @@ void BaseWebSocketResource<SocketLayer, Stream>::PerformRead() {
 
   // Check if there are more bytes available than a header length (2).
   m_stream->async_read(
-      m_bufferIn, bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnRead, SharedFromThis()));
+      m_bufferIn,
+      TrackOperation(bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnRead, SharedFromThis())));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -104,6 +145,12 @@ void BaseWebSocketResource<SocketLayer, Stream>::OnRead(error_code ec, size_t si
   } else if (ec) {
     if (m_errorHandler)
       m_errorHandler({ec.message(), ErrorType::Receive});
+  } else if (m_stream->got_binary() && m_binaryReadHandler) {
+    std::vector<uint8_t> message(m_bufferIn.size());
+    boost::asio::buffer_copy(boost::asio::buffer(message), m_bufferIn.data());
+    m_bufferIn.consume(size);
+
+    m_binaryReadHandler(std::move(message));
   } else {
     string message{buffers_to_string(m_bufferIn.data())};
 
@@ -137,19 +184,27 @@ void BaseWebSocketResource<SocketLayer, Stream>::PerformWrite() {
   assert(!m_writeInProgress);
   m_writeInProgress = true;
 
-  std::pair<string, bool> request = m_writeRequests.front();
+  m_writeInFlight = std::move(m_writeRequests.front());
   m_writeRequests.pop();
 
-  m_stream->binary(request.second);
+  m_stream->binary(!std::holds_alternative<string>(m_writeInFlight));
+  auto payload = std::visit(
+      [](auto &message) -> const_buffer {
+        if constexpr (std::is_same_v<std::decay_t<decltype(message)>, SharedBytes>)
+          return buffer(message.Buffer->data() + message.Offset, message.Size);
+        else
+          return buffer(message);
+      },
+      m_writeInFlight);
 
   // Auto-fragment disabled. Adjust write buffer to the largest message length
   // processed.
-  if (request.first.length() > m_stream->write_buffer_bytes())
-    m_stream->write_buffer_bytes(request.first.length());
+  if (payload.size() > m_stream->write_buffer_bytes())
+    m_stream->write_buffer_bytes(payload.size());
 
   m_stream->async_write(
-      buffer(request.first),
-      bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnWrite, SharedFromThis()));
+      payload,
+      TrackOperation(bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnWrite, SharedFromThis())));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -178,7 +233,7 @@ void BaseWebSocketResource<SocketLayer, Stream>::PerformPing() {
 
   m_stream->async_ping(
       websocket::ping_data(),
-      bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnPing, SharedFromThis()));
+      TrackOperation(bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnPing, SharedFromThis())));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -202,9 +257,9 @@ void BaseWebSocketResource<SocketLayer, Stream>::PerformClose() {
 
   m_stream->async_close(
       ToBeastCloseCode(m_closeCodeRequest),
-      bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnClose, SharedFromThis()));
+      TrackOperation(bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnClose, SharedFromThis())));
 
-  // Synchronize context thread.
+  // Wait for the pending operations of this instance.
   Stop();
 }
 
@@ -223,21 +278,22 @@ void BaseWebSocketResource<SocketLayer, Stream>::OnClose(error_code ec) {
 
 template <typename SocketLayer, typename Stream>
 void BaseWebSocketResource<SocketLayer, Stream>::Stop() {
-  if (m_workGuard)
-    m_workGuard->reset();
+  // Handlers for this instance may be queued behind the caller on the same worker.
+  if (m_context.get_executor().running_in_this_thread())
+    return;
 
-  if (m_contextThread.joinable() && std::this_thread::get_id() != m_contextThread.get_id())
-    m_contextThread.join();
+  std::unique_lock<std::mutex> lock{m_pendingOperationsMutex};
+  m_pendingOperationsDone.wait(lock, [this]() { return m_pendingOperations == 0; });
 }
 
 template <typename SocketLayer, typename Stream>
-void BaseWebSocketResource<SocketLayer, Stream>::EnqueueWrite(const string &message, bool binary) {
-  post(m_context, [self = SharedFromThis(), message = std::move(message), binary]() {
-    self->m_writeRequests.emplace(std::move(message), binary);
+void BaseWebSocketResource<SocketLayer, Stream>::EnqueueWrite(WriteRequest &&message) {
+  post(m_context, TrackOperation([self = SharedFromThis(), message = std::move(message)]() mutable {
+    self->m_writeRequests.push(std::move(message));
 
     if (!self->m_writeInProgress && ReadyState::Open == self->m_readyState)
       self->PerformWrite();
-  });
+  }));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -337,12 +393,7 @@ void BaseWebSocketResource<SocketLayer, Stream>::Connect(const Protocols &protoc
   resolver.async_resolve(
       m_url.host,
       m_url.port,
-      bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnResolve, SharedFromThis()));
-
-  m_contextThread = std::thread([self = SharedFromThis()]() {
-    self->m_workGuard = make_unique<executor_work_guard<io_context::executor_type>>(make_work_guard(self->m_context));
-    self->m_context.run();
-  });
+      TrackOperation(bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnResolve, SharedFromThis())));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -358,7 +409,8 @@ void BaseWebSocketResource<SocketLayer, Stream>::OnResolve(
 
   // Connect
   get_lowest_layer(*m_stream).async_connect(
-      results, bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnConnect, SharedFromThis()));
+      results,
+      TrackOperation(bind_front_handler(&BaseWebSocketResource<SocketLayer, Stream>::OnConnect, SharedFromThis())));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -387,26 +439,26 @@ void BaseWebSocketResource<SocketLayer, Stream>::Close(CloseCode code, const str
   if (m_handshakePerformed)
     PerformClose();
   else
-    Stop(); // Synchronize the context thread.
+    Stop(); // Wait for the connection sequence to complete.
 }
 
 template <typename SocketLayer, typename Stream>
 void BaseWebSocketResource<SocketLayer, Stream>::Send(string &&message) noexcept {
-  EnqueueWrite(std::move(message), false);
+  EnqueueWrite(std::move(message));
 }
 
 template <typename SocketLayer, typename Stream>
 void BaseWebSocketResource<SocketLayer, Stream>::SendBinary(string &&base64String) noexcept {
   m_stream->binary(true);
 
-  string message;
+  std::vector<uint8_t> message;
   try {
     typedef transform_width<binary_from_base64<string::const_iterator>, 8, 6> decode_base64;
 
     // A correctly formed base64 string should have from 0 to three '=' trailing
     // characters. Skip those.
     size_t padSize = std::count(base64String.begin(), base64String.end(), '=');
-    message = string(decode_base64(base64String.begin()), decode_base64(base64String.end() - padSize));
+    message.assign(decode_base64(base64String.begin()), decode_base64(base64String.end() - padSize));
   } catch (const std::exception &) {
     if (m_errorHandler)
       m_errorHandler({"", ErrorType::Send});
@@ -414,7 +466,17 @@ void BaseWebSocketResource<SocketLayer, Stream>::SendBinary(string &&base64Strin
     return;
   }
 
-  EnqueueWrite(std::move(message), true);
+  EnqueueWrite(std::move(message));
+}
+
+template <typename SocketLayer, typename Stream>
+void BaseWebSocketResource<SocketLayer, Stream>::SendBinary(std::vector<uint8_t> &&message) noexcept {
+  EnqueueWrite(std::move(message));
+}
+
+template <typename SocketLayer, typename Stream>
+void BaseWebSocketResource<SocketLayer, Stream>::SendBinary(SharedBytes &&message) noexcept {
+  EnqueueWrite(std::move(message));
 }
 
 template <typename SocketLayer, typename Stream>
@@ -452,6 +514,12 @@ void BaseWebSocketResource<SocketLayer, Stream>::SetOnMessage(
   m_readHandler = handler;
 }
 
+template <typename SocketLayer, typename Stream>
+void BaseWebSocketResource<SocketLayer, Stream>::SetOnBinaryMessage(
+    function<void(std::vector<uint8_t> &&)> &&handler) noexcept {
+  m_binaryReadHandler = handler;
+}
+
 template <typename SocketLayer, typename Stream>
 void BaseWebSocketResource<SocketLayer, Stream>::SetOnClose(
     function<void(CloseCode, const string &)> &&handler) noexcept {
@@ -497,7 +565,8 @@ SecureWebSocketResource::SecureWebSocketResource(Url &&url) : BaseWebSocketResou
 void SecureWebSocketResource::Handshake() {
   // Prefer shared_from_this() in concrete classes. SharedFromThis() falis to compile.
   this->m_stream->next_layer().async_handshake(
-      ssl::stream_base::client, bind_front_handler(&SecureWebSocketResource::OnSslHandshake, shared_from_this()));
+      ssl::stream_base::client,
+      TrackOperation(bind_front_handler(&SecureWebSocketResource::OnSslHandshake, shared_from_this())));
 }
 
 void SecureWebSocketResource::OnSslHandshake(error_code ec) {
@@ -8,9 +8,12 @@
 #include <boost/beast/ssl.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/beast/websocket/ssl.hpp>
+#include <condition_variable>
+#include <mutex>
 #include <queue>
-#include <thread>
+#include <variant>
 #include "IWebSocketResource.h"
+#include "IoContextPool.h"
 #include "Utils.h"
 
 namespace Microsoft::React::Beast {
@@ -23,17 +26,34 @@ class BaseWebSocketResource : public IWebSocketResource {
   std::function<void()> m_pingHandler;
   std::function<void(std::size_t)> m_writeHandler;
   std::function<void(std::size_t, const std::string &, bool)> m_readHandler;
+  std::function<void(std::vector<std::uint8_t> &&)> m_binaryReadHandler;
   std::function<void(CloseCode, const std::string &)> m_closeHandler;
 
   Url m_url;
   ReadyState m_readyState{ReadyState::Connecting};
   boost::beast::multi_buffer m_bufferIn;
-  std::thread m_contextThread;
+
+  /// <summary>
+  /// Number of asynchronous operations posted by this instance that have not completed yet.
+  /// </summary>
+  std::size_t m_pendingOperations{0};
+  std::mutex m_pendingOperationsMutex;
+  std::condition_variable m_pendingOperationsDone;
+
+  /// <summary>
+  /// Text messages are kept as strings, binary messages as raw bytes.
+  /// </summary>
+  using WriteRequest = std::variant<std::string, std::vector<std::uint8_t>, SharedBytes>;
 
   /// <remarks>
   /// Must be modified exclusively from the context thread.
   /// </remarks>
-  std::queue<std::pair<std::string, bool>> m_writeRequests;
+  std::queue<WriteRequest> m_writeRequests;
+
+  /// <summary>
+  /// Keeps the payload of the write in progress alive until it completes.
+  /// </summary>
+  WriteRequest m_writeInFlight;
 
   std::atomic_size_t m_pingRequests{0};
   CloseCode m_closeCodeRequest{CloseCode::Normal};
@@ -50,12 +70,9 @@ class BaseWebSocketResource : public IWebSocketResource {
   /// Add the message to a write queue for eventual sending.
   /// </summary>
   /// <param name="message">
-  /// Payload to send to the remote endpoint.
-  /// </param>
-  /// <param name="binary">
-  /// Indicates whether the payload should be treated as binary data, or text.
+  /// Payload to send to the remote endpoint. Strings are sent as text, bytes as binary data.
   /// </param>
-  void EnqueueWrite(const std::string &message, bool binary);
+  void EnqueueWrite(WriteRequest &&message);
 
   /// <summary>
   /// Dequeues a message from <c>m_writeRequests</c> and sends it
@@ -86,9 +103,15 @@ class BaseWebSocketResource : public IWebSocketResource {
   void PerformClose();
 
   /// <summary>
-  /// Synchronizes the context thread and allows the io_context to stop
-  /// dispatching tasks.
+  /// Waits until every asynchronous operation posted by this instance has
+  /// completed.
   /// </summary>
+  /// <remarks>
+  /// Called from a handler running on <c>m_context</c>, the pending handlers are
+  /// queued behind the caller and cannot complete while it waits. In that case this
+  /// returns immediately, and the handlers run once the caller returns, each keeping
+  /// this instance alive.
+  /// </remarks>
   void Stop();
 
   boost::beast::websocket::close_code ToBeastCloseCode(IWebSocketResource::CloseCode closeCode);
@@ -112,6 +135,11 @@ class BaseWebSocketResource : public IWebSocketResource {
 #pragma endregion Async handlers
 
  protected:
+  /// <summary>
+  /// Keeps the worker threads running <see cref="m_context" /> alive.
+  /// </summary>
+  std::shared_ptr<IoContextPool> m_pool;
+
   /// <summary>
   /// See
   /// https://www.boost.org/doc/libs/1_68_0/doc/html/boost_asio/reference/io_context.html.
@@ -120,12 +148,11 @@ class BaseWebSocketResource : public IWebSocketResource {
   /// or arbitrary lambdas using <c>boost::asio::post</c>.
   /// </summary>
   /// <remarks>
-  /// Tasks will be run in the thread that calls this object's <c>run</c>
-  /// method.
+  /// Owned by <see cref="m_pool" /> and shared with other resources.
+  /// Tasks run on the pool worker thread bound to this context.
   /// </remarks>
-  boost::asio::io_context m_context;
+  boost::asio::io_context &m_context;
 
-  std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> m_workGuard;
   std::unique_ptr<Stream> m_stream;
   std::function<void(Error &&)> m_errorHandler;
 
@@ -148,6 +175,16 @@ class BaseWebSocketResource : public IWebSocketResource {
 
   virtual std::shared_ptr<BaseWebSocketResource<SocketLayer, Stream>> SharedFromThis() = 0;
 
+  /// <summary>
+  /// Wraps a completion handler so that it is accounted for by <c>Stop</c>.
+  /// </summary>
+  /// <remarks>
+  /// Exceptions thrown by the handler are reported to the error handler of this
+  /// instance instead of stopping the context shared with other resources.
+  /// </remarks>
+  template <typename Handler>
+  auto TrackOperation(Handler &&handler);
+
  public:
   ~BaseWebSocketResource() noexcept override;
 
@@ -173,6 +210,16 @@ class BaseWebSocketResource : public IWebSocketResource {
   /// </summary>
   void SendBinary(std::string &&base64String) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SendBinary" />
+  /// </summary>
+  void SendBinary(std::vector<std::uint8_t> &&message) noexcept override;
+
+  /// <summary>
+  /// <see cref="IWebSocketResource::SendBinary" />
+  /// </summary>
+  void SendBinary(SharedBytes &&message) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::Close" />
   /// </summary>
@@ -200,6 +247,11 @@ class BaseWebSocketResource : public IWebSocketResource {
   /// </summary>
   void SetOnMessage(std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SetOnBinaryMessage" />
+  /// </summary>
+  void SetOnBinaryMessage(std::function<void(std::vector<std::uint8_t> &&)> &&handler) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnClose" />
   /// </summary>
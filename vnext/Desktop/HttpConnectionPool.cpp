@@ -0,0 +1,592 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "HttpConnectionPool.h"
+
+#include <RuntimeOptions.h>
+#include <boost/asio/post.hpp>
+#include <boost/beast/core/bind_handler.hpp>
+#include "IoContextPool.h"
+
+// Standard Library
+#include <thread>
+
+// OpenSSL
+#include <openssl/ssl.h>
+
+using namespace boost::asio;
+using namespace boost::beast;
+
+using boost::asio::ip::tcp;
+using boost::system::error_code;
+
+using std::make_shared;
+using std::shared_ptr;
+using std::size_t;
+using std::string;
+
+namespace Microsoft::React::Beast {
+
+namespace {
+
+#if !ENABLE_BEAST
+// IoContextPool is only built with EnableBeast, while this client is always built.
+struct DedicatedContext {
+  io_context Context{1};
+  executor_work_guard<io_context::executor_type> WorkGuard{Context.get_executor()};
+  std::thread Thread{[this]() {
+    for (;;) {
+      try {
+        Context.run();
+        break;
+      } catch (...) {
+      }
+    }
+  }};
+
+  ~DedicatedContext() noexcept {
+    WorkGuard.reset();
+    Thread.join();
+  }
+};
+#endif // !ENABLE_BEAST
+
+/// <summary>
+/// Picks the context for a new connection or timer.
+/// The result keeps the thread running that context alive.
+/// </summary>
+shared_ptr<io_context> AcquireContext() {
+#if ENABLE_BEAST
+  auto pool = IoContextPool::Shared();
+  auto &context = pool->GetContext();
+
+  return shared_ptr<io_context>{std::move(pool), &context};
+#else
+  static std::mutex s_mutex;
+  static std::weak_ptr<DedicatedContext> s_worker;
+
+  std::lock_guard<std::mutex> lock{s_mutex};
+  auto worker = s_worker.lock();
+  if (!worker) {
+    worker = shared_ptr<DedicatedContext>(new DedicatedContext(), [](DedicatedContext *worker) {
+      // The last reference may be dropped by a handler, and the worker cannot join itself.
+      if (worker->Thread.get_id() == std::this_thread::get_id())
+        std::thread([worker]() { delete worker; }).detach();
+      else
+        delete worker;
+    });
+    s_worker = worker;
+  }
+
+  return shared_ptr<io_context>{worker, &worker->Context};
+#endif // ENABLE_BEAST
+}
+
+} // namespace
+
+#pragma region HttpExchange
+
+void HttpExchange::Complete(error_code ec, ResponseType &&response) {
+  if (m_completed.exchange(true))
+    return;
+
+  if (m_timer) {
+    // The timer belongs to its worker thread.
+    post(m_timer->get_executor(), [self = shared_from_this()]() { self->m_timer->cancel(); });
+  }
+
+  std::function<void(error_code, ResponseType &&)> onComplete;
+  {
+    std::lock_guard<std::mutex> lock{m_handlersMutex};
+    onComplete = std::move(OnComplete);
+
+    // Drop captured state as soon as possible.
+    OnComplete = nullptr;
+    OnSent = nullptr;
+  }
+
+  if (onComplete)
+    onComplete(ec, std::move(response));
+}
+
+void HttpExchange::Cancel(error_code ec) {
+  Complete(ec, {});
+
+  shared_ptr<HttpConnection> connection;
+  {
+    std::lock_guard<std::mutex> lock{m_connectionMutex};
+    connection = m_connection.lock();
+  }
+
+  if (connection)
+    post(*connection->m_context, [connection, ec]() { connection->Close(ec); });
+}
+
+void HttpExchange::NotifySent() {
+  std::function<void()> onSent;
+  {
+    // Copied, so that the handler runs without the lock and may abort this exchange.
+    std::lock_guard<std::mutex> lock{m_handlersMutex};
+    if (!m_completed)
+      onSent = OnSent;
+  }
+
+  if (onSent)
+    onSent();
+}
+
+bool HttpExchange::IsIdempotent() const noexcept {
+  switch (Request.method()) {
+    case http::verb::get:
+    case http::verb::head:
+    case http::verb::options:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool HttpExchange::IsPipelinable() const noexcept {
+  return IsIdempotent() && Request.keep_alive();
+}
+
+void HttpExchange::Abort() noexcept {
+  Cancel(boost::asio::error::operation_aborted);
+}
+
+bool HttpExchange::IsCompleted() const noexcept {
+  return m_completed;
+}
+
+#pragma endregion HttpExchange
+
+#pragma region HttpConnection
+
+HttpConnection::HttpConnection(HttpConnectionPool &pool, string host, string port, bool secure)
+    : m_pool{pool},
+      m_context{AcquireContext()},
+      m_resolver{*m_context},
+      m_idleTimer{*m_context},
+      m_host{std::move(host)},
+      m_port{std::move(port)} {
+  if (secure)
+    m_secureStream = std::make_unique<ssl_stream<tcp_stream>>(*m_context, pool.m_sslContext);
+  else
+    m_plainStream = std::make_unique<tcp_stream>(*m_context);
+}
+
+template <typename Func>
+void HttpConnection::WithStream(Func &&func) {
+  if (m_secureStream)
+    func(*m_secureStream);
+  else
+    func(*m_plainStream);
+}
+
+void HttpConnection::Enqueue(shared_ptr<HttpExchange> exchange) {
+  post(*m_context, [self = shared_from_this(), exchange = std::move(exchange)]() mutable {
+    if (self->m_closed) {
+      // Removed from the pool after this exchange was assigned to it.
+      self->m_pool.Schedule(std::move(exchange));
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{exchange->m_connectionMutex};
+      exchange->m_connection = self;
+    }
+
+    if (exchange->IsCompleted()) {
+      self->Release(exchange);
+      return;
+    }
+
+    self->m_idleTimer.cancel();
+    self->m_writeQueue.push_back(std::move(exchange));
+
+    if (self->m_connected)
+      self->PerformWrite();
+    else if (!self->m_connecting)
+      self->Connect();
+  });
+}
+
+void HttpConnection::Connect() {
+  m_connecting = true;
+  ++m_pool.m_connectionsOpened;
+
+  m_resolver.async_resolve(m_host, m_port, bind_front_handler(&HttpConnection::OnResolve, shared_from_this()));
+}
+
+void HttpConnection::OnResolve(error_code ec, tcp::resolver::results_type results) {
+  if (ec)
+    return Close(ec);
+
+  WithStream([this, &results](auto &stream) {
+    get_lowest_layer(stream).async_connect(
+        results, bind_front_handler(&HttpConnection::OnConnect, shared_from_this()));
+  });
+}
+
+void HttpConnection::OnConnect(error_code ec, tcp::endpoint /*endpoint*/) {
+  if (ec)
+    return Close(ec);
+
+  if (m_secureStream) {
+    auto handle = m_secureStream->native_handle();
+
+    // Server Name Indication.
+    SSL_set_tlsext_host_name(handle, m_host.c_str());
+
+    // Offer the session of a previous connection to this host, to skip the full handshake.
+    if (auto session = m_pool.GetTlsSession(m_host, m_port))
+      SSL_set_session(handle, session.get());
+
+    m_secureStream->async_handshake(
+        ssl::stream_base::client, bind_front_handler(&HttpConnection::OnSslHandshake, shared_from_this()));
+  } else {
+    m_connecting = false;
+    m_connected = true;
+    PerformWrite();
+  }
+}
+
+void HttpConnection::OnSslHandshake(error_code ec) {
+  if (ec)
+    return Close(ec);
+
+  if (SSL_session_reused(m_secureStream->native_handle()))
+    ++m_pool.m_tlsSessionsResumed;
+
+  m_connecting = false;
+  m_connected = true;
+  PerformWrite();
+}
+
+void HttpConnection::PerformWrite() {
+  // Skip exchanges that timed out or were aborted while queued.
+  while (!m_writeQueue.empty() && m_writeQueue.front()->IsCompleted()) {
+    auto exchange = std::move(m_writeQueue.front());
+    m_writeQueue.pop_front();
+    Release(exchange);
+  }
+
+  if (m_writing || m_closed || m_writeQueue.empty())
+    return;
+
+  m_writing = true;
+  auto exchange = std::move(m_writeQueue.front());
+  m_writeQueue.pop_front();
+
+  ++m_pool.m_requestsSent;
+  if (m_requestsWritten++ > 0)
+    ++m_pool.m_requestsReused;
+
+  // Responses come back in request order, so the exchange awaits its response as soon as it is written.
+  m_inFlight.push_back(exchange);
+
+  WithStream([this, &exchange](auto &stream) {
+    http::async_write(
+        stream, exchange->Request, bind_front_handler(&HttpConnection::OnWrite, shared_from_this(), exchange));
+  });
+
+  if (!m_reading)
+    PerformRead();
+}
+
+void HttpConnection::OnWrite(shared_ptr<HttpExchange> exchange, error_code ec, size_t /*size*/) {
+  m_writing = false;
+
+  if (ec)
+    return Close(ec);
+
+  exchange->NotifySent();
+
+  // Pipeline the next request, if any.
+  PerformWrite();
+}
+
+void HttpConnection::PerformRead() {
+  if (m_reading || m_closed || m_inFlight.empty())
+    return;
+
+  m_reading = true;
+  m_parser.emplace();
+  m_parser->body_limit((std::numeric_limits<std::uint64_t>::max)());
+
+  // Responses to HEAD carry headers for a body that is never sent.
+  if (http::verb::head == m_inFlight.front()->Request.method())
+    m_parser->skip(true);
+
+  WithStream([this](auto &stream) {
+    http::async_read(stream, m_buffer, *m_parser, bind_front_handler(&HttpConnection::OnRead, shared_from_this()));
+  });
+}
+
+void HttpConnection::OnRead(error_code ec, size_t /*size*/) {
+  m_reading = false;
+
+  if (ec)
+    return Close(ec);
+
+  auto exchange = std::move(m_inFlight.front());
+  m_inFlight.pop_front();
+  ++m_responsesRead;
+
+  auto response = m_parser->release();
+  bool keepAlive = response.keep_alive();
+
+  // Session tickets may arrive after the handshake, so wait for the first response before keeping the session.
+  if (m_secureStream && m_responsesRead == 1) {
+    if (auto session = SSL_get1_session(m_secureStream->native_handle()))
+      m_pool.SetTlsSession(m_host, m_port, shared_ptr<SSL_SESSION>(session, SSL_SESSION_free));
+  }
+
+  // Release first, so a request issued from the completion handler can reuse this connection.
+  Release(exchange);
+  exchange->Complete({}, std::move(response));
+
+  if (!keepAlive)
+    return Close(http::error::end_of_stream);
+
+  PerformRead();
+}
+
+void HttpConnection::Close(error_code ec) {
+  if (m_closed)
+    return;
+
+  m_closed = true;
+  m_pool.Remove(*this, false /*onlyIfIdle*/);
+
+  m_idleTimer.cancel();
+  m_resolver.cancel();
+  WithStream([](auto &stream) { get_lowest_layer(stream).close(); });
+
+  std::deque<shared_ptr<HttpExchange>> pending;
+  pending.swap(m_inFlight);
+  pending.insert(pending.end(), m_writeQueue.begin(), m_writeQueue.end());
+  m_writeQueue.clear();
+
+  bool isHead = true;
+  for (auto &exchange : pending) {
+    if (exchange->IsCompleted())
+      continue;
+
+    {
+      std::lock_guard<std::mutex> lock{exchange->m_connectionMutex};
+      exchange->m_connection.reset();
+    }
+
+    // The first exchange only failed on its own account if this connection never worked.
+    // Anything behind it was caught up in that failure, and can be sent again if that is safe.
+    bool retry = exchange->IsIdempotent() && !exchange->m_retried && (!isHead || m_responsesRead > 0);
+    isHead = false;
+
+    if (retry) {
+      exchange->m_retried = true;
+      m_pool.Schedule(std::move(exchange));
+    } else {
+      exchange->Complete(ec, {});
+    }
+  }
+}
+
+void HttpConnection::Release(const shared_ptr<HttpExchange> &exchange) {
+  if (m_pool.OnExchangeReleased(*this, exchange) && !m_closed)
+    StartIdleTimer();
+}
+
+void HttpConnection::StartIdleTimer() {
+  m_idleTimer.expires_after(m_pool.GetOptions().IdleTimeout);
+  m_idleTimer.async_wait([weakSelf = weak_from_this()](error_code ec) {
+    if (ec)
+      return;
+
+    auto self = weakSelf.lock();
+    if (self && self->m_pool.Remove(*self, true /*onlyIfIdle*/))
+      self->Close(boost::asio::error::operation_aborted);
+  });
+}
+
+#pragma endregion HttpConnection
+
+#pragma region HttpConnectionPool
+
+HttpConnectionPool::HttpConnectionPool(Options options)
+    : m_options{std::move(options)}, m_sslContext{ssl::context::sslv23_client} {
+  m_sslContext.set_options(ssl::context::default_workarounds | ssl::context::no_sslv2 | ssl::context::no_sslv3);
+  SSL_CTX_set_session_cache_mode(m_sslContext.native_handle(), SSL_SESS_CACHE_CLIENT);
+}
+
+/*static*/ HttpConnectionPool &HttpConnectionPool::Shared() {
+  static HttpConnectionPool *pool = []() {
+    Options options;
+    if (auto maxConnections = GetRuntimeOptionInt("Http.MaxConnectionsPerHost"); maxConnections > 0)
+      options.MaxConnectionsPerHost = static_cast<size_t>(maxConnections);
+    if (auto pipelineDepth = GetRuntimeOptionInt("Http.PipelineDepth"); pipelineDepth > 0)
+      options.PipelineDepth = static_cast<size_t>(pipelineDepth);
+
+    return new HttpConnectionPool(std::move(options));
+  }();
+
+  return *pool;
+}
+
+/*static*/ string HttpConnectionPool::HostKey(const string &host, const string &port, bool secure) {
+  return (secure ? "https://" : "http://") + host + ":" + port;
+}
+
+void HttpConnectionPool::Submit(shared_ptr<HttpExchange> exchange) {
+  if (exchange->Timeout.count() > 0) {
+    exchange->m_timerContext = AcquireContext();
+    exchange->m_timer = std::make_unique<steady_timer>(*exchange->m_timerContext, exchange->Timeout);
+    exchange->m_timer->async_wait([weakExchange = std::weak_ptr<HttpExchange>{exchange}](error_code ec) {
+      if (ec)
+        return;
+
+      if (auto exchange = weakExchange.lock())
+        exchange->Cancel(boost::beast::error::timeout);
+    });
+  }
+
+  Schedule(std::move(exchange));
+}
+
+void HttpConnectionPool::Schedule(shared_ptr<HttpExchange> exchange) {
+  if (exchange->IsCompleted())
+    return;
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  auto &entry = m_hosts[HostKey(exchange->Host, exchange->Port, exchange->Secure)];
+  if (!TrySchedule(entry, exchange))
+    entry.Waiting.push_back(std::move(exchange));
+}
+
+bool HttpConnectionPool::TrySchedule(HostEntry &entry, const shared_ptr<HttpExchange> &exchange) {
+  shared_ptr<HttpConnection> connection;
+
+  // 1. Reuse an idle connection.
+  for (auto &candidate : entry.Connections) {
+    if (candidate->m_load == 0) {
+      connection = candidate;
+      break;
+    }
+  }
+
+  // 2. Open a new connection.
+  if (!connection && entry.Connections.size() < m_options.MaxConnectionsPerHost) {
+    connection = make_shared<HttpConnection>(*this, exchange->Host, exchange->Port, exchange->Secure);
+    entry.Connections.push_back(connection);
+  }
+
+  // 3. Pipeline behind idempotent requests only, so a failed connection never loses a request that can't be repeated.
+  if (!connection && exchange->IsPipelinable()) {
+    for (auto &candidate : entry.Connections) {
+      if (candidate->m_exclusiveLoad == 0 && candidate->m_load < m_options.PipelineDepth &&
+          (!connection || candidate->m_load < connection->m_load)) {
+        connection = candidate;
+      }
+    }
+  }
+
+  if (!connection)
+    return false;
+
+  ++connection->m_load;
+  if (!exchange->IsPipelinable())
+    ++connection->m_exclusiveLoad;
+
+  connection->Enqueue(exchange);
+
+  return true;
+}
+
+bool HttpConnectionPool::OnExchangeReleased(HttpConnection &connection, const shared_ptr<HttpExchange> &exchange) {
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  --connection.m_load;
+  if (!exchange->IsPipelinable())
+    --connection.m_exclusiveLoad;
+
+  auto entry = m_hosts.find(HostKey(connection.m_host, connection.m_port, connection.m_secureStream != nullptr));
+  if (entry != m_hosts.end()) {
+    auto &waiting = entry->second.Waiting;
+    while (!waiting.empty() && (waiting.front()->IsCompleted() || TrySchedule(entry->second, waiting.front())))
+      waiting.pop_front();
+  }
+
+  return connection.m_load == 0;
+}
+
+bool HttpConnectionPool::Remove(HttpConnection &connection, bool onlyIfIdle) {
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  if (onlyIfIdle && connection.m_load > 0)
+    return false;
+
+  auto entry = m_hosts.find(HostKey(connection.m_host, connection.m_port, connection.m_secureStream != nullptr));
+  if (entry == m_hosts.end())
+    return true;
+
+  auto &connections = entry->second.Connections;
+  connections.erase(
+      std::remove_if(
+          connections.begin(),
+          connections.end(),
+          [&connection](const shared_ptr<HttpConnection> &candidate) { return candidate.get() == &connection; }),
+      connections.end());
+
+  // There is room for a new connection now.
+  auto &waiting = entry->second.Waiting;
+  while (!waiting.empty() && (waiting.front()->IsCompleted() || TrySchedule(entry->second, waiting.front())))
+    waiting.pop_front();
+
+  return true;
+}
+
+void HttpConnectionPool::CloseIdleConnections() {
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  for (auto &entry : m_hosts) {
+    for (auto &connection : entry.second.Connections) {
+      if (connection->m_load > 0)
+        continue;
+
+      post(*connection->m_context, [connection]() {
+        if (connection->m_pool.Remove(*connection, true /*onlyIfIdle*/))
+          connection->Close(boost::asio::error::operation_aborted);
+      });
+    }
+  }
+}
+
+shared_ptr<SSL_SESSION> HttpConnectionPool::GetTlsSession(const string &host, const string &port) {
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  auto entry = m_hosts.find(HostKey(host, port, true));
+  if (entry == m_hosts.end())
+    return nullptr;
+
+  return entry->second.TlsSession;
+}
+
+void HttpConnectionPool::SetTlsSession(const string &host, const string &port, shared_ptr<SSL_SESSION> &&session) {
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  m_hosts[HostKey(host, port, true)].TlsSession = std::move(session);
+}
+
+HttpConnectionPool::Statistics HttpConnectionPool::GetStatistics() const noexcept {
+  return {m_connectionsOpened, m_requestsSent, m_requestsReused, m_tlsSessionsResumed};
+}
+
+const HttpConnectionPool::Options &HttpConnectionPool::GetOptions() const noexcept {
+  return m_options;
+}
+
+#pragma endregion HttpConnectionPool
+
+} // namespace Microsoft::React::Beast
@@ -0,0 +1,302 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl/context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/optional.hpp>
+
+// Standard Library
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// OpenSSL
+typedef struct ssl_session_st SSL_SESSION;
+
+namespace Microsoft::React::Beast {
+
+class HttpConnection;
+class HttpConnectionPool;
+
+/// <summary>
+/// Single request/response pair scheduled on an <see cref="HttpConnectionPool" />.
+/// </summary>
+/// <remarks>
+/// Completes exactly once, either with a response, an error, a timeout or an abort.
+/// Completion handlers run on a pool worker thread.
+/// </remarks>
+class HttpExchange : public std::enable_shared_from_this<HttpExchange> {
+  friend class HttpConnection;
+  friend class HttpConnectionPool;
+
+  std::atomic_bool m_completed{false};
+  bool m_retried{false};
+
+  /// <remarks>
+  /// Keeps the worker running the context of <c>m_timer</c> alive.
+  /// </remarks>
+  std::shared_ptr<boost::asio::io_context> m_timerContext;
+  std::unique_ptr<boost::asio::steady_timer> m_timer;
+
+  /// <remarks>
+  /// Connection currently carrying this exchange, if any.
+  /// </remarks>
+  std::weak_ptr<HttpConnection> m_connection;
+  std::mutex m_connectionMutex;
+
+  /// <remarks>
+  /// Guards <c>OnSent</c> and <c>OnComplete</c> once submitted. A timeout or an abort
+  /// completes the exchange on another thread than the connection writing it.
+  /// </remarks>
+  std::mutex m_handlersMutex;
+
+  void Complete(boost::system::error_code ec, boost::beast::http::response<boost::beast::http::string_body> &&response);
+
+  /// <summary>
+  /// Fails this exchange and closes the connection carrying it, since HTTP/1.1
+  /// offers no way to cancel an individual request.
+  /// </summary>
+  void Cancel(boost::system::error_code ec);
+
+  /// <summary>
+  /// Invokes <c>OnSent</c> unless the exchange has completed.
+  /// </summary>
+  void NotifySent();
+
+  bool IsIdempotent() const noexcept;
+
+  /// <summary>
+  /// Whether other requests may share the connection while this one is pending.
+  /// </summary>
+  bool IsPipelinable() const noexcept;
+
+ public:
+  using RequestType = boost::beast::http::request<boost::beast::http::string_body>;
+  using ResponseType = boost::beast::http::response<boost::beast::http::string_body>;
+
+  std::string Host;
+  std::string Port;
+  bool Secure{false};
+  RequestType Request;
+
+  /// <summary>
+  /// Maximum time until completion, including time spent waiting for a connection. Zero disables the timeout.
+  /// </summary>
+  std::chrono::milliseconds Timeout{0};
+
+  /// <summary>
+  /// Invoked once the request has been fully written to the wire.
+  /// </summary>
+  std::function<void()> OnSent;
+
+  std::function<void(boost::system::error_code, ResponseType &&)> OnComplete;
+
+  /// <summary>
+  /// Completes the exchange with <c>operation_aborted</c>.
+  /// </summary>
+  void Abort() noexcept;
+
+  bool IsCompleted() const noexcept;
+};
+
+/// <summary>
+/// Persistent HTTP/1.1 connection to a single host.
+/// Requests are written back to back (pipelined) and their responses are read in order.
+/// </summary>
+/// <remarks>
+/// All members are accessed from the worker thread running <c>m_context</c>,
+/// except for the load counters, which the pool updates under its own lock.
+/// </remarks>
+class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
+  friend class HttpConnectionPool;
+  friend class HttpExchange;
+
+  HttpConnectionPool &m_pool;
+
+  /// <remarks>
+  /// Also keeps the worker thread running the context alive.
+  /// </remarks>
+  std::shared_ptr<boost::asio::io_context> m_context;
+  boost::asio::ip::tcp::resolver m_resolver;
+  std::unique_ptr<boost::beast::tcp_stream> m_plainStream;
+  std::unique_ptr<boost::beast::ssl_stream<boost::beast::tcp_stream>> m_secureStream;
+  boost::asio::steady_timer m_idleTimer;
+
+  std::string m_host;
+  std::string m_port;
+
+  boost::beast::flat_buffer m_buffer;
+  boost::optional<boost::beast::http::response_parser<boost::beast::http::string_body>> m_parser;
+
+  std::deque<std::shared_ptr<HttpExchange>> m_writeQueue;
+  std::deque<std::shared_ptr<HttpExchange>> m_inFlight;
+
+  bool m_connecting{false};
+  bool m_connected{false};
+  bool m_writing{false};
+  bool m_reading{false};
+  bool m_closed{false};
+  std::size_t m_requestsWritten{0};
+  std::size_t m_responsesRead{0};
+
+  // Guarded by the pool lock.
+  std::size_t m_load{0};
+  std::size_t m_exclusiveLoad{0};
+
+  template <typename Func>
+  void WithStream(Func &&func);
+
+  void Enqueue(std::shared_ptr<HttpExchange> exchange);
+  void Connect();
+  void PerformWrite();
+  void PerformRead();
+
+  /// <summary>
+  /// Closes the socket. Pending exchanges are handed back to the pool when
+  /// they can safely be retried, and failed otherwise.
+  /// </summary>
+  void Close(boost::system::error_code ec);
+
+  void Release(const std::shared_ptr<HttpExchange> &exchange);
+  void StartIdleTimer();
+
+#pragma region Async handlers
+
+  void OnResolve(boost::system::error_code ec, boost::asio::ip::tcp::resolver::results_type results);
+  void OnConnect(boost::system::error_code ec, boost::asio::ip::tcp::endpoint endpoint);
+  void OnSslHandshake(boost::system::error_code ec);
+  void OnWrite(std::shared_ptr<HttpExchange> exchange, boost::system::error_code ec, std::size_t size);
+  void OnRead(boost::system::error_code ec, std::size_t size);
+
+#pragma endregion Async handlers
+
+ public:
+  HttpConnection(HttpConnectionPool &pool, std::string host, std::string port, bool secure);
+};
+
+/// <summary>
+/// Keeps persistent HTTP/1.1 connections per host and schedules requests on them.
+/// </summary>
+/// <remarks>
+/// Requests go to an idle connection first, then to a new connection while under
+/// <c>MaxConnectionsPerHost</c>. Once every connection is busy, idempotent keep-alive
+/// requests are pipelined on the least loaded connection, up to <c>PipelineDepth</c>.
+/// Anything else waits for a connection to become available.
+/// Connections run on <see cref="IoContextPool::Shared" /> when Beast is enabled,
+/// and on a single dedicated worker thread otherwise.
+/// </remarks>
+class HttpConnectionPool {
+  friend class HttpConnection;
+
+ public:
+  struct Options {
+    std::size_t MaxConnectionsPerHost{6};
+    std::size_t PipelineDepth{4};
+    std::chrono::milliseconds IdleTimeout{std::chrono::seconds{30}};
+  };
+
+  struct Statistics {
+    std::size_t ConnectionsOpened;
+    std::size_t RequestsSent;
+
+    /// <summary>
+    /// Requests sent over a connection that had already completed a previous response.
+    /// </summary>
+    std::size_t RequestsReused;
+
+    std::size_t TlsSessionsResumed;
+  };
+
+ private:
+  struct HostEntry {
+    std::vector<std::shared_ptr<HttpConnection>> Connections;
+    std::deque<std::shared_ptr<HttpExchange>> Waiting;
+    std::shared_ptr<SSL_SESSION> TlsSession;
+  };
+
+  Options m_options;
+  boost::asio::ssl::context m_sslContext;
+
+  std::mutex m_mutex;
+  std::map<std::string, HostEntry> m_hosts;
+
+  std::atomic_size_t m_connectionsOpened{0};
+  std::atomic_size_t m_requestsSent{0};
+  std::atomic_size_t m_requestsReused{0};
+  std::atomic_size_t m_tlsSessionsResumed{0};
+
+  static std::string HostKey(const std::string &host, const std::string &port, bool secure);
+
+  /// <summary>
+  /// Places the exchange on a connection, or in the waiting queue of its host.
+  /// </summary>
+  void Schedule(std::shared_ptr<HttpExchange> exchange);
+
+  /// <summary>
+  /// Picks or creates a connection for the exchange. Requires <c>m_mutex</c>.
+  /// </summary>
+  bool TrySchedule(HostEntry &entry, const std::shared_ptr<HttpExchange> &exchange);
+
+  /// <summary>
+  /// Called by a connection after an exchange it carried has completed.
+  /// Moves waiting exchanges onto that connection.
+  /// </summary>
+  /// <returns>
+  /// <c>true</c> if the connection has no pending exchanges left.
+  /// </returns>
+  bool OnExchangeReleased(HttpConnection &connection, const std::shared_ptr<HttpExchange> &exchange);
+
+  /// <summary>
+  /// Forgets a connection that can no longer carry requests.
+  /// </summary>
+  /// <returns>
+  /// <c>false</c> if the connection received new work and must stay open.
+  /// </returns>
+  bool Remove(HttpConnection &connection, bool onlyIfIdle);
+
+  std::shared_ptr<SSL_SESSION> GetTlsSession(const std::string &host, const std::string &port);
+  void SetTlsSession(const std::string &host, const std::string &port, std::shared_ptr<SSL_SESSION> &&session);
+
+ public:
+  HttpConnectionPool(Options options);
+
+  HttpConnectionPool(const HttpConnectionPool &) = delete;
+  HttpConnectionPool &operator=(const HttpConnectionPool &) = delete;
+
+  /// <summary>
+  /// Returns the process-wide pool.
+  /// </summary>
+  /// <remarks>
+  /// Configured by the <c>Http.MaxConnectionsPerHost</c> and <c>Http.PipelineDepth</c>
+  /// runtime options when first used. Never destroyed, like the connections it owns.
+  /// </remarks>
+  static HttpConnectionPool &Shared();
+
+  /// <summary>
+  /// Schedules the exchange. Its completion handler may run before this method returns.
+  /// </summary>
+  void Submit(std::shared_ptr<HttpExchange> exchange);
+
+  /// <summary>
+  /// Closes every connection that has no pending exchanges.
+  /// </summary>
+  void CloseIdleConnections();
+
+  Statistics GetStatistics() const noexcept;
+
+  const Options &GetOptions() const noexcept;
+};
+
+} // namespace Microsoft::React::Beast
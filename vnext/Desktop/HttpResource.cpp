@@ -6,24 +6,61 @@
 #include "HttpResource.h"
 
 #include <Utils.h>
-#include <boost/beast/core/buffers_to_string.hpp>
+#include <boost/archive/iterators/base64_from_binary.hpp>
+#include <boost/archive/iterators/binary_from_base64.hpp>
+#include <boost/archive/iterators/transform_width.hpp>
 #include <boost/beast/version.hpp>
 
-using namespace boost::asio::ip;
+using namespace boost::archive::iterators;
 using namespace boost::beast::http;
 
 using folly::dynamic;
+using std::make_shared;
 using std::make_unique;
+using std::shared_ptr;
 using std::string;
 using std::unique_ptr;
 
-using boostecr = boost::system::error_code const &;
+using Microsoft::React::Beast::HttpConnectionPool;
+using Microsoft::React::Beast::HttpExchange;
 
 namespace Microsoft::React {
 namespace Experimental {
+
+namespace {
+
+std::atomic<int64_t> s_lastRequestId{0};
+
+string DecodeBase64(const string &base64String) {
+  typedef transform_width<binary_from_base64<string::const_iterator>, 8, 6> decode_base64;
+
+  // A correctly formed base64 string should have from 0 to three '=' trailing
+  // characters. Skip those.
+  size_t padSize = std::count(base64String.begin(), base64String.end(), '=');
+  return string(decode_base64(base64String.begin()), decode_base64(base64String.end() - padSize));
+}
+
+string EncodeBase64(const string &binary) {
+  typedef base64_from_binary<transform_width<string::const_iterator, 6, 8>> encode_base64;
+
+  string result(encode_base64(binary.begin()), encode_base64(binary.end()));
+  result.append((4 - result.length() % 4) % 4, '=');
+
+  return result;
+}
+
+} // namespace
+
 #pragma region HttpResource members
 
-HttpResource::HttpResource() noexcept : m_resolver{m_context}, m_socket{m_context} {}
+HttpResource::HttpResource() noexcept : HttpResource(HttpConnectionPool::Shared()) {}
+
+HttpResource::HttpResource(HttpConnectionPool &pool) noexcept
+    : m_pool{pool}, m_handlers{make_shared<Handlers>()} {}
+
+HttpResource::~HttpResource() noexcept {
+  AbortRequest();
+}
 
 void HttpResource::SendRequest(
     const string &method,
@@ -38,21 +75,27 @@ void HttpResource::SendRequest(
   assert(responseType == "text" || responseType == "base64");
   assert(!useIncrementalUpdates);
 
-  // ISS:2306365 - Callback with the requestId
-
-  // Validate verb.
   unique_ptr<Url> url;
   try {
     url = make_unique<Url>(string{urlString});
   } catch (...) {
-    m_errorHandler("Malformed URL");
+    if (auto onError = m_handlers->Get(&Handlers::Error))
+      onError("Malformed URL");
+
     return;
   }
-  request<string_body> req;
+
+  auto exchange = make_shared<HttpExchange>();
+  exchange->Secure = url->scheme == "https";
+  exchange->Host = url->host;
+  exchange->Port = url->port.empty() ? (exchange->Secure ? "443" : "80") : url->port;
+  exchange->Timeout = std::chrono::milliseconds{timeout};
+
+  auto &req = exchange->Request;
   req.version(11 /*HTTP 1.1*/);
   req.method(string_to_verb(method));
   req.target(url->Target());
-  req.set(field::host, url->host); // ISS:2306365 - Determine/append port.
+  req.set(field::host, url->port.empty() ? url->host : url->host + ":" + url->port);
   req.set(field::user_agent, BOOST_BEAST_VERSION_STRING);
 
   for (const auto &header : headers) {
@@ -60,78 +103,78 @@ void HttpResource::SendRequest(
     req.set(header.first, header.second);
   }
 
-  if (!bodyData.empty()) {
-    if (!bodyData["string"].empty()) {
-    } else if (!bodyData["base64"].empty()) {
-    } else if (!bodyData["uri"].empty()) {
+  if (bodyData.isObject()) {
+    if (auto text = bodyData.get_ptr("string")) {
+      req.body() = text->asString();
+    } else if (auto base64 = bodyData.get_ptr("base64")) {
+      try {
+        req.body() = DecodeBase64(base64->asString());
+      } catch (const std::exception &) {
+        if (auto onError = m_handlers->Get(&Handlers::Error))
+          onError("Malformed base64 request body");
+
+        return;
+      }
+    } else if (bodyData.get_ptr("uri")) {
       assert(false); // Not implemented.
     } else {
       // Empty request
     }
   }
 
-  m_context.restart();
+  req.prepare_payload();
 
-  // Send/Receive request.
-  m_resolver.async_resolve(url->host, url->port, [this, &req](boostecr ec, tcp::resolver::results_type results) {
+  exchange->OnSent = [handlers = m_handlers]() {
+    if (auto onRequest = handlers->Get(&Handlers::Request))
+      onRequest();
+  };
+  exchange->OnComplete = [handlers = m_handlers, base64 = responseType == "base64"](
+                             boost::system::error_code ec, HttpExchange::ResponseType &&response) {
     if (ec) {
-      if (m_errorHandler)
-        m_errorHandler(ec.message());
-    } else {
-      boost::asio::async_connect(
-          m_socket, results.begin(), results.end(), [this, &req](boostecr ec, const basic_resolver_iterator<tcp> &) {
-            if (ec) {
-              if (m_errorHandler)
-                m_errorHandler(ec.message());
-            } else {
-              async_write(m_socket, move(req), [this](boostecr ec, size_t size) {
-                if (ec) {
-                  if (m_errorHandler)
-                    m_errorHandler(ec.message());
-                } else {
-                  if (m_requestHandler)
-                    m_requestHandler();
-
-                  async_read(m_socket, m_buffer, m_response, [this](boostecr ec, size_t size) {
-                    if (ec) {
-                      if (m_errorHandler)
-                        m_errorHandler(ec.message());
-                    } else {
-                      if (m_responseHandler)
-                        m_responseHandler(boost::beast::buffers_to_string(m_buffer.data()));
-
-                      boost::system::error_code bec;
-                      m_socket.shutdown(tcp::socket::shutdown_both, bec);
-                      if (bec && boost::system::errc::not_connected != bec) // not_connected may happen. Not
-                      // an actual error.
-                      {
-                        if (m_errorHandler)
-                          m_errorHandler(bec.message());
-
-                        // ISS:2306365 - Callback?
-                      }
-                    }
-                  }); // async_read
-                }
-              }); // async_write
-            }
-          }); // async_connect
+      // Aborted requests are not errors.
+      if (boost::asio::error::operation_aborted != ec) {
+        if (auto onError = handlers->Get(&Handlers::Error))
+          onError(ec.message());
+      }
+
+      return;
     }
-  }); // async_resolve
 
-  m_context.run();
+    if (auto onResponse = handlers->Get(&Handlers::Response))
+      onResponse(base64 ? EncodeBase64(response.body()) : response.body());
+  };
+
+  {
+    std::lock_guard<std::mutex> lock{m_exchangesMutex};
+    m_exchanges.erase(
+        std::remove_if(
+            m_exchanges.begin(),
+            m_exchanges.end(),
+            [](const std::weak_ptr<HttpExchange> &weak) {
+              auto strong = weak.lock();
+              return !strong || strong->IsCompleted();
+            }),
+        m_exchanges.end());
+    m_exchanges.push_back(exchange);
+  }
+
+  auto requestId = ++s_lastRequestId;
+  m_pool.Submit(std::move(exchange));
+
+  if (callback)
+    callback(requestId);
 }
 
 void HttpResource::AbortRequest() noexcept {
-  m_context.stop();
-
-  if (m_socket.is_open()) {
-    boost::system::error_code bec;
-    m_socket.shutdown(tcp::socket::shutdown_both, bec);
-    if (bec && boost::system::errc::not_connected != bec) {
-      if (m_errorHandler)
-        m_errorHandler(bec.message());
-    }
+  std::vector<std::weak_ptr<HttpExchange>> exchanges;
+  {
+    std::lock_guard<std::mutex> lock{m_exchangesMutex};
+    exchanges.swap(m_exchanges);
+  }
+
+  for (auto &weak : exchanges) {
+    if (auto exchange = weak.lock())
+      exchange->Abort();
   }
 }
 
@@ -142,15 +185,15 @@ void HttpResource::ClearCookies() noexcept {
 #pragma region Handler setters
 
 void HttpResource::SetOnRequest(std::function<void()> &&handler) noexcept {
-  m_requestHandler = move(handler);
+  m_handlers->Set(&Handlers::Request, std::move(handler));
 }
 
 void HttpResource::SetOnResponse(std::function<void(const std::string &)> &&handler) noexcept {
-  m_responseHandler = move(handler);
+  m_handlers->Set(&Handlers::Response, std::move(handler));
 }
 
 void HttpResource::SetOnError(std::function<void(const std::string &)> &&handler) noexcept {
-  m_errorHandler = move(handler);
+  m_handlers->Set(&Handlers::Error, std::move(handler));
 }
 
 #pragma endregion Handler setters
@@ -4,30 +4,61 @@
 #pragma once
 
 #include <IHttpResource.h>
+#include "HttpConnectionPool.h"
 
-#include <boost/asio/connect.hpp>
-#include <boost/asio/ip/tcp.hpp>
-#include <boost/beast/core/flat_buffer.hpp>
-#include <boost/beast/http.hpp>
+// Standard Library
+#include <mutex>
+#include <vector>
 
 namespace Microsoft::React::Experimental {
 
+/// <summary>
+/// Boost.Beast HTTP/1.1 client. Requests are scheduled on a shared
+/// <see cref="Beast::HttpConnectionPool" />, which keeps connections alive across
+/// requests and resource instances.
+/// </summary>
 class HttpResource : public IHttpResource {
-  boost::asio::io_context m_context;
-  boost::asio::ip::tcp::resolver m_resolver;
-  boost::asio::ip::tcp::socket m_socket;
+  /// <remarks>
+  /// Set from the caller's thread and invoked from pool worker threads, so every
+  /// access goes through <c>Mutex</c>.
+  /// </remarks>
+  struct Handlers {
+    std::mutex Mutex;
+    std::function<void()> Request;
+    std::function<void(const std::string &)> Response;
+    std::function<void(const std::string &)> Error;
 
-  // TODO: Remove?
-  boost::beast::flat_buffer m_buffer;
-  boost::beast::http::request<boost::beast::http::empty_body> m_request;
-  boost::beast::http::response<boost::beast::http::string_body> m_response;
+    /// <summary>
+    /// Copies a handler, so that it can run without the lock.
+    /// </summary>
+    template <typename Handler>
+    Handler Get(Handler Handlers::*handler) {
+      std::lock_guard<std::mutex> lock{Mutex};
+      return this->*handler;
+    }
 
-  std::function<void()> m_requestHandler;
-  std::function<void(const std::string &)> m_responseHandler;
-  std::function<void(const std::string &)> m_errorHandler;
+    template <typename Handler>
+    void Set(Handler Handlers::*handler, Handler &&value) {
+      std::lock_guard<std::mutex> lock{Mutex};
+      this->*handler = std::move(value);
+    }
+  };
+
+  Beast::HttpConnectionPool &m_pool;
+
+  /// <remarks>
+  /// Shared with outstanding exchanges, which may complete after this instance is gone.
+  /// </remarks>
+  std::shared_ptr<Handlers> m_handlers;
+
+  std::mutex m_exchangesMutex;
+  std::vector<std::weak_ptr<Beast::HttpExchange>> m_exchanges;
 
  public:
   HttpResource() noexcept;
+  HttpResource(Beast::HttpConnectionPool &pool) noexcept;
+
+  ~HttpResource() noexcept override;
 
 #pragma region IHttpResource members
 
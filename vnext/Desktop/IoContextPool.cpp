@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "IoContextPool.h"
+
+#include <RuntimeOptions.h>
+
+// Standard Library
+#include <mutex>
+
+using boost::asio::io_context;
+using std::shared_ptr;
+
+namespace Microsoft::React::Beast {
+
+namespace {
+
+thread_local bool s_isWorkerThread{false};
+
+} // namespace
+
+IoContextPool::IoContextPool(size_t threadCount) {
+  if (threadCount == 0)
+    threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+  m_workers.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i) {
+    auto worker = std::make_unique<Worker>();
+    worker->Thread = std::thread([context = &worker->Context]() {
+      s_isWorkerThread = true;
+
+      // The context is shared by many resources, so a throwing handler must not stop it for the others.
+      // run() resumes with the next handler, and returns normally once the work guard is reset.
+      for (;;) {
+        try {
+          context->run();
+          break;
+        } catch (...) {
+        }
+      }
+    });
+
+    m_workers.push_back(std::move(worker));
+  }
+}
+
+IoContextPool::~IoContextPool() noexcept {
+  // Let each context drain its remaining handlers, then wait for the threads to exit.
+  for (auto &worker : m_workers)
+    worker->WorkGuard.reset();
+
+  for (auto &worker : m_workers) {
+    if (worker->Thread.joinable())
+      worker->Thread.join();
+  }
+}
+
+/*static*/ shared_ptr<IoContextPool> IoContextPool::Shared() {
+  static std::mutex s_mutex;
+  static std::weak_ptr<IoContextPool> s_pool;
+
+  std::lock_guard<std::mutex> lock{s_mutex};
+  auto pool = s_pool.lock();
+  if (!pool) {
+    pool = shared_ptr<IoContextPool>(
+        new IoContextPool(static_cast<size_t>(std::max(0, GetRuntimeOptionInt("WebSocket.IoThreadCount")))),
+        [](IoContextPool *pool) {
+          // The last reference may be dropped by a handler, and a worker cannot join itself.
+          if (IsWorkerThread())
+            std::thread([pool]() { delete pool; }).detach();
+          else
+            delete pool;
+        });
+    s_pool = pool;
+  }
+
+  return pool;
+}
+
+/*static*/ bool IoContextPool::IsWorkerThread() noexcept {
+  return s_isWorkerThread;
+}
+
+io_context &IoContextPool::GetContext() noexcept {
+  return m_workers[m_next++ % m_workers.size()]->Context;
+}
+
+size_t IoContextPool::Size() const noexcept {
+  return m_workers.size();
+}
+
+} // namespace Microsoft::React::Beast
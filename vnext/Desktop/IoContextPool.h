@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+// Standard Library
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Microsoft::React::Beast {
+
+/// <summary>
+/// Fixed set of <c>io_context</c> instances, each run by a single worker thread.
+/// Network resources are assigned a context in round-robin order, so any number of
+/// sockets is multiplexed on the same small set of threads.
+/// </summary>
+class IoContextPool {
+  struct Worker {
+    boost::asio::io_context Context{1};
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> WorkGuard{Context.get_executor()};
+    std::thread Thread;
+  };
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::atomic_size_t m_next{0};
+
+ public:
+  /// <param name="threadCount">
+  /// Number of worker threads. If 0, uses the number of hardware threads.
+  /// </param>
+  IoContextPool(std::size_t threadCount);
+
+  IoContextPool(const IoContextPool &) = delete;
+  IoContextPool &operator=(const IoContextPool &) = delete;
+
+  ~IoContextPool() noexcept;
+
+  /// <summary>
+  /// Returns the process-wide pool, creating it if no one holds it anymore.
+  /// </summary>
+  /// <remarks>
+  /// Sized by the <c>WebSocket.IoThreadCount</c> runtime option when created.
+  /// Resources keep a reference for as long as they use one of its contexts, so the
+  /// threads are joined once the last resource goes away instead of during static destruction.
+  /// </remarks>
+  static std::shared_ptr<IoContextPool> Shared();
+
+  /// <returns>
+  /// <c>true</c> if the calling thread runs one of the contexts of any pool.
+  /// </returns>
+  static bool IsWorkerThread() noexcept;
+
+  /// <summary>
+  /// Picks the context the next network resource should be bound to.
+  /// </summary>
+  boost::asio::io_context &GetContext() noexcept;
+
+  std::size_t Size() const noexcept;
+};
+
+} // namespace Microsoft::React::Beast
@@ -21,49 +21,11 @@ using namespace folly;
 namespace facebook {
 namespace react {
 
-bool operator<(const Timer &leftTimer, const Timer &rightTimer) {
-  return rightTimer.DueTime < leftTimer.DueTime;
-}
-
-bool operator==(const Timer &leftTimer, const uint64_t id) {
-  return id == leftTimer.Id;
-}
-
-void TimerQueue::Push(Timer timer) {
-  m_timerVector.push_back(timer);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
-}
-
-const Timer &TimerQueue::Front() const {
-  return m_timerVector.front();
-}
-
-bool TimerQueue::Remove(uint64_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end()) {
-    m_timerVector.erase(found);
-  } else {
-    return false;
-  }
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-  return true;
-}
+// Timers due within this long after the first one share its wakeup of the kernel timer.
+constexpr TimeSpan TimerSlack{10};
 
-bool TimerQueue::IsEmpty() const {
-  return m_timerVector.empty();
-}
+Timing::Timing(const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread)
+    : m_timerQueue(TimerSlack), m_nativeThread(nativeThread) {}
 
 /*static*/ void Timing::ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE, PVOID Parameter, PTP_TIMER) noexcept {
   static_cast<Timing *>(Parameter)->OnTimerRaised();
@@ -89,22 +51,7 @@ void Timing::OnTimerRaised() noexcept {
         auto now = std::chrono::system_clock::now();
         auto now_ms = std::chrono::time_point_cast<std::chrono::milliseconds>(now);
 
-        // Fire timers which will be expired in 10ms
-        while (!strongThis->m_timerQueue.IsEmpty() && now_ms > strongThis->m_timerQueue.Front().DueTime - 10ms) {
-          // Pop first timer from the queue and add it to list of timers ready
-          // to fire
-          auto next = strongThis->m_timerQueue.Front();
-          strongThis->m_timerQueue.Pop();
-
-          // VSO:1916882 potential overflow
-          readyTimers.push_back(next.Id);
-
-          // If timer is repeating push it back onto the queue for the next
-          // repetition 'next.Period' being greater than 10ms is intended to
-          // prevent infinite loops
-          if (next.Repeat)
-            strongThis->m_timerQueue.Push(Timer{next.Id, now_ms + next.Period, next.Period, true});
-        }
+        strongThis->m_timerQueue.PopDue(now_ms, [&readyTimers](const auto &timer) { readyTimers.push_back(timer.Id); });
 
         if (!readyTimers.empty()) {
           if (auto instance = strongThis->m_wkInstance.lock()) {
@@ -115,7 +62,7 @@ void Timing::OnTimerRaised() noexcept {
         }
 
         if (!strongThis->m_timerQueue.IsEmpty()) {
-          strongThis->SetKernelTimer(strongThis->m_timerQueue.Front().DueTime);
+          strongThis->SetKernelTimer(strongThis->m_timerQueue.WakeupTime());
         } else {
           strongThis->m_dueTime = DateTime::max();
         }
@@ -154,7 +101,7 @@ void Timing::createTimer(
 
   // Make sure duration is always larger than 16ms to avoid unnecessary wakeups.
   period = TimeSpan{duration < 16 ? 16 : (int64_t)duration};
-  m_timerQueue.Push(Timer{id, initialDueTime, period, repeat});
+  m_timerQueue.Push(static_cast<int64_t>(id), initialDueTime, period, repeat);
 
   TimersChanged();
 }
@@ -168,21 +115,21 @@ void Timing::TimersChanged() noexcept {
     }
     return;
   }
-  // If front timer has the same target time as ThreadpoolTimer,
+  // If front timer has the same wakeup time as ThreadpoolTimer,
   // we will keep ThreadpoolTimer unchanged.
-  if (m_timerQueue.Front().DueTime == m_dueTime) {
+  if (m_timerQueue.WakeupTime() == m_dueTime) {
     // do nothing
   }
-  // If current front timer's due time is earlier than current
-  // ThreadpoolTimer's, we need to reset the ThreadpoolTimer to current front
-  // timer
-  else if (m_timerQueue.Front().DueTime < m_dueTime) {
-    SetKernelTimer(m_timerQueue.Front().DueTime);
+  // If current front timer's wakeup time is earlier than current
+  // ThreadpoolTimer's, we need to reset the ThreadpoolTimer to the wakeup time of
+  // the front timer
+  else if (m_timerQueue.WakeupTime() < m_dueTime) {
+    SetKernelTimer(m_timerQueue.WakeupTime());
   }
-  // If current front timer's due time is later than current kernel timer's,
+  // If current front timer's wakeup time is later than current kernel timer's,
   // we will reset kernel timer only when it is about to fire
   else if (KernelTimerIsAboutToFire()) {
-    SetKernelTimer(m_timerQueue.Front().DueTime);
+    SetKernelTimer(m_timerQueue.WakeupTime());
   }
 }
 
@@ -229,7 +176,7 @@ void Timing::InitializeKernelTimer() noexcept {
 void Timing::deleteTimer(uint64_t id) noexcept {
   if (m_timerQueue.IsEmpty())
     return;
-  if (m_timerQueue.Remove(id)) {
+  if (m_timerQueue.Remove(static_cast<int64_t>(id))) {
     TimersChanged();
   }
 }
@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/Animated/AnimatedEventPath.h>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (AnimatedEventPathTests) {
+  TEST_METHOD(ReadsScrollEventFields) {
+    ScrollEventData event;
+    event.ContentOffsetX = 12;
+    event.ContentOffsetY = 340;
+    event.ContentSizeHeight = 2000;
+    event.ZoomScale = 1.5;
+
+    TestCheckEqual(340.0, *AnimatedEventPath::Compile({"contentOffset", "y"})->Read(event));
+    TestCheckEqual(12.0, *AnimatedEventPath::Compile({"contentOffset", "x"})->Read(event));
+    TestCheckEqual(2000.0, *AnimatedEventPath::Compile({"contentSize", "height"})->Read(event));
+    TestCheckEqual(1.5, *AnimatedEventPath::Compile({"zoomScale"})->Read(event));
+  }
+
+  TEST_METHOD(ReadsPointerEventFields) {
+    PointerEventData event;
+    event.PageX = 10;
+    event.LocationY = 4;
+
+    TestCheckEqual(10.0, *AnimatedEventPath::Compile({"pageX"})->Read(event));
+    TestCheckEqual(4.0, *AnimatedEventPath::Compile({"locationY"})->Read(event));
+  }
+
+  TEST_METHOD(FieldsOfOtherEventsAreNotRead) {
+    const auto path = AnimatedEventPath::Compile({"pageX"});
+    TestCheck(!path->Read(ScrollEventData{}));
+    TestCheck(!AnimatedEventPath::Compile({"contentOffset", "y"})->Read(PointerEventData{}));
+  }
+
+  TEST_METHOD(UnknownPathsDoNotCompile) {
+    TestCheck(!AnimatedEventPath::Compile({}));
+    TestCheck(!AnimatedEventPath::Compile({"contentOffset"}));
+    TestCheck(!AnimatedEventPath::Compile({"contentOffset", "z"}));
+    TestCheck(!AnimatedEventPath::Compile({"zoomScale", "x"}));
+    TestCheck(!AnimatedEventPath::Compile({"nativeEvent", "contentOffset", "y"}));
+  }
+};
+
+} // namespace Microsoft::ReactNative
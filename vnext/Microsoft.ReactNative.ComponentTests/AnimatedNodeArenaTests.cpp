@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/Animated/AnimatedNodeArena.h>
+#include <memory>
+#include <string>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (AnimatedNodeArenaTests) {
+  TEST_METHOD(ValuesAreFoundByHandle) {
+    AnimatedNodeArena<std::string> arena;
+    const auto first = arena.Insert("first");
+    const auto second = arena.Insert("second");
+
+    TestCheckEqual(2u, arena.Size());
+    TestCheckEqual(std::string{"first"}, *arena.Get(first));
+    TestCheckEqual(std::string{"second"}, *arena.Get(second));
+    TestCheck(!arena.Get(AnimatedNodeHandle{}));
+  }
+
+  TEST_METHOD(ErasingKeepsValuesDense) {
+    AnimatedNodeArena<int> arena;
+    const auto first = arena.Insert(1);
+    const auto second = arena.Insert(2);
+    const auto third = arena.Insert(3);
+
+    TestCheck(arena.Erase(first));
+    TestCheckEqual(2u, arena.Size());
+    TestCheckEqual(2, *arena.Get(second));
+    TestCheckEqual(3, *arena.Get(third));
+
+    // The last value moved into the hole left by the first one.
+    TestCheckEqual(0u, arena.DenseIndex(third));
+    TestCheck(arena.HandleAt(0) == third);
+
+    int sum = 0;
+    for (const auto value : arena) {
+      sum += value;
+    }
+    TestCheckEqual(5, sum);
+  }
+
+  TEST_METHOD(StaleHandlesAreRejected) {
+    AnimatedNodeArena<std::unique_ptr<int>> arena;
+    const auto erased = arena.Insert(std::make_unique<int>(1));
+    TestCheck(arena.Erase(erased));
+    TestCheck(!arena.Erase(erased));
+
+    // The new value reuses the slot of the erased one, with a new generation.
+    const auto reused = arena.Insert(std::make_unique<int>(2));
+    TestCheckEqual(erased.Index, reused.Index);
+    TestCheck(erased != reused);
+    TestCheck(!arena.Get(erased));
+    TestCheckEqual(2, **arena.Get(reused));
+
+    arena.Clear();
+    TestCheck(!arena.Get(reused));
+    TestCheckEqual(0u, arena.Size());
+  }
+};
+
+} // namespace Microsoft::ReactNative
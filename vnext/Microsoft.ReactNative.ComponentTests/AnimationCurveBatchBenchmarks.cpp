@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Benchmark of 1000 simultaneous springs, stepped for ten seconds of frames with EvaluateSpring and with
+// SpringCurveBatch. Each run records its time per spring and frame as a test property.
+//
+// Benchmarks are disabled by default. Run them with:
+//   Microsoft.ReactNative.ComponentTests.exe --gtest_also_run_disabled_tests --gtest_filter=DISABLED_*Benchmarks.*
+
+#include "pch.h"
+#include <Modules/Animated/AnimationCurveBatch.h>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+constexpr size_t SpringCount = 1000;
+constexpr int FrameCount = 600;
+
+template <typename TBody>
+double Measure(const char *name, TBody body) {
+  auto start = std::chrono::steady_clock::now();
+  const auto result = body();
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  ::testing::Test::RecordProperty(
+      name, std::to_string(elapsed.count() / (SpringCount * FrameCount)) + " ns/spring-frame");
+  return result;
+}
+
+std::vector<SpringAnimationConfig> MakeSprings() {
+  std::vector<SpringAnimationConfig> configs(SpringCount);
+  for (size_t i = 0; i < SpringCount; i++) {
+    configs[i].Stiffness = 50.0 + (i % 200);
+    configs[i].Damping = 5.0 + (i % 30);
+    configs[i].Mass = 1;
+  }
+  return configs;
+}
+
+} // namespace
+
+TEST_CLASS (DISABLED_AnimationCurveBatchBenchmarks) {
+  TEST_METHOD(ThousandSprings) {
+    const auto configs = MakeSprings();
+
+    const auto scalarSum = Measure("scalarSprings", [&configs]() {
+      double sum = 0;
+      for (int frame = 0; frame < FrameCount; frame++) {
+        const auto time = frame / AnimationFrameRate;
+        for (const auto &config : configs) {
+          sum += EvaluateSpring(config, 0, 100, time).Value;
+        }
+      }
+      return sum;
+    });
+
+    SpringCurveBatch batch;
+    for (const auto &config : configs) {
+      batch.Add(config, 0, 100);
+    }
+
+    const auto batchSum = Measure("batchSprings", [&batch]() {
+      double sum = 0;
+      for (int frame = 0; frame < FrameCount; frame++) {
+        const auto time = frame / AnimationFrameRate;
+        for (size_t i = 0; i < SpringCount; i++) {
+          batch.SetTime(i, time);
+        }
+        batch.Evaluate();
+        for (size_t i = 0; i < SpringCount; i++) {
+          sum += batch.Sample(i).Value;
+        }
+      }
+      return sum;
+    });
+
+    // Also keeps the results alive, so that neither loop is optimized away.
+    TestCheck(std::abs(scalarSum - batchSum) < 1e-4 * 100 * SpringCount * FrameCount);
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/Animated/AnimationCurveBatch.h>
+#include <Modules/Animated/AnimationGraphEvaluator.h>
+#include <cmath>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+constexpr double FrameTime = 1.0 / 60.0;
+
+SpringAnimationConfig MakeSpring(double stiffness, double damping, double initialVelocity) {
+  SpringAnimationConfig config;
+  config.Stiffness = stiffness;
+  config.Damping = damping;
+  config.Mass = 1;
+  config.InitialVelocity = initialVelocity;
+  return config;
+}
+
+// Compares every frame of the batched springs with EvaluateSpring, relative to the distance each spring travels.
+bool MatchesScalarSprings(const std::vector<SpringAnimationConfig> &configs, double startValue, double toValue) {
+  SpringCurveBatch batch;
+  for (const auto &config : configs) {
+    batch.Add(config, startValue, toValue);
+  }
+
+  const auto tolerance = 1e-4 * std::abs(toValue - startValue);
+  for (int frame = 0; frame < 600; frame++) {
+    const auto time = frame * FrameTime;
+    for (size_t i = 0; i < configs.size(); i++) {
+      batch.SetTime(i, time);
+    }
+    batch.Evaluate();
+
+    for (size_t i = 0; i < configs.size(); i++) {
+      const auto expected = EvaluateSpring(configs[i], startValue, toValue, time);
+      const auto actual = batch.Sample(i);
+      if (std::abs(expected.Value - actual.Value) > tolerance ||
+          std::abs(expected.Velocity - actual.Velocity) > 10 * tolerance) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+TEST_CLASS (AnimationCurveBatchTests) {
+  TEST_METHOD(UnderdampedSpringsMatchScalarSprings) {
+    TestCheck(MatchesScalarSprings(
+        {MakeSpring(100, 10, 0), MakeSpring(170, 26, 0), MakeSpring(40, 2, 5), MakeSpring(1000, 5, -20)}, 0, 100));
+  }
+
+  TEST_METHOD(DampedSpringsMatchScalarSprings) {
+    // Critically damped, overdamped and a partially filled batch.
+    TestCheck(MatchesScalarSprings({MakeSpring(100, 20, 0), MakeSpring(100, 60, 3), MakeSpring(10, 30, 0)}, 500, -20));
+  }
+
+  TEST_METHOD(SpringToValueCanChange) {
+    SpringCurveBatch batch;
+    const auto config = MakeSpring(100, 10, 0);
+    batch.Add(config, 0, 100);
+    batch.SetToValue(0, 50);
+    batch.SetTime(0, 0.5);
+    batch.Evaluate();
+
+    const auto expected = EvaluateSpring(config, 0, 50, 0.5);
+    TestCheck(std::abs(expected.Value - batch.Sample(0).Value) < 5e-3);
+  }
+
+  TEST_METHOD(SpringsToLargeValuesComeToRest) {
+    // 100000.3 is 3e-3 away from the nearest float, more than the rest threshold.
+    auto config = MakeSpring(100, 20, 0);
+    config.ToValue = 100000.3;
+    config.RestSpeedThreshold = 0.001;
+    config.RestDisplacementThreshold = 0.001;
+
+    SpringCurveBatch batch;
+    batch.Add(config, 0, config.ToValue);
+    batch.SetTime(0, 5);
+    batch.Evaluate();
+
+    TestCheck(IsSpringDone(config, 0, batch.Sample(0)));
+  }
+
+  TEST_METHOD(InterpolationsMatchScalarInterpolations) {
+    std::vector<AnimationGraphEvaluator::InterpolationConfig> configs(5);
+    configs[0].InputRange = {0, 1};
+    configs[0].OutputRange = {0, 100};
+    configs[1].InputRange = {0, 1, 2};
+    configs[1].OutputRange = {0, 100, 300};
+    configs[1].ExtrapolateLeft = ExtrapolationType::Clamp;
+    configs[1].ExtrapolateRight = ExtrapolationType::Clamp;
+    configs[2].InputRange = {-1, 0, 0, 4};
+    configs[2].OutputRange = {1, 0, 10, 20};
+    configs[2].ExtrapolateLeft = ExtrapolationType::Identity;
+    configs[2].ExtrapolateRight = ExtrapolationType::Identity;
+    configs[3].InputRange = {0, 1, 1};
+    configs[3].OutputRange = {0, 1, 5};
+    configs[4].InputRange = {0};
+    configs[4].OutputRange = {0};
+
+    // The evaluator interpolates in double precision when there are fewer interpolations than lanes.
+    InterpolationCurveBatch batch;
+    for (size_t i = 0; i < configs.size(); i++) {
+      AnimationGraphEvaluator evaluator;
+      evaluator.AddValueNode(1, 0, 0);
+      evaluator.AddInterpolationNode(2, configs[i]);
+      evaluator.ConnectNodes(1, 2);
+
+      batch.Add(configs[i].InputRange, configs[i].OutputRange, configs[i].ExtrapolateLeft, configs[i].ExtrapolateRight);
+      for (auto input = -3.0; input <= 6; input += 0.25) {
+        evaluator.SetNodeValue(1, input);
+        batch.SetInput(i, input);
+        batch.Evaluate();
+        TestCheck(std::abs(evaluator.GetNodeValue(2) - batch.Output(i)) < 1e-4);
+      }
+    }
+  }
+
+  TEST_METHOD(EvaluatorBatchesInterpolationLevels) {
+    AnimationGraphEvaluator evaluator;
+    AnimationGraphEvaluator::InterpolationConfig config;
+    config.InputRange = {0, 1};
+    config.OutputRange = {0, 10};
+    evaluator.AddValueNode(1, 0, 0);
+    for (int64_t tag = 2; tag < 10; tag++) {
+      evaluator.AddInterpolationNode(tag, config);
+      evaluator.ConnectNodes(1, tag);
+    }
+    evaluator.AddOperatorNode(10, AnimationGraphEvaluator::NodeKind::Addition, {2, 9});
+    evaluator.ConnectNodes(2, 10);
+    evaluator.ConnectNodes(9, 10);
+
+    evaluator.SetNodeValue(1, 0.5);
+    TestCheckEqual(5.0, evaluator.GetNodeValue(2));
+    TestCheckEqual(5.0, evaluator.GetNodeValue(9));
+    TestCheckEqual(10.0, evaluator.GetNodeValue(10));
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/Animated/AnimationGraphEvaluator.h>
+#include <cmath>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+constexpr double FrameTime = 1.0 / 60.0;
+
+bool IsNear(double expected, double actual) {
+  return std::abs(expected - actual) < 1e-6;
+}
+
+SpringAnimationConfig MakeSpring(double toValue) {
+  SpringAnimationConfig config;
+  config.Stiffness = 100;
+  config.Damping = 10;
+  config.Mass = 1;
+  config.ToValue = toValue;
+  config.RestSpeedThreshold = 0.001;
+  config.RestDisplacementThreshold = 0.001;
+  return config;
+}
+
+// Steps the evaluator at 60 frames per second until no animation is active, and returns the number of frames.
+int RunToCompletion(AnimationGraphEvaluator &evaluator, int maxFrames = 6000) {
+  int frame = 0;
+  while (evaluator.HasActiveAnimations() && frame < maxFrames) {
+    evaluator.Step(frame++ * FrameTime);
+  }
+  return frame;
+}
+
+} // namespace
+
+TEST_CLASS (AnimationGraphEvaluatorTests) {
+  TEST_METHOD(OperatorNodesFollowTheirInputs) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 2, 0);
+    evaluator.AddValueNode(2, 3, 1);
+    evaluator.AddOperatorNode(3, AnimationGraphEvaluator::NodeKind::Addition, {1, 2});
+    evaluator.AddOperatorNode(4, AnimationGraphEvaluator::NodeKind::Multiplication, {3, 1});
+    evaluator.AddModulusNode(5, 4, 5);
+    evaluator.ConnectNodes(1, 3);
+    evaluator.ConnectNodes(2, 3);
+    evaluator.ConnectNodes(3, 4);
+    evaluator.ConnectNodes(1, 4);
+    evaluator.ConnectNodes(4, 5);
+
+    TestCheckEqual(6.0, evaluator.GetNodeValue(3));
+    TestCheckEqual(12.0, evaluator.GetNodeValue(4));
+    TestCheckEqual(2.0, evaluator.GetNodeValue(5));
+
+    evaluator.SetNodeValue(1, 1);
+    TestCheckEqual(5.0, evaluator.GetNodeValue(3));
+    TestCheckEqual(5.0, evaluator.GetNodeValue(4));
+    TestCheckEqual(0.0, evaluator.GetNodeValue(5));
+  }
+
+  TEST_METHOD(NodesCreatedBeforeTheirInputsAreOrdered) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddOperatorNode(3, AnimationGraphEvaluator::NodeKind::Subtraction, {2, 1});
+    evaluator.AddDiffClampNode(4, 3, -1, 1);
+    evaluator.AddValueNode(2, 10, 0);
+    evaluator.AddValueNode(1, 4, 0);
+    evaluator.ConnectNodes(3, 4);
+    evaluator.ConnectNodes(2, 3);
+    evaluator.ConnectNodes(1, 3);
+
+    TestCheckEqual(6.0, evaluator.GetNodeValue(3));
+    TestCheckEqual(1.0, evaluator.GetNodeValue(4));
+
+    evaluator.DisconnectNodes(1, 3);
+    evaluator.RemoveNode(1);
+    TestCheckEqual(10.0, evaluator.GetNodeValue(3));
+  }
+
+  TEST_METHOD(DivisionByZeroYieldsZero) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 4, 0);
+    evaluator.AddValueNode(2, 0, 0);
+    evaluator.AddOperatorNode(3, AnimationGraphEvaluator::NodeKind::Division, {1, 2});
+    evaluator.ConnectNodes(1, 3);
+    evaluator.ConnectNodes(2, 3);
+
+    TestCheckEqual(0.0, evaluator.GetNodeValue(3));
+    evaluator.SetNodeValue(2, 2);
+    TestCheckEqual(2.0, evaluator.GetNodeValue(3));
+  }
+
+  TEST_METHOD(InterpolationExtrapolates) {
+    AnimationGraphEvaluator evaluator;
+    AnimationGraphEvaluator::InterpolationConfig config;
+    config.InputRange = {0, 1, 2};
+    config.OutputRange = {0, 100, 300};
+    config.ExtrapolateLeft = ExtrapolationType::Clamp;
+    config.ExtrapolateRight = ExtrapolationType::Extend;
+    evaluator.AddValueNode(1, 0.5, 0);
+    evaluator.AddInterpolationNode(2, config);
+    evaluator.ConnectNodes(1, 2);
+
+    TestCheckEqual(50.0, evaluator.GetNodeValue(2));
+    evaluator.SetNodeValue(1, 1.5);
+    TestCheckEqual(200.0, evaluator.GetNodeValue(2));
+    evaluator.SetNodeValue(1, -1);
+    TestCheckEqual(0.0, evaluator.GetNodeValue(2));
+    evaluator.SetNodeValue(1, 3);
+    TestCheckEqual(500.0, evaluator.GetNodeValue(2));
+
+    // The offset of the parent is interpolated too.
+    evaluator.SetNodeValue(1, 0);
+    evaluator.SetNodeOffset(1, 1);
+    TestCheckEqual(100.0, evaluator.GetNodeValue(2));
+  }
+
+  TEST_METHOD(OffsetsAreFlattenedAndExtracted) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 2, 3);
+
+    evaluator.FlattenNodeOffset(1);
+    TestCheckEqual(5.0, evaluator.GetNodeRawValue(1));
+    TestCheckEqual(5.0, evaluator.GetNodeValue(1));
+
+    evaluator.ExtractNodeOffset(1);
+    TestCheckEqual(0.0, evaluator.GetNodeRawValue(1));
+    TestCheckEqual(5.0, evaluator.GetNodeValue(1));
+  }
+
+  TEST_METHOD(SpringSettlesOnToValue) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    evaluator.AddOperatorNode(2, AnimationGraphEvaluator::NodeKind::Addition, {1, 1});
+    evaluator.ConnectNodes(1, 2);
+    evaluator.StartSpringAnimation(10, 1, MakeSpring(100), 1);
+
+    evaluator.Step(0);
+    evaluator.Step(FrameTime);
+    TestCheckEqual(1u, evaluator.AnimatedNodes().size());
+    TestCheck(evaluator.GetNodeRawValue(1) > 0);
+    TestCheck(IsNear(evaluator.GetNodeRawValue(1) * 2, evaluator.GetNodeValue(2)));
+
+    const auto frames = RunToCompletion(evaluator);
+    TestCheck(frames < 6000);
+    TestCheckEqual(100.0, evaluator.GetNodeRawValue(1));
+    TestCheckEqual(200.0, evaluator.GetNodeValue(2));
+
+    const auto finished = evaluator.TakeFinishedAnimations();
+    TestCheckEqual(1u, finished.size());
+    TestCheckEqual(10, finished[0]);
+    TestCheck(evaluator.TakeFinishedAnimations().empty());
+  }
+
+  TEST_METHOD(OverdampedSpringSettlesOnToValue) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 10, 0);
+    auto config = MakeSpring(-10);
+    config.Damping = 40;
+    evaluator.StartSpringAnimation(1, 1, config, 1);
+
+    RunToCompletion(evaluator);
+    TestCheckEqual(-10.0, evaluator.GetNodeRawValue(1));
+  }
+
+  TEST_METHOD(DecayStopsNearItsEndValue) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    DecayAnimationConfig config;
+    config.Deceleration = 0.997;
+    config.Velocity = 1;
+    evaluator.StartDecayAnimation(1, 1, config, 1);
+
+    RunToCompletion(evaluator);
+    TestCheck(std::abs(DecayEndValue(config, 0) - evaluator.GetNodeRawValue(1)) < 0.1);
+  }
+
+  TEST_METHOD(FramesAnimationIterates) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    evaluator.StartFramesAnimation(1, 1, {0, 0.5, 1}, 10, 2);
+
+    evaluator.Step(0);
+    TestCheckEqual(0.0, evaluator.GetNodeRawValue(1));
+    evaluator.Step(FrameTime * 1.5);
+    TestCheckEqual(5.0, evaluator.GetNodeRawValue(1));
+    evaluator.Step(FrameTime * 2.5);
+    TestCheckEqual(10.0, evaluator.GetNodeRawValue(1));
+    TestCheck(evaluator.HasActiveAnimations());
+
+    // The second iteration starts over from the original start value.
+    evaluator.Step(FrameTime * 3.5);
+    TestCheckEqual(5.0, evaluator.GetNodeRawValue(1));
+    evaluator.Step(FrameTime * 4.5);
+    TestCheckEqual(10.0, evaluator.GetNodeRawValue(1));
+    TestCheck(!evaluator.HasActiveAnimations());
+  }
+
+  TEST_METHOD(StoppedAnimationsDoNotFinish) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    evaluator.StartSpringAnimation(1, 1, MakeSpring(1), -1);
+    evaluator.Step(0);
+    evaluator.Step(FrameTime);
+
+    TestCheck(evaluator.StopAnimation(1));
+    TestCheck(!evaluator.StopAnimation(1));
+    evaluator.Step(FrameTime * 2);
+    TestCheck(evaluator.AnimatedNodes().empty());
+    TestCheck(evaluator.TakeFinishedAnimations().empty());
+  }
+
+  TEST_METHOD(RemovingNodeRemovesItsAnimations) {
+    AnimationGraphEvaluator evaluator;
+    evaluator.AddValueNode(1, 0, 0);
+    evaluator.StartFramesAnimation(1, 1, {0, 1}, 1, 1);
+
+    evaluator.RemoveNode(1);
+    TestCheck(!evaluator.HasNode(1));
+    TestCheck(!evaluator.HasActiveAnimations());
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,186 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Threading/BatchingQueueThread.h>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// Keeps the work items posted to the UI queue until the test runs them.
+struct ManualQueueThread final : facebook::react::MessageQueueThread {
+  void runOnQueue(std::function<void()> &&func) override {
+    WorkItems.push_back(std::move(func));
+  }
+
+  void runOnQueueSync(std::function<void()> &&func) override {
+    func();
+  }
+
+  void quitSynchronous() override {}
+
+  void RunOne() {
+    auto func = std::move(WorkItems.front());
+    WorkItems.pop_front();
+    func();
+  }
+
+  void RunAll() {
+    while (!WorkItems.empty()) {
+      RunOne();
+    }
+  }
+
+  std::deque<std::function<void()>> WorkItems;
+};
+
+// Records its execution, and merges later updates into itself the way the props operations of UIManager do.
+struct RecordingOperation final : facebook::react::ICoalescingOperation {
+  RecordingOperation(
+      std::vector<std::string> &log,
+      int64_t tag,
+      facebook::react::CoalescingOperationKind kind,
+      std::string name)
+      : m_log(log), m_tag(tag), m_kind(kind), m_name(std::move(name)) {}
+
+  int64_t Tag() const noexcept override {
+    return m_tag;
+  }
+
+  facebook::react::CoalescingOperationKind Kind() const noexcept override {
+    return m_kind;
+  }
+
+  bool TryCoalesce(facebook::react::ICoalescingOperation &next) noexcept override {
+    if (m_kind == facebook::react::CoalescingOperationKind::Other ||
+        next.Kind() != facebook::react::CoalescingOperationKind::UpdateView) {
+      return false;
+    }
+
+    m_name += "+" + static_cast<RecordingOperation &>(next).m_name;
+    return true;
+  }
+
+  void Execute() noexcept override {
+    m_log.push_back(m_name);
+  }
+
+ private:
+  std::vector<std::string> &m_log;
+  int64_t m_tag;
+  facebook::react::CoalescingOperationKind m_kind;
+  std::string m_name;
+};
+
+struct BatchingQueueFixture {
+  BatchingQueueFixture(std::chrono::milliseconds frameBudget = std::chrono::milliseconds{0})
+      : UIQueue(std::make_shared<ManualQueueThread>()),
+        BatchingQueue(std::make_shared<BatchingQueueThread>(UIQueue, frameBudget)) {}
+
+  void Queue(int64_t tag, facebook::react::CoalescingOperationKind kind, std::string name) {
+    BatchingQueue->runCoalescingOnQueue(std::make_shared<RecordingOperation>(Log, tag, kind, std::move(name)));
+  }
+
+  void QueueCreate(int64_t tag, std::string name) {
+    Queue(tag, facebook::react::CoalescingOperationKind::CreateView, std::move(name));
+  }
+
+  void QueueUpdate(int64_t tag, std::string name) {
+    Queue(tag, facebook::react::CoalescingOperationKind::UpdateView, std::move(name));
+  }
+
+  void QueueWork(std::string name) {
+    BatchingQueue->runOnQueue([this, name = std::move(name)]() { Log.push_back(name); });
+  }
+
+  std::vector<std::string> Log;
+  std::shared_ptr<ManualQueueThread> UIQueue;
+  std::shared_ptr<BatchingQueueThread> BatchingQueue;
+};
+
+} // namespace
+
+TEST_CLASS (BatchingQueueThreadTests) {
+  TEST_METHOD(UpdatesMergeIntoEarlierOperationsOnTheSameView) {
+    BatchingQueueFixture fixture;
+    fixture.QueueCreate(1, "create1");
+    fixture.QueueUpdate(2, "update2");
+    fixture.QueueUpdate(1, "update1");
+    fixture.QueueUpdate(2, "update2b");
+    fixture.BatchingQueue->onBatchComplete();
+    fixture.UIQueue->RunAll();
+
+    TestCheck((std::vector<std::string>{"create1+update1", "update2+update2b"}) == fixture.Log);
+  }
+
+  TEST_METHOD(QueuedWorkEndsCoalescingForAllViews) {
+    // measure, setChildren, manageChildren and the other plain UIManager calls are queued with runOnQueue.
+    BatchingQueueFixture fixture;
+    fixture.QueueCreate(1, "create1");
+    fixture.QueueUpdate(2, "update2");
+    fixture.QueueWork("measure1");
+    fixture.QueueUpdate(1, "update1");
+    fixture.QueueUpdate(2, "update2b");
+    fixture.BatchingQueue->onBatchComplete();
+    fixture.UIQueue->RunAll();
+
+    TestCheck((std::vector<std::string>{"create1", "update2", "measure1", "update1", "update2b"}) == fixture.Log);
+  }
+
+  TEST_METHOD(ViewOperationsEndCoalescingForAllViews) {
+    BatchingQueueFixture fixture;
+    fixture.QueueUpdate(1, "update1");
+    fixture.QueueUpdate(2, "update2");
+    fixture.Queue(2, facebook::react::CoalescingOperationKind::Other, "focus2");
+    fixture.QueueUpdate(1, "update1b");
+    fixture.QueueUpdate(2, "update2b");
+    fixture.QueueUpdate(2, "update2c");
+    fixture.BatchingQueue->onBatchComplete();
+    fixture.UIQueue->RunAll();
+
+    TestCheck((std::vector<std::string>{"update1", "update2", "focus2", "update1b", "update2b+update2c"}) ==
+              fixture.Log);
+  }
+
+  TEST_METHOD(UpdatesDoNotMergeAcrossBatches) {
+    BatchingQueueFixture fixture;
+    fixture.QueueCreate(1, "create1");
+    fixture.BatchingQueue->onBatchComplete();
+    fixture.QueueUpdate(1, "update1");
+    fixture.BatchingQueue->onBatchComplete();
+    fixture.UIQueue->RunAll();
+
+    TestCheck((std::vector<std::string>{"create1", "update1"}) == fixture.Log);
+  }
+
+  TEST_METHOD(FrameBudgetOnlyYieldsBetweenBatches) {
+    BatchingQueueFixture fixture{std::chrono::milliseconds{1}};
+    for (int batch = 0; batch < 2; batch++) {
+      for (int i = 0; i < 3; i++) {
+        fixture.BatchingQueue->runOnQueue([&fixture, batch]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds{2});
+          fixture.Log.push_back(std::to_string(batch));
+        });
+      }
+      fixture.BatchingQueue->onBatchComplete();
+    }
+
+    // The first batch runs to completion although it exceeds the budget, and the second one runs in the next work
+    // item.
+    TestCheckEqual(1u, fixture.UIQueue->WorkItems.size());
+    fixture.UIQueue->RunOne();
+    TestCheck((std::vector<std::string>{"0", "0", "0"}) == fixture.Log);
+    TestCheckEqual(1u, fixture.UIQueue->WorkItems.size());
+    fixture.UIQueue->RunOne();
+    TestCheck((std::vector<std::string>{"0", "0", "0", "1", "1", "1"}) == fixture.Log);
+    TestCheck(fixture.UIQueue->WorkItems.empty());
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/ChakraRuntimeArgs.h>
+#include <JSI/ChakraRuntimeFactory.h>
+#include <string>
+#include <vector>
+
+namespace Microsoft::JSI {
+
+namespace {
+
+// Returns the name of each property read from it, and records the names of the properties written to it. The get
+// and set traps of its Proxy look up the property ids through the property id cache of ChakraRuntime.
+struct EchoHostObject final : facebook::jsi::HostObject {
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &name) override {
+    return facebook::jsi::String::createFromUtf8(runtime, name.utf8(runtime));
+  }
+
+  void set(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &)
+      override {
+    WrittenNames.push_back(name.utf8(runtime));
+  }
+
+  std::vector<std::string> WrittenNames;
+};
+
+struct PropertyIdCacheFixture {
+  PropertyIdCacheFixture()
+      : Runtime(makeChakraRuntime(ChakraRuntimeArgs{})), HostObject(std::make_shared<EchoHostObject>()) {
+    Runtime->global().setProperty(*Runtime, "host", facebook::jsi::Object::createFromHostObject(*Runtime, HostObject));
+  }
+
+  bool EvalBool(const char *script) {
+    return Runtime->evaluateJavaScript(std::make_shared<facebook::jsi::StringBuffer>(script), "PropertyIdCacheTests")
+        .getBool();
+  }
+
+  std::unique_ptr<facebook::jsi::Runtime> Runtime;
+  std::shared_ptr<EchoHostObject> HostObject;
+};
+
+} // namespace
+
+TEST_CLASS (ChakraPropertyIdCacheTests) {
+  TEST_METHOD(RepeatedLookupsReturnTheSameName) {
+    // After the first lookup, the same string instances hit their cache entries.
+    PropertyIdCacheFixture fixture;
+    TestCheck(fixture.EvalBool(
+        "var same = true;"
+        "for (var i = 0; i < 1000; i++) {"
+        "  same = same && host.alpha === 'alpha' && host.beta === 'beta';"
+        "}"
+        "same;"));
+  }
+
+  TEST_METHOD(DistinctNamesInTheSameSlotKeepTheirOwnNames) {
+    // The cache has 256 entries, so some of these names share a slot and evict each other in turn.
+    PropertyIdCacheFixture fixture;
+    TestCheck(fixture.EvalBool(
+        "var names = [];"
+        "for (var i = 0; i < 1024; i++) {"
+        "  names.push('name' + i);"
+        "}"
+        "var same = true;"
+        "for (var pass = 0; pass < 3; pass++) {"
+        "  for (var i = 0; i < names.length; i++) {"
+        "    var name = names[pass === 1 ? names.length - 1 - i : i];"
+        "    same = same && host[name] === name;"
+        "  }"
+        "}"
+        "same;"));
+  }
+
+  TEST_METHOD(LookupsAfterTheCacheIsFullReturnTheirNames) {
+    PropertyIdCacheFixture fixture;
+    TestCheck(fixture.EvalBool(
+        "for (var i = 0; i < 4096; i++) {"
+        "  host['fill' + i];"
+        "}"
+        "host.alpha === 'alpha' && host['fill' + 7] === 'fill7';"));
+
+    // The set trap shares the cache with the get trap.
+    TestCheck(fixture.EvalBool("host.alpha = 1; host.fill7 = 2; host['fill' + 4095] = 3; true;"));
+    TestCheck((std::vector<std::string>{"alpha", "fill7", "fill4095"}) == fixture.HostObject->WrittenNames);
+  }
+};
+
+} // namespace Microsoft::JSI
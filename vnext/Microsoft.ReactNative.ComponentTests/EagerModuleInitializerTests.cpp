@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <EagerModuleInitializer.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+constexpr std::chrono::seconds Timeout{10};
+
+// Records the order in which the modules are constructed, and the threads they are constructed on.
+struct ConstructionLog {
+  Mso::VoidFunctor Construct(std::string moduleName) {
+    return [this, moduleName = std::move(moduleName)]() noexcept {
+      std::scoped_lock lock{Mutex};
+      Modules.push_back(moduleName);
+      Threads.push_back(std::this_thread::get_id());
+    };
+  }
+
+  std::vector<std::string> ConstructedModules() {
+    std::scoped_lock lock{Mutex};
+    return Modules;
+  }
+
+  std::mutex Mutex;
+  std::vector<std::string> Modules;
+  std::vector<std::thread::id> Threads;
+};
+
+} // namespace
+
+TEST_CLASS (EagerModuleInitializerTests) {
+  TEST_METHOD(ModulesAreConstructedAfterTheirDependencies) {
+    ConstructionLog log;
+    std::promise<void> lastConstructed;
+    auto initializer = std::make_shared<EagerModuleInitializer>();
+    initializer->AddModule("C", {"B", "NotEager"}, [&log, &lastConstructed]() noexcept {
+      log.Construct("C")();
+      lastConstructed.set_value();
+    });
+    initializer->AddModule("B", {"A"}, log.Construct("B"));
+    initializer->AddModule("A", {}, log.Construct("A"));
+    initializer->Start();
+
+    // Dependencies that are not eager modules are not waited for.
+    TestCheck(lastConstructed.get_future().wait_for(Timeout) == std::future_status::ready);
+    TestCheck((std::vector<std::string>{"A", "B", "C"}) == log.ConstructedModules());
+  }
+
+  TEST_METHOD(ModulesWithCircularDependenciesAreConstructedOnFirstUse) {
+    ConstructionLog log;
+    auto initializer = std::make_shared<EagerModuleInitializer>();
+    initializer->AddModule("X", {"Y"}, log.Construct("X"));
+    initializer->AddModule("Y", {"X"}, log.Construct("Y"));
+    initializer->AddModule("Self", {"Self"}, log.Construct("Self"));
+    initializer->Start();
+
+    // A module that depends on itself is not waiting for anything.
+    initializer->EnsureConstructed("Self");
+    TestCheck((std::vector<std::string>{"Self"}) == log.ConstructedModules());
+
+    // X and Y never become ready: the first use of X constructs it on the requesting thread, which makes Y ready.
+    initializer->EnsureConstructed("X");
+    initializer->EnsureConstructed("Y");
+    TestCheck((std::vector<std::string>{"Self", "X", "Y"}) == log.ConstructedModules());
+    TestCheck(std::this_thread::get_id() == log.Threads[1]);
+  }
+
+  TEST_METHOD(EnsureConstructedConstructsPendingModulesOnTheRequestingThread) {
+    ConstructionLog log;
+    std::promise<void> releaseDependency;
+    auto dependencyReleased = releaseDependency.get_future().share();
+    auto initializer = std::make_shared<EagerModuleInitializer>();
+    initializer->AddModule("Dependency", {}, [dependencyReleased]() noexcept { dependencyReleased.wait(); });
+    initializer->AddModule("Module", {"Dependency"}, log.Construct("Module"));
+    initializer->Start();
+
+    // The module does not wait for its dependency when it is requested.
+    initializer->EnsureConstructed("Module");
+    TestCheck((std::vector<std::string>{"Module"}) == log.ConstructedModules());
+    TestCheck(std::this_thread::get_id() == log.Threads[0]);
+
+    releaseDependency.set_value();
+    initializer->EnsureConstructed("Dependency");
+    TestCheckEqual(1u, log.ConstructedModules().size());
+  }
+
+  TEST_METHOD(EnsureConstructedWaitsForModulesUnderConstruction) {
+    std::promise<void> constructionStarted;
+    std::promise<void> releaseConstruction;
+    auto constructionReleased = releaseConstruction.get_future().share();
+    auto initializer = std::make_shared<EagerModuleInitializer>();
+    initializer->AddModule("Module", {}, [&constructionStarted, constructionReleased]() noexcept {
+      constructionStarted.set_value();
+      constructionReleased.wait();
+    });
+    initializer->Start();
+    TestCheck(constructionStarted.get_future().wait_for(Timeout) == std::future_status::ready);
+
+    std::atomic<bool> isConstructed{false};
+    std::thread requester{[&initializer, &isConstructed]() {
+      initializer->EnsureConstructed("Module");
+      isConstructed = true;
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    TestCheck(!isConstructed);
+
+    releaseConstruction.set_value();
+    requester.join();
+    TestCheck(isConstructed);
+
+    // Modules that are not eager are not waited for.
+    initializer->EnsureConstructed("Unknown");
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
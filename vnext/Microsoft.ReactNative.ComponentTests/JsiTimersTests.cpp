@@ -0,0 +1,192 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/ChakraRuntimeArgs.h>
+#include <JSI/ChakraRuntimeFactory.h>
+#include <Modules/JsiTimers.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace Microsoft::React {
+
+namespace {
+
+// Keeps the work items posted to the JS queue until the test thread, which owns the runtime, runs them.
+struct TestQueueThread final : facebook::react::MessageQueueThread {
+  void runOnQueue(std::function<void()> &&func) override {
+    {
+      std::scoped_lock lock{m_mutex};
+      m_workItems.push_back(std::move(func));
+    }
+    m_workItemAdded.notify_one();
+  }
+
+  void runOnQueueSync(std::function<void()> &&func) override {
+    func();
+  }
+
+  void quitSynchronous() override {}
+
+  // Runs the work items until the condition holds. Returns false if it still does not hold after the timeout.
+  bool RunUntil(const std::function<bool()> &condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (!condition()) {
+      std::unique_lock lock{m_mutex};
+      if (!m_workItemAdded.wait_until(lock, deadline, [this]() { return !m_workItems.empty(); })) {
+        return false;
+      }
+
+      auto func = std::move(m_workItems.front());
+      m_workItems.pop_front();
+      lock.unlock();
+      func();
+    }
+    return true;
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_workItemAdded;
+  std::deque<std::function<void()>> m_workItems;
+};
+
+struct JsiTimersFixture {
+  JsiTimersFixture()
+      : JSQueue(std::make_shared<TestQueueThread>()),
+        Runtime(::Microsoft::JSI::makeChakraRuntime(::Microsoft::JSI::ChakraRuntimeArgs{})) {
+    JsiTimers::Install(*Runtime, JSQueue, [this]() { FlushCount++; });
+    Eval("var log = [];");
+  }
+
+  facebook::jsi::Value Eval(const char *script) {
+    return Runtime->evaluateJavaScript(std::make_shared<facebook::jsi::StringBuffer>(script), "JsiTimersTests");
+  }
+
+  std::string Log() {
+    return Eval("log.join(',')").getString(*Runtime).utf8(*Runtime);
+  }
+
+  bool RunUntilLogged(double count) {
+    return JSQueue->RunUntil([this, count]() {
+      return Runtime->global().getPropertyAsObject(*Runtime, "log").getProperty(*Runtime, "length").getNumber() >=
+          count;
+    });
+  }
+
+  // The runtime owns the timers, which post to the queue until they are destroyed with it.
+  std::shared_ptr<TestQueueThread> JSQueue;
+  std::unique_ptr<facebook::jsi::Runtime> Runtime;
+  int FlushCount{0};
+};
+
+} // namespace
+
+TEST_CLASS (JsiTimersTests) {
+  TEST_METHOD(TimersFireInDueOrder) {
+    JsiTimersFixture fixture;
+    fixture.Eval(
+        "setTimeout(() => log.push('c'), 30);"
+        "setTimeout(() => log.push('a'), 10);"
+        "setTimeout(() => log.push('b'), 20);"
+        "setTimeout(() => log.push('a2'), 10);"
+        "setTimeout((x, y) => log.push(x + y), 40, 'd', '2');");
+
+    TestCheck(fixture.RunUntilLogged(5));
+    TestCheckEqual(std::string{"a,a2,b,c,d2"}, fixture.Log());
+    TestCheck(fixture.FlushCount > 0);
+  }
+
+  TEST_METHOD(TimersClearedByEarlierCallbacksDoNotFire) {
+    JsiTimersFixture fixture;
+    fixture.Eval(
+        "var second;"
+        "setTimeout(() => { log.push('first'); clearTimeout(second); }, 10);"
+        "second = setTimeout(() => log.push('second'), 10);"
+        "var cleared = setTimeout(() => log.push('cleared'), 5);"
+        "clearTimeout(cleared);"
+        "setTimeout(() => log.push('last'), 20);");
+
+    TestCheck(fixture.RunUntilLogged(2));
+    TestCheckEqual(std::string{"first,last"}, fixture.Log());
+  }
+
+  TEST_METHOD(IntervalsRepeatUntilCleared) {
+    JsiTimersFixture fixture;
+    fixture.Eval(
+        "var count = 0;"
+        "var interval = setInterval(() => { log.push(++count); if (count === 3) clearInterval(interval); }, 5);"
+        "setTimeout(() => log.push('done'), 100);");
+
+    TestCheck(fixture.RunUntilLogged(4));
+    TestCheckEqual(std::string{"1,2,3,done"}, fixture.Log());
+  }
+
+  TEST_METHOD(AnimationFramesReceiveTheFrameTime) {
+    JsiTimersFixture fixture;
+    fixture.Eval(
+        "requestAnimationFrame(time => log.push(typeof time));"
+        "var cancelled = requestAnimationFrame(() => log.push('cancelled'));"
+        "cancelAnimationFrame(cancelled);"
+        "setTimeout(() => log.push('done'), 50);");
+
+    TestCheck(fixture.RunUntilLogged(2));
+    TestCheckEqual(std::string{"number,done"}, fixture.Log());
+  }
+
+  TEST_METHOD(ImmediatesReceiveTheirArguments) {
+    JsiTimersFixture fixture;
+    fixture.Eval(
+        "setImmediate(x => log.push(x), 'immediate');"
+        "var cleared = setImmediate(() => log.push('cleared'));"
+        "clearImmediate(cleared);"
+        "setTimeout(() => log.push('timeout'), 0);");
+
+    TestCheck(fixture.RunUntilLogged(2));
+    TestCheckEqual(std::string{"immediate,timeout"}, fixture.Log());
+  }
+
+  TEST_METHOD(ErrorsAreReportedWithoutStoppingOtherTimers) {
+    JsiTimersFixture fixture;
+    fixture.Eval(
+        "var ErrorUtils = { reportFatalError: error => log.push('reported ' + error.message) };"
+        "setTimeout(() => { throw new Error('timeout'); }, 10);"
+        "setTimeout(() => log.push('after'), 10);"
+        "setImmediate(() => { throw new Error('immediate'); });");
+
+    TestCheck(fixture.RunUntilLogged(3));
+    TestCheckEqual(std::string{"reported immediate,reported timeout,after"}, fixture.Log());
+    TestCheckEqual(2, fixture.FlushCount);
+  }
+
+  TEST_METHOD(UnreportedErrorsAreRethrownAfterOtherTimers) {
+    JsiTimersFixture fixture;
+    fixture.Eval(
+        "setTimeout(() => { throw new Error('timeout'); }, 10);"
+        "setTimeout(() => log.push('after'), 10);");
+
+    bool rethrown = false;
+    try {
+      fixture.RunUntilLogged(1);
+    } catch (const facebook::jsi::JSError &) {
+      rethrown = true;
+    }
+
+    TestCheck(rethrown);
+    TestCheckEqual(std::string{"after"}, fixture.Log());
+    TestCheckEqual(0.0, fixture.Eval("__nativeTimerCallbacks.size").getNumber());
+    TestCheckEqual(1, fixture.FlushCount);
+  }
+
+  TEST_METHOD(TimerFunctionsArePublishedForTheJSSetup) {
+    // setUpTimers.windows.js restores the timer globals from this object after the JSTimers polyfills.
+    JsiTimersFixture fixture;
+    TestCheck(fixture.Eval("__nativeTimers.setTimeout === setTimeout").getBool());
+    TestCheckEqual(8.0, fixture.Eval("Object.keys(__nativeTimers).length").getNumber());
+  }
+};
+
+} // namespace Microsoft::React
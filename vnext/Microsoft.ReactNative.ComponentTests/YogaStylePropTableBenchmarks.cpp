@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Benchmark of the prop name lookup done by NativeUIManager for every prop of every createView and updateView. It
+// replays the prop names of an updateView stream through the perfect hash table and through a sequential comparison
+// with every style prop, like the if-else chain the table replaced. Each run records its time per prop as a test
+// property.
+//
+// Benchmarks are disabled by default. Run them with:
+//   Microsoft.ReactNative.ComponentTests.exe --gtest_also_run_disabled_tests --gtest_filter=DISABLED_*Benchmarks.*
+
+#include "pch.h"
+#include <Modules/YogaStylePropTable.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// The updateView calls of a list screen, for one row. Each row is a touchable container with an image, a title,
+// a subtitle and a separator. Scrolling recycles the rows, which re-sends their props.
+const std::vector<std::vector<std::string>> rowUpdates = {
+    {"accessible", "accessibilityRole", "onLayout", "style", "flexDirection", "alignItems", "paddingHorizontal",
+     "paddingVertical", "backgroundColor", "opacity"},
+    {"source", "style", "width", "height", "borderRadius", "marginRight", "resizeMode"},
+    {"flex", "flexDirection", "justifyContent"},
+    {"text", "numberOfLines", "style", "fontSize", "fontWeight", "color", "marginBottom"},
+    {"text", "numberOfLines", "style", "fontSize", "color"},
+    {"style", "height", "marginLeft", "backgroundColor"},
+    {"opacity", "backgroundColor"},
+};
+
+constexpr size_t RowCount = 1000;
+constexpr int ReplayCount = 20;
+
+// The lookup that the table replaced: a comparison with each style prop in turn.
+uint8_t FindYogaStylePropSequentially(const std::string &key) noexcept {
+  for (size_t i = 0; i < std::size(yogaStylePropNames); i++) {
+    if (key == yogaStylePropNames[i])
+      return static_cast<uint8_t>(i);
+  }
+  return noYogaStyleProp;
+}
+
+template <typename TFind>
+size_t Replay(const char *name, const std::vector<std::string> &stream, TFind find) {
+  size_t found = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int replay = 0; replay < ReplayCount; replay++) {
+    for (const auto &key : stream) {
+      found += find(key);
+    }
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  ::testing::Test::RecordProperty(
+      name, std::to_string(static_cast<double>(elapsed.count()) / (stream.size() * ReplayCount)) + " ns/prop");
+  return found;
+}
+
+} // namespace
+
+TEST_CLASS (DISABLED_YogaStylePropTableBenchmarks) {
+  TEST_METHOD(ListScreenUpdateViewStream) {
+    std::vector<std::string> stream;
+    for (size_t row = 0; row < RowCount; row++) {
+      for (const auto &update : rowUpdates) {
+        stream.insert(stream.end(), update.begin(), update.end());
+      }
+    }
+
+    const auto sequentialFound = Replay("sequentialLookup", stream, [](const std::string &key) {
+      return FindYogaStylePropSequentially(key) != noYogaStyleProp;
+    });
+    const auto tableFound = Replay(
+        "perfectHashLookup", stream, [](const std::string &key) { return FindYogaStyleProp(key) != noYogaStyleProp; });
+
+    // Also keeps the results alive, so that neither loop is optimized away.
+    TestCheckEqual(sequentialFound, tableFound);
+  }
+};
+
+} // namespace Microsoft::ReactNative
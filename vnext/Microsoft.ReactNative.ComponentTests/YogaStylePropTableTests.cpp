@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/YogaStylePropTable.h>
+#include <string>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (YogaStylePropTableTests) {
+  TEST_METHOD(StylePropsResolveToTheirIndex) {
+    for (size_t i = 0; i < std::size(yogaStylePropNames); i++) {
+      TestCheckEqual(i, static_cast<size_t>(FindYogaStyleProp(yogaStylePropNames[i])));
+    }
+  }
+
+  TEST_METHOD(OtherPropsAreNotFound) {
+    for (const auto name : {"", "backgroundColor", "opacity", "style", "flexDirectio", "flexDirectionX", "Width"}) {
+      TestCheckEqual(noYogaStyleProp, FindYogaStyleProp(name));
+    }
+
+    // Names that share a slot with a style prop are told apart by the string comparison.
+    const auto widthSlot = HashYogaStyleProp("width", yogaStylePropTable.seed) % yogaStylePropSlotCount;
+    for (int i = 0; i < 100000; i++) {
+      const auto name = "prop" + std::to_string(i);
+      if (HashYogaStyleProp(name, yogaStylePropTable.seed) % yogaStylePropSlotCount == widthSlot) {
+        TestCheckEqual(noYogaStyleProp, FindYogaStyleProp(name));
+        return;
+      }
+    }
+    TestCheckFail("No name collides with width.");
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <NativeModules.h>
+#include <ReactPropertyBag.h>
+#include "TestEventService.h"
+#include "TestReactNativeHostHolder.h"
+
+using namespace winrt;
+using namespace Microsoft::ReactNative;
+
+namespace ReactNativeIntegrationTests {
+
+// Use anonymous namespace to avoid any linking conflicts
+namespace {
+
+// Number of instances that initialized the module, as seen by each instance.
+ReactPropertyId<int> InitCountProperty() noexcept {
+  static ReactPropertyId<int> prop{L"InstancePoolTests", L"InitCount"};
+  return prop;
+}
+
+// Created on demand by each instance, like the per-instance stores of the view managers.
+ReactPropertyId<int> StoreProperty() noexcept {
+  static ReactPropertyId<int> prop{L"InstancePoolTests", L"Store"};
+  return prop;
+}
+
+REACT_MODULE(TestPoolModule)
+struct TestPoolModule {
+  REACT_INIT(Initialize)
+  void Initialize(ReactContext const &reactContext) noexcept {
+    auto properties = reactContext.Properties();
+    int initCount = properties.Get(InitCountProperty()).value_or(0);
+    int store = *properties.GetOrCreate(StoreProperty(), [initCount]() noexcept { return initCount; });
+    properties.Set(InitCountProperty(), initCount + 1);
+
+    TestEventService::LogEvent("initialize", JSValueArray{initCount, store});
+  }
+};
+
+struct TestPackageProvider : winrt::implements<TestPackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    TryAddAttributedModule(packageBuilder, L"TestPoolModule");
+  }
+};
+
+} // namespace
+
+TEST_CLASS (InstancePoolTests) {
+  TEST_METHOD(WarmInstance_IsClaimedOnReload) {
+    TestEventService::Initialize();
+
+    auto reactNativeHost = TestReactNativeHostHolder(L"InstancePoolTests", [](ReactNativeHost const &host) noexcept {
+      host.PackageProviders().Append(winrt::make<TestPackageProvider>());
+      host.InstanceSettings().InstancePoolSize(1);
+    });
+
+    // The current instance, then the warm instance. The warm instance reads the properties of the current instance,
+    // but creates its own store.
+    TestEventService::ObserveEvents(
+        {TestEvent{"initialize", JSValueArray{0, 0}}, TestEvent{"initialize", JSValueArray{1, 1}}});
+
+    // The changes of the warm instance are staged.
+    ReactPropertyBag properties{reactNativeHost.Host().InstanceSettings().Properties()};
+    TestCheckEqual(1, *properties.Get(InitCountProperty()));
+    TestCheckEqual(0, *properties.Get(StoreProperty()));
+
+    // The reload claims the warm instance once it is loaded, which commits its changes, and warms a new instance.
+    // An instance created by the reload would have logged {1, 0} instead.
+    reactNativeHost.Host().ReloadInstance().get();
+    TestCheckEqual(2, *properties.Get(InitCountProperty()));
+    TestCheckEqual(1, *properties.Get(StoreProperty()));
+
+    TestEventService::ObserveEvents({TestEvent{"initialize", JSValueArray{2, 2}}});
+    TestCheckEqual(2, *properties.Get(InitCountProperty()));
+    TestCheckEqual(1, *properties.Get(StoreProperty()));
+  }
+};
+
+} // namespace ReactNativeIntegrationTests
@@ -0,0 +1,4 @@
+import { NativeModules } from 'react-native';
+
+// Accessing TestPoolModule initializes it, which logs the properties seen by this instance.
+NativeModules.TestPoolModule;
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "EagerModuleInitializer.h"
+
+#include <dispatchQueue/dispatchQueue.h>
+
+namespace winrt::Microsoft::ReactNative {
+
+void EagerModuleInitializer::AddModule(
+    std::string const &moduleName,
+    std::vector<std::string> const &dependencies,
+    Mso::VoidFunctor &&construct) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto &module = m_modules[moduleName];
+  module.Construct = std::move(construct);
+  module.Dependencies = dependencies;
+}
+
+void EagerModuleInitializer::Start() noexcept {
+  std::vector<std::string> readyModules;
+  {
+    std::scoped_lock lock{m_mutex};
+    for (auto &entry : m_modules) {
+      for (const auto &dependency : entry.second.Dependencies) {
+        // Only eager modules are waited for: other modules are constructed on their first use.
+        auto it = m_modules.find(dependency);
+        if (it != m_modules.end() && dependency != entry.first) {
+          it->second.Dependents.push_back(entry.first);
+          ++entry.second.PendingDependencyCount;
+        }
+      }
+    }
+
+    // Modules with circular dependencies are never ready, and are constructed on their first use.
+    for (const auto &entry : m_modules) {
+      if (entry.second.PendingDependencyCount == 0) {
+        readyModules.push_back(entry.first);
+      }
+    }
+  }
+
+  for (const auto &moduleName : readyModules) {
+    PostConstruct(moduleName);
+  }
+}
+
+void EagerModuleInitializer::EnsureConstructed(std::string const &moduleName) noexcept {
+  if (TryConstruct(moduleName)) {
+    return;
+  }
+
+  std::unique_lock lock{m_mutex};
+  auto it = m_modules.find(moduleName);
+  if (it != m_modules.end()) {
+    m_moduleConstructed.wait(lock, [&module = it->second]() { return module.State == ModuleState::Constructed; });
+  }
+}
+
+void EagerModuleInitializer::PostConstruct(std::string const &moduleName) noexcept {
+  Mso::DispatchQueue::ConcurrentQueue().Post([weakThis = weak_from_this(), moduleName]() noexcept {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->TryConstruct(moduleName);
+    }
+  });
+}
+
+bool EagerModuleInitializer::TryConstruct(std::string const &moduleName) noexcept {
+  Mso::VoidFunctor construct;
+  {
+    std::scoped_lock lock{m_mutex};
+    auto it = m_modules.find(moduleName);
+    if (it == m_modules.end() || it->second.State != ModuleState::Pending) {
+      return false;
+    }
+
+    it->second.State = ModuleState::Constructing;
+    construct = std::move(it->second.Construct);
+  }
+
+  construct();
+
+  std::vector<std::string> readyModules;
+  {
+    std::scoped_lock lock{m_mutex};
+    auto &module = m_modules[moduleName];
+    module.State = ModuleState::Constructed;
+    for (const auto &dependent : module.Dependents) {
+      auto &dependentModule = m_modules[dependent];
+      if (--dependentModule.PendingDependencyCount == 0 && dependentModule.State == ModuleState::Pending) {
+        readyModules.push_back(dependent);
+      }
+    }
+  }
+
+  m_moduleConstructed.notify_all();
+  for (const auto &dependent : readyModules) {
+    PostConstruct(dependent);
+  }
+
+  return true;
+}
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+
+#include <functional/functor.h>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+
+// Constructs native modules on the concurrent queue while the JavaScript bundle loads.
+// A module is constructed after the eager modules it depends on.
+// If a module is requested before its construction started, it is constructed on the requesting thread instead,
+// so a request only waits for the module it needs.
+class EagerModuleInitializer final : public std::enable_shared_from_this<EagerModuleInitializer> {
+ public:
+  void AddModule(
+      std::string const &moduleName,
+      std::vector<std::string> const &dependencies,
+      Mso::VoidFunctor &&construct) noexcept;
+
+  // Starts constructing the modules that have no pending dependencies. Modules cannot be added after that.
+  void Start() noexcept;
+
+  // Returns after the module is constructed.
+  void EnsureConstructed(std::string const &moduleName) noexcept;
+
+ private:
+  enum class ModuleState {
+    Pending,
+    Constructing,
+    Constructed,
+  };
+
+  struct Module {
+    Mso::VoidFunctor Construct;
+    std::vector<std::string> Dependencies;
+    std::vector<std::string> Dependents;
+    size_t PendingDependencyCount{0};
+    ModuleState State{ModuleState::Pending};
+  };
+
+  void PostConstruct(std::string const &moduleName) noexcept;
+  bool TryConstruct(std::string const &moduleName) noexcept;
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_moduleConstructed;
+  std::map<std::string, Module> m_modules;
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -191,6 +191,91 @@ IInspectable ReactPropertyBag::Set(IReactPropertyName const &propertyName, IInsp
   return result;
 }
 
+StagedReactPropertyBag::StagedReactPropertyBag(IReactPropertyBag const &parent) noexcept : m_parent{parent} {}
+
+IInspectable StagedReactPropertyBag::Get(IReactPropertyName const &propertyName) noexcept {
+  std::unique_lock lock{m_mutex};
+  if (m_isCommitted) {
+    lock.unlock();
+    return m_parent.Get(propertyName);
+  }
+
+  auto it = m_entries.find(propertyName);
+  if (it != m_entries.end()) {
+    return it->second;
+  }
+
+  // The parent property bag never calls back into this one, so it is safe to read it under the lock.
+  auto parentIt = m_parentEntries.find(propertyName);
+  if (parentIt == m_parentEntries.end()) {
+    parentIt = m_parentEntries.emplace(propertyName, m_parent.Get(propertyName)).first;
+  }
+
+  return parentIt->second;
+}
+
+IInspectable StagedReactPropertyBag::GetOrCreate(
+    IReactPropertyName const &propertyName,
+    ReactCreatePropertyValue const &createValue) noexcept {
+  {
+    std::unique_lock lock{m_mutex};
+    if (m_isCommitted) {
+      lock.unlock();
+      return m_parent.GetOrCreate(propertyName, createValue);
+    }
+
+    auto it = m_entries.find(propertyName);
+    if (it != m_entries.end() && it->second) {
+      return it->second;
+    }
+  }
+
+  IInspectable newValue = createValue();
+  std::unique_lock lock{m_mutex};
+  if (m_isCommitted) {
+    lock.unlock();
+    return m_parent.GetOrCreate(propertyName, [&newValue]() { return newValue; });
+  }
+
+  auto &entry = m_entries[propertyName];
+  if (!entry) {
+    entry = std::move(newValue);
+  }
+
+  return entry;
+}
+
+IInspectable StagedReactPropertyBag::Set(IReactPropertyName const &propertyName, IInspectable const &value) noexcept {
+  std::unique_lock lock{m_mutex};
+  if (m_isCommitted) {
+    lock.unlock();
+    return m_parent.Set(propertyName, value);
+  }
+
+  IInspectable result{nullptr};
+  if (auto it = m_entries.find(propertyName); it != m_entries.end()) {
+    result = std::move(it->second);
+  } else if (auto parentIt = m_parentEntries.find(propertyName); parentIt != m_parentEntries.end()) {
+    result = parentIt->second;
+  } else {
+    result = m_parent.Get(propertyName);
+  }
+
+  m_entries[propertyName] = value;
+  return result;
+}
+
+void StagedReactPropertyBag::Commit() noexcept {
+  std::scoped_lock lock{m_mutex};
+  for (const auto &entry : m_entries) {
+    m_parent.Set(entry.first, entry.second);
+  }
+
+  m_entries.clear();
+  m_parentEntries.clear();
+  m_isCommitted = true;
+}
+
 /*static*/ IReactPropertyNamespace ReactPropertyBagHelper::GlobalNamespace() noexcept {
   return ReactPropertyNamespace::GlobalNamespace().as<IReactPropertyNamespace>();
 }
@@ -18,6 +18,30 @@ struct ReactPropertyBag : implements<ReactPropertyBag, IReactPropertyBag> {
   std::map<IReactPropertyName, IInspectable> m_entries;
 };
 
+// A property bag that keeps its changes apart from a parent property bag until they are committed.
+// Properties that were not changed are copied from the parent property bag when they are first read, so that later
+// changes of the parent are not seen. GetOrCreate never reads the parent: values created on demand belong to the
+// instance that uses this property bag.
+// Commit copies the changes to the parent property bag, and from then on all calls are forwarded to it.
+struct StagedReactPropertyBag : implements<StagedReactPropertyBag, IReactPropertyBag> {
+  StagedReactPropertyBag(IReactPropertyBag const &parent) noexcept;
+
+  IInspectable Get(IReactPropertyName const &name) noexcept;
+  IInspectable GetOrCreate(IReactPropertyName const &name, ReactCreatePropertyValue const &createValue) noexcept;
+  IInspectable Set(IReactPropertyName const &name, IInspectable const &value) noexcept;
+
+  void Commit() noexcept;
+
+ private:
+  const IReactPropertyBag m_parent;
+  std::mutex m_mutex;
+  // Removed properties are kept with a null value to hide the value in the parent property bag.
+  std::map<IReactPropertyName, IInspectable> m_entries;
+  // Values read from the parent property bag. They are not written back on commit.
+  std::map<IReactPropertyName, IInspectable> m_parentEntries;
+  bool m_isCommitted{false};
+};
+
 struct ReactPropertyBagHelper {
   ReactPropertyBagHelper() = default;
 
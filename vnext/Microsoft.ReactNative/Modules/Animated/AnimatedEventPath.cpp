@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "AnimatedEventPath.h"
+
+#include <string_view>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+template <typename TEvent>
+struct EventField {
+  std::string_view Name;
+  std::string_view Member;
+  double TEvent::*Field;
+};
+
+constexpr EventField<ScrollEventData> ScrollEventFields[] = {
+    {"contentOffset", "x", &ScrollEventData::ContentOffsetX},
+    {"contentOffset", "y", &ScrollEventData::ContentOffsetY},
+    {"contentInset", "top", &ScrollEventData::ContentInsetTop},
+    {"contentInset", "left", &ScrollEventData::ContentInsetLeft},
+    {"contentInset", "bottom", &ScrollEventData::ContentInsetBottom},
+    {"contentInset", "right", &ScrollEventData::ContentInsetRight},
+    {"contentSize", "width", &ScrollEventData::ContentSizeWidth},
+    {"contentSize", "height", &ScrollEventData::ContentSizeHeight},
+    {"layoutMeasurement", "width", &ScrollEventData::LayoutMeasurementWidth},
+    {"layoutMeasurement", "height", &ScrollEventData::LayoutMeasurementHeight},
+    {"zoomScale", {}, &ScrollEventData::ZoomScale},
+};
+
+constexpr EventField<PointerEventData> PointerEventFields[] = {
+    {"pageX", {}, &PointerEventData::PageX},
+    {"pageY", {}, &PointerEventData::PageY},
+    {"locationX", {}, &PointerEventData::LocationX},
+    {"locationY", {}, &PointerEventData::LocationY},
+    {"timestamp", {}, &PointerEventData::Timestamp},
+    {"force", {}, &PointerEventData::Force},
+    {"identifier", {}, &PointerEventData::Identifier},
+};
+
+template <typename TEvent, size_t N>
+double TEvent::*FindField(const EventField<TEvent> (&fields)[N], const std::vector<std::string> &path) noexcept {
+  for (const auto &field : fields) {
+    if (path[0] == field.Name &&
+        (field.Member.empty() ? path.size() == 1 : path.size() == 2 && path[1] == field.Member)) {
+      return field.Field;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+/*static*/ std::optional<AnimatedEventPath> AnimatedEventPath::Compile(const std::vector<std::string> &path) {
+  if (path.empty()) {
+    return std::nullopt;
+  }
+
+  AnimatedEventPath compiled;
+  compiled.m_scrollField = FindField(ScrollEventFields, path);
+  compiled.m_pointerField = FindField(PointerEventFields, path);
+  if (!compiled.m_scrollField && !compiled.m_pointerField) {
+    return std::nullopt;
+  }
+  return compiled;
+}
+
+std::optional<double> AnimatedEventPath::Read(const ScrollEventData &event) const noexcept {
+  if (!m_scrollField) {
+    return std::nullopt;
+  }
+  return event.*m_scrollField;
+}
+
+std::optional<double> AnimatedEventPath::Read(const PointerEventData &event) const noexcept {
+  if (!m_pointerField) {
+    return std::nullopt;
+  }
+  return event.*m_pointerField;
+}
+
+} // namespace Microsoft::ReactNative
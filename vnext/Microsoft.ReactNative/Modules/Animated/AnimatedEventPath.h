@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// The numeric fields of the nativeEvent of scroll events, read by animated event drivers without building the JS
+// payload.
+struct ScrollEventData {
+  double ContentOffsetX{0};
+  double ContentOffsetY{0};
+  double ContentInsetTop{0};
+  double ContentInsetLeft{0};
+  double ContentInsetBottom{0};
+  double ContentInsetRight{0};
+  double ContentSizeWidth{0};
+  double ContentSizeHeight{0};
+  double LayoutMeasurementWidth{0};
+  double LayoutMeasurementHeight{0};
+  double ZoomScale{1};
+};
+
+// The numeric fields of the changed pointer of touch events.
+struct PointerEventData {
+  double PageX{0};
+  double PageY{0};
+  double LocationX{0};
+  double LocationY{0};
+  double Timestamp{0};
+  double Force{0};
+  double Identifier{0};
+};
+
+/// <summary>
+/// A nativeEventPath of an animated event mapping, such as ["contentOffset", "y"], resolved once to the field of
+/// the native event data it names.
+/// </summary>
+class AnimatedEventPath {
+ public:
+  // Returns nothing for paths that name no numeric field of the supported native events.
+  static std::optional<AnimatedEventPath> Compile(const std::vector<std::string> &path);
+
+  // Returns nothing when the path names a field of another kind of event.
+  std::optional<double> Read(const ScrollEventData &event) const noexcept;
+  std::optional<double> Read(const PointerEventData &event) const noexcept;
+
+ private:
+  double ScrollEventData::*m_scrollField{nullptr};
+  double PointerEventData::*m_pointerField{nullptr};
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+/// <summary>
+/// Refers to a value in an AnimatedNodeArena. The generation tells handles of erased values from handles of the
+/// values that later reuse their slot.
+/// </summary>
+struct AnimatedNodeHandle {
+  static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+  uint32_t Index{InvalidIndex};
+  uint32_t Generation{0};
+
+  bool IsValid() const noexcept {
+    return Index != InvalidIndex;
+  }
+
+  bool operator==(const AnimatedNodeHandle &other) const noexcept {
+    return Index == other.Index && Generation == other.Generation;
+  }
+
+  bool operator!=(const AnimatedNodeHandle &other) const noexcept {
+    return !(*this == other);
+  }
+};
+
+/// <summary>
+/// Stores the animated nodes of one type densely, and hands out generational handles to them.
+/// </summary>
+/// <remarks>
+/// Values are kept dense: erasing a value moves the last one into its place, so that per frame passes are linear
+/// scans. Handles stay valid across these moves, while pointers and dense indices do not. The nodes themselves are
+/// only contiguous when they are stored by value, as in AnimationGraphEvaluator; NativeAnimatedNodeManager stores
+/// unique_ptrs, since its node classes are polymorphic and handed out by pointer.
+/// </remarks>
+template <typename T>
+class AnimatedNodeArena {
+ public:
+  AnimatedNodeHandle Insert(T &&value) {
+    uint32_t index;
+    if (m_freeSlots.empty()) {
+      index = static_cast<uint32_t>(m_slots.size());
+      m_slots.emplace_back();
+    } else {
+      index = m_freeSlots.back();
+      m_freeSlots.pop_back();
+    }
+
+    auto &slot = m_slots[index];
+    slot.DenseIndex = static_cast<uint32_t>(m_values.size());
+    m_values.push_back(std::move(value));
+    m_valueSlots.push_back(index);
+    return {index, slot.Generation};
+  }
+
+  bool Erase(AnimatedNodeHandle handle) {
+    if (!Get(handle)) {
+      return false;
+    }
+
+    // The erased value is destroyed on return, once the arena is consistent again, in case its destructor looks
+    // up other values.
+    auto &slot = m_slots[handle.Index];
+    const auto denseIndex = slot.DenseIndex;
+    [[maybe_unused]] auto erased = std::move(m_values[denseIndex]);
+    if (denseIndex + 1 != m_values.size()) {
+      m_values[denseIndex] = std::move(m_values.back());
+      m_valueSlots[denseIndex] = m_valueSlots.back();
+      m_slots[m_valueSlots[denseIndex]].DenseIndex = denseIndex;
+    }
+    m_values.pop_back();
+    m_valueSlots.pop_back();
+
+    slot.Generation++;
+    m_freeSlots.push_back(handle.Index);
+    return true;
+  }
+
+  void Clear() {
+    for (const auto index : m_valueSlots) {
+      m_slots[index].Generation++;
+      m_freeSlots.push_back(index);
+    }
+    m_values.clear();
+    m_valueSlots.clear();
+  }
+
+  T *Get(AnimatedNodeHandle handle) noexcept {
+    return const_cast<T *>(static_cast<const AnimatedNodeArena *>(this)->Get(handle));
+  }
+
+  const T *Get(AnimatedNodeHandle handle) const noexcept {
+    if (handle.Index >= m_slots.size()) {
+      return nullptr;
+    }
+
+    // Erasing a value bumps the generation of its slot, so only live values match.
+    const auto &slot = m_slots[handle.Index];
+    return slot.Generation == handle.Generation ? &m_values[slot.DenseIndex] : nullptr;
+  }
+
+  // The position of the value in the dense storage, until the next Insert or Erase.
+  size_t DenseIndex(AnimatedNodeHandle handle) const noexcept {
+    assert(Get(handle));
+    return m_slots[handle.Index].DenseIndex;
+  }
+
+  AnimatedNodeHandle HandleAt(size_t denseIndex) const noexcept {
+    const auto index = m_valueSlots[denseIndex];
+    return {index, m_slots[index].Generation};
+  }
+
+  size_t Size() const noexcept {
+    return m_values.size();
+  }
+
+  T &operator[](size_t denseIndex) noexcept {
+    return m_values[denseIndex];
+  }
+
+  const T &operator[](size_t denseIndex) const noexcept {
+    return m_values[denseIndex];
+  }
+
+  auto begin() noexcept {
+    return m_values.begin();
+  }
+
+  auto end() noexcept {
+    return m_values.end();
+  }
+
+  auto begin() const noexcept {
+    return m_values.begin();
+  }
+
+  auto end() const noexcept {
+    return m_values.end();
+  }
+
+ private:
+  struct Slot {
+    uint32_t Generation{0};
+    uint32_t DenseIndex{0};
+  };
+
+  std::vector<T> m_values;
+
+  // Slot of each value, parallel to m_values.
+  std::vector<uint32_t> m_valueSlots;
+  std::vector<Slot> m_slots;
+  std::vector<uint32_t> m_freeSlots;
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,504 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "AnimationCurveBatch.h"
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define ANIMATION_CURVES_SSE2
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define ANIMATION_CURVES_NEON
+#if defined(_M_ARM64)
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// A small set of lane-wise operations, so that the kernels below are written once for every instruction set.
+#if defined(ANIMATION_CURVES_SSE2)
+
+struct Floats {
+  __m128 v;
+};
+struct Ints {
+  __m128i v;
+};
+struct Mask {
+  __m128 v;
+};
+
+static_assert(AnimationCurveLaneCount == 4);
+
+inline Floats Load(const float *source) noexcept {
+  return {_mm_loadu_ps(source)};
+}
+inline void Store(float *destination, Floats value) noexcept {
+  _mm_storeu_ps(destination, value.v);
+}
+inline Floats Splat(float value) noexcept {
+  return {_mm_set1_ps(value)};
+}
+inline Floats operator+(Floats a, Floats b) noexcept {
+  return {_mm_add_ps(a.v, b.v)};
+}
+inline Floats operator-(Floats a, Floats b) noexcept {
+  return {_mm_sub_ps(a.v, b.v)};
+}
+inline Floats operator*(Floats a, Floats b) noexcept {
+  return {_mm_mul_ps(a.v, b.v)};
+}
+inline Floats Max(Floats a, Floats b) noexcept {
+  return {_mm_max_ps(a.v, b.v)};
+}
+inline Mask Less(Floats a, Floats b) noexcept {
+  return {_mm_cmplt_ps(a.v, b.v)};
+}
+inline Mask LessEqual(Floats a, Floats b) noexcept {
+  return {_mm_cmple_ps(a.v, b.v)};
+}
+inline Mask Greater(Floats a, Floats b) noexcept {
+  return {_mm_cmpgt_ps(a.v, b.v)};
+}
+inline Mask operator&(Mask a, Mask b) noexcept {
+  return {_mm_and_ps(a.v, b.v)};
+}
+inline Floats Select(Mask mask, Floats a, Floats b) noexcept {
+  return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+}
+inline Ints RoundToInt(Floats value) noexcept {
+  return {_mm_cvtps_epi32(value.v)};
+}
+inline Floats ToFloats(Ints value) noexcept {
+  return {_mm_cvtepi32_ps(value.v)};
+}
+inline Floats Pow2(Ints exponent) noexcept {
+  return {_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(exponent.v, _mm_set1_epi32(127)), 23))};
+}
+inline Mask HasBit(Ints value, int32_t bit, int32_t addend = 0) noexcept {
+  const auto bits = _mm_set1_epi32(bit);
+  const auto masked = _mm_and_si128(_mm_add_epi32(value.v, _mm_set1_epi32(addend)), bits);
+  return {_mm_castsi128_ps(_mm_cmpeq_epi32(masked, bits))};
+}
+
+#elif defined(ANIMATION_CURVES_NEON)
+
+struct Floats {
+  float32x4_t v;
+};
+struct Ints {
+  int32x4_t v;
+};
+struct Mask {
+  uint32x4_t v;
+};
+
+static_assert(AnimationCurveLaneCount == 4);
+
+inline Floats Load(const float *source) noexcept {
+  return {vld1q_f32(source)};
+}
+inline void Store(float *destination, Floats value) noexcept {
+  vst1q_f32(destination, value.v);
+}
+inline Floats Splat(float value) noexcept {
+  return {vdupq_n_f32(value)};
+}
+inline Floats operator+(Floats a, Floats b) noexcept {
+  return {vaddq_f32(a.v, b.v)};
+}
+inline Floats operator-(Floats a, Floats b) noexcept {
+  return {vsubq_f32(a.v, b.v)};
+}
+inline Floats operator*(Floats a, Floats b) noexcept {
+  return {vmulq_f32(a.v, b.v)};
+}
+inline Floats Max(Floats a, Floats b) noexcept {
+  return {vmaxq_f32(a.v, b.v)};
+}
+inline Mask Less(Floats a, Floats b) noexcept {
+  return {vcltq_f32(a.v, b.v)};
+}
+inline Mask LessEqual(Floats a, Floats b) noexcept {
+  return {vcleq_f32(a.v, b.v)};
+}
+inline Mask Greater(Floats a, Floats b) noexcept {
+  return {vcgtq_f32(a.v, b.v)};
+}
+inline Mask operator&(Mask a, Mask b) noexcept {
+  return {vandq_u32(a.v, b.v)};
+}
+inline Floats Select(Mask mask, Floats a, Floats b) noexcept {
+  return {vbslq_f32(mask.v, a.v, b.v)};
+}
+inline Ints RoundToInt(Floats value) noexcept {
+  return {vcvtnq_s32_f32(value.v)};
+}
+inline Floats ToFloats(Ints value) noexcept {
+  return {vcvtq_f32_s32(value.v)};
+}
+inline Floats Pow2(Ints exponent) noexcept {
+  return {vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(exponent.v, vdupq_n_s32(127)), 23))};
+}
+inline Mask HasBit(Ints value, int32_t bit, int32_t addend = 0) noexcept {
+  const auto bits = vdupq_n_s32(bit);
+  return {vceqq_s32(vandq_s32(vaddq_s32(value.v, vdupq_n_s32(addend)), bits), bits)};
+}
+
+#else
+
+// Portable fallback, one lane at a time. It uses the same approximations as the vector versions.
+struct Floats {
+  float v;
+};
+struct Ints {
+  int32_t v;
+};
+struct Mask {
+  bool v;
+};
+
+inline Floats Load(const float *source) noexcept {
+  return {*source};
+}
+inline void Store(float *destination, Floats value) noexcept {
+  *destination = value.v;
+}
+inline Floats Splat(float value) noexcept {
+  return {value};
+}
+inline Floats operator+(Floats a, Floats b) noexcept {
+  return {a.v + b.v};
+}
+inline Floats operator-(Floats a, Floats b) noexcept {
+  return {a.v - b.v};
+}
+inline Floats operator*(Floats a, Floats b) noexcept {
+  return {a.v * b.v};
+}
+inline Floats Max(Floats a, Floats b) noexcept {
+  return {a.v > b.v ? a.v : b.v};
+}
+inline Mask Less(Floats a, Floats b) noexcept {
+  return {a.v < b.v};
+}
+inline Mask LessEqual(Floats a, Floats b) noexcept {
+  return {a.v <= b.v};
+}
+inline Mask Greater(Floats a, Floats b) noexcept {
+  return {a.v > b.v};
+}
+inline Mask operator&(Mask a, Mask b) noexcept {
+  return {a.v && b.v};
+}
+inline Floats Select(Mask mask, Floats a, Floats b) noexcept {
+  return mask.v ? a : b;
+}
+inline Ints RoundToInt(Floats value) noexcept {
+  return {static_cast<int32_t>(std::nearbyint(value.v))};
+}
+inline Floats ToFloats(Ints value) noexcept {
+  return {static_cast<float>(value.v)};
+}
+inline Floats Pow2(Ints exponent) noexcept {
+  const auto bits = static_cast<uint32_t>(exponent.v + 127) << 23;
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return {value};
+}
+inline Mask HasBit(Ints value, int32_t bit, int32_t addend = 0) noexcept {
+  return {((value.v + addend) & bit) != 0};
+}
+
+#endif
+
+#if defined(ANIMATION_CURVES_SSE2) || defined(ANIMATION_CURVES_NEON)
+constexpr size_t KernelWidth = AnimationCurveLaneCount;
+#else
+constexpr size_t KernelWidth = 1;
+#endif
+
+inline Floats Negate(Mask mask, Floats value) noexcept {
+  return Select(mask, Splat(0.0f) - value, value);
+}
+
+// e^x for x <= 0. The exp2 polynomial on [-0.5, 0.5] is accurate to float precision; arguments below -87 flush to
+// the smallest normal float, which is zero for animation purposes.
+inline Floats ExpNonPositive(Floats x) noexcept {
+  const auto scaled = Max(x, Splat(-87.0f)) * Splat(1.44269504f);
+  const auto exponent = RoundToInt(scaled);
+  const auto fraction = scaled - ToFloats(exponent);
+
+  auto result = Splat(1.535336188e-4f);
+  result = result * fraction + Splat(1.339887440e-3f);
+  result = result * fraction + Splat(9.618437357e-3f);
+  result = result * fraction + Splat(5.550332471e-2f);
+  result = result * fraction + Splat(2.402264791e-1f);
+  result = result * fraction + Splat(6.931472028e-1f);
+  result = result * fraction + Splat(1.0f);
+  return result * Pow2(exponent);
+}
+
+// Sine and cosine of x, reduced to [-pi/4, pi/4] around the nearest multiple of pi/2.
+inline void SinCos(Floats x, Floats &sin, Floats &cos) noexcept {
+  const auto quadrant = RoundToInt(x * Splat(0.636619772f));
+  const auto q = ToFloats(quadrant);
+
+  // pi/2 split in three parts, so that the reduction stays exact for the multiples used here.
+  const auto r = x - q * Splat(1.5703125f) - q * Splat(4.837512969970703125e-4f) - q * Splat(7.54978995489188216e-8f);
+  const auto z = r * r;
+
+  auto s = Splat(-1.9515295891e-4f);
+  s = s * z + Splat(8.3321608736e-3f);
+  s = s * z + Splat(-1.6666654611e-1f);
+  s = s * z * r + r;
+
+  auto c = Splat(2.443315711809948e-5f);
+  c = c * z + Splat(-1.388731625493765e-3f);
+  c = c * z + Splat(4.166664568298827e-2f);
+  c = c * z * z - Splat(0.5f) * z + Splat(1.0f);
+
+  // Quadrants 1 and 3 swap sine and cosine. The sine is negative in quadrants 2 and 3, the cosine in 1 and 2.
+  const auto swap = HasBit(quadrant, 1);
+  sin = Negate(HasBit(quadrant, 2), Select(swap, c, s));
+  cos = Negate(HasBit(quadrant, 2, 1), Select(swap, s, c));
+}
+
+size_t PaddedSize(size_t size) noexcept {
+  return (size + AnimationCurveLaneCount - 1) / AnimationCurveLaneCount * AnimationCurveLaneCount;
+}
+
+} // namespace
+
+#pragma region SpringCurveBatch
+
+size_t SpringCurveBatch::Size() const noexcept {
+  return m_size;
+}
+
+void SpringCurveBatch::Clear() noexcept {
+  Resize(0);
+}
+
+void SpringCurveBatch::Resize(size_t size) {
+  m_size = size;
+  const auto paddedSize = PaddedSize(size);
+  m_startValues.resize(size);
+  m_initialVelocities.resize(size);
+  m_toValues.resize(size);
+
+  // Padding lanes evaluate to a constant zero.
+  for (auto *lanes : {&m_rates, &m_frequencies, &m_a, &m_b, &m_c, &m_times, &m_displacements, &m_velocities}) {
+    lanes->resize(paddedSize, 0.0f);
+    std::fill(lanes->begin() + size, lanes->end(), 0.0f);
+  }
+}
+
+size_t SpringCurveBatch::Add(const SpringAnimationConfig &config, double startValue, double toValue) {
+  const auto index = m_size;
+  Resize(m_size + 1);
+
+  const auto zeta = config.Damping / (2 * std::sqrt(config.Stiffness * config.Mass));
+  const auto omega0 = std::sqrt(config.Stiffness / config.Mass);
+  if (zeta < 1) {
+    m_rates[index] = static_cast<float>(zeta * omega0);
+    m_frequencies[index] = static_cast<float>(omega0 * std::sqrt(1.0 - zeta * zeta));
+  } else {
+    m_rates[index] = static_cast<float>(omega0);
+    m_frequencies[index] = 0.0f;
+  }
+
+  m_startValues[index] = startValue;
+  m_initialVelocities[index] = -config.InitialVelocity;
+  SetToValue(index, toValue);
+  return index;
+}
+
+void SpringCurveBatch::SetToValue(size_t index, double toValue) noexcept {
+  m_toValues[index] = toValue;
+  UpdateCoefficients(index);
+}
+
+void SpringCurveBatch::SetTime(size_t index, double time) noexcept {
+  m_times[index] = static_cast<float>(time);
+}
+
+void SpringCurveBatch::UpdateCoefficients(size_t index) noexcept {
+  const double rate = m_rates[index];
+  const double frequency = m_frequencies[index];
+  const auto x0 = m_toValues[index] - m_startValues[index];
+  const auto k = m_initialVelocities[index] + rate * x0;
+
+  m_a[index] = frequency > 0 ? static_cast<float>(k / frequency) : 0.0f;
+  m_b[index] = static_cast<float>(x0);
+  m_c[index] = frequency > 0 ? 0.0f : static_cast<float>(k);
+}
+
+void SpringCurveBatch::Evaluate() noexcept {
+  const auto size = PaddedSize(m_size);
+  for (size_t i = 0; i < size; i += KernelWidth) {
+    const auto time = Load(&m_times[i]);
+    const auto rate = Load(&m_rates[i]);
+    const auto frequency = Load(&m_frequencies[i]);
+    const auto a = Load(&m_a[i]);
+    const auto b = Load(&m_b[i]);
+    const auto c = Load(&m_c[i]);
+
+    const auto envelope = ExpNonPositive(Splat(0.0f) - rate * time);
+    Floats sin, cos;
+    SinCos(frequency * time, sin, cos);
+
+    // displacement = -envelope * p, so velocity = envelope * (rate * p - dp/dt).
+    const auto p = a * sin + b * cos + c * time;
+    const auto dp = frequency * (a * cos - b * sin) + c;
+    Store(&m_displacements[i], Splat(0.0f) - envelope * p);
+    Store(&m_velocities[i], envelope * (rate * p - dp));
+  }
+}
+
+AnimationSample SpringCurveBatch::Sample(size_t index) const noexcept {
+  return {m_toValues[index] + m_displacements[index], m_velocities[index]};
+}
+
+#pragma endregion SpringCurveBatch
+
+#pragma region InterpolationCurveBatch
+
+size_t InterpolationCurveBatch::Size() const noexcept {
+  return m_size;
+}
+
+void InterpolationCurveBatch::Clear() noexcept {
+  m_segments.clear();
+  Resize(0);
+}
+
+void InterpolationCurveBatch::Resize(size_t size) {
+  m_size = size;
+  const auto paddedSize = PaddedSize(size);
+  for (auto &segment : m_segments) {
+    for (auto *lanes : {&segment.InputMin, &segment.InputMax, &segment.OutputMin, &segment.Slope}) {
+      lanes->resize(paddedSize, 0.0f);
+    }
+  }
+  for (auto *lanes :
+       {&m_leftIdentity,
+        &m_leftClamp,
+        &m_rightIdentity,
+        &m_rightClamp,
+        &m_firstOutputs,
+        &m_lastOutputs,
+        &m_inputs,
+        &m_outputs}) {
+    lanes->resize(paddedSize, 0.0f);
+  }
+}
+
+size_t InterpolationCurveBatch::Add(
+    const std::vector<double> &inputRange,
+    const std::vector<double> &outputRange,
+    ExtrapolationType extrapolateLeft,
+    ExtrapolationType extrapolateRight) {
+  const auto index = m_size;
+  Resize(m_size + 1);
+
+  // Invalid ranges map every input to itself, like InterpolationAnimatedNode.
+  const auto isValid = inputRange.size() >= 2 && outputRange.size() >= inputRange.size();
+  const auto segmentCount = isValid ? inputRange.size() - 1 : 1;
+
+  // Lanes with fewer segments repeat their last one.
+  while (m_segments.size() < segmentCount) {
+    m_segments.push_back(m_segments.empty() ? Segment{} : m_segments.back());
+    if (m_segments.size() == 1) {
+      Resize(m_size);
+    }
+  }
+
+  for (size_t k = 0; k < m_segments.size(); k++) {
+    auto &segment = m_segments[k];
+    if (!isValid) {
+      segment.InputMin[index] = 0.0f;
+      segment.InputMax[index] = 1.0f;
+      segment.OutputMin[index] = 0.0f;
+      segment.Slope[index] = 1.0f;
+      continue;
+    }
+
+    const auto i = std::min(k, segmentCount - 1);
+    const auto inputMin = inputRange[i];
+    const auto inputMax = inputRange[i + 1];
+    segment.InputMin[index] = static_cast<float>(inputMin);
+    segment.InputMax[index] = static_cast<float>(inputMax);
+    segment.OutputMin[index] = static_cast<float>(outputRange[i]);
+    segment.Slope[index] =
+        inputMin != inputMax ? static_cast<float>((outputRange[i + 1] - outputRange[i]) / (inputMax - inputMin)) : 0.0f;
+  }
+
+  // Extending an empty last segment jumps to its output, which is what clamping to the last output does.
+  const auto isLastSegmentEmpty = isValid && inputRange[segmentCount - 1] == inputRange[segmentCount];
+  const auto rightMode = isLastSegmentEmpty && extrapolateRight == ExtrapolationType::Extend
+      ? ExtrapolationType::Clamp
+      : extrapolateRight;
+
+  m_leftIdentity[index] = isValid && extrapolateLeft == ExtrapolationType::Identity ? 1.0f : 0.0f;
+  m_leftClamp[index] = isValid && extrapolateLeft == ExtrapolationType::Clamp ? 1.0f : 0.0f;
+  m_rightIdentity[index] = isValid && rightMode == ExtrapolationType::Identity ? 1.0f : 0.0f;
+  m_rightClamp[index] = isValid && rightMode == ExtrapolationType::Clamp ? 1.0f : 0.0f;
+  m_firstOutputs[index] = isValid ? static_cast<float>(outputRange.front()) : 0.0f;
+  m_lastOutputs[index] = isValid ? static_cast<float>(outputRange.back()) : 0.0f;
+  return index;
+}
+
+void InterpolationCurveBatch::SetInput(size_t index, double input) noexcept {
+  m_inputs[index] = static_cast<float>(input);
+}
+
+void InterpolationCurveBatch::Evaluate() noexcept {
+  if (m_segments.empty()) {
+    return;
+  }
+
+  const auto size = PaddedSize(m_size);
+  const auto half = Splat(0.5f);
+  for (size_t i = 0; i < size; i += KernelWidth) {
+    const auto input = Load(&m_inputs[i]);
+
+    // Walk the segments from the last one, which also extends past the end of the range, to the first one.
+    const auto &last = m_segments.back();
+    auto output = Load(&last.OutputMin[i]) + Load(&last.Slope[i]) * (input - Load(&last.InputMin[i]));
+    for (size_t k = m_segments.size() - 1; k-- > 0;) {
+      const auto &segment = m_segments[k];
+      const auto inputMin = Load(&segment.InputMin[i]);
+      const auto value = Load(&segment.OutputMin[i]) + Load(&segment.Slope[i]) * (input - inputMin);
+      output = Select(LessEqual(input, Load(&segment.InputMax[i])), value, output);
+    }
+
+    const auto isLeft = Less(input, Load(&m_segments.front().InputMin[i]));
+    output = Select(isLeft & Greater(Load(&m_leftIdentity[i]), half), input, output);
+    output = Select(isLeft & Greater(Load(&m_leftClamp[i]), half), Load(&m_firstOutputs[i]), output);
+
+    const auto isRight = Greater(input, Load(&last.InputMax[i]));
+    output = Select(isRight & Greater(Load(&m_rightIdentity[i]), half), input, output);
+    output = Select(isRight & Greater(Load(&m_rightClamp[i]), half), Load(&m_lastOutputs[i]), output);
+
+    Store(&m_outputs[i], output);
+  }
+}
+
+double InterpolationCurveBatch::Output(size_t index) const noexcept {
+  return m_outputs[index];
+}
+
+#pragma endregion InterpolationCurveBatch
+
+} // namespace Microsoft::ReactNative
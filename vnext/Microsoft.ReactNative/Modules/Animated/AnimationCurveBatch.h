@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <vector>
+#include "AnimationCurves.h"
+#include "ExtrapolationType.h"
+
+namespace Microsoft::ReactNative {
+
+// Number of curves evaluated together by the batch kernels. Batches are padded to a multiple of it.
+constexpr size_t AnimationCurveLaneCount = 4;
+
+/// <summary>
+/// Evaluates many springs at once, in structure-of-arrays form. The displacement of each spring is computed in single
+/// precision, then added to its to value in double precision.
+/// </summary>
+/// <remarks>
+/// The kernel uses SSE2 or NEON where available, and polynomial approximations of exp, sin and cos. Results stay
+/// within about 1e-4 of the displacement of each spring from EvaluateSpring, which is well below what a frame can
+/// show. Springs are added once, then their times (and to values, for springs tracking another animation) are
+/// updated before each Evaluate.
+/// </remarks>
+class SpringCurveBatch {
+ public:
+  size_t Size() const noexcept;
+  void Clear() noexcept;
+
+  // Returns the index of the spring in the batch.
+  size_t Add(const SpringAnimationConfig &config, double startValue, double toValue);
+  void SetToValue(size_t index, double toValue) noexcept;
+  void SetTime(size_t index, double time) noexcept;
+
+  void Evaluate() noexcept;
+  AnimationSample Sample(size_t index) const noexcept;
+
+ private:
+  void UpdateCoefficients(size_t index) noexcept;
+  void Resize(size_t size);
+
+  size_t m_size{0};
+
+  // Per spring parameters, kept to recompute the coefficients when the to value changes.
+  std::vector<double> m_startValues;
+  std::vector<double> m_initialVelocities;
+
+  // The to values stay in double precision: single precision cannot represent the small displacements of a spring
+  // coming to rest at large values, which would then never reach its rest threshold.
+  std::vector<double> m_toValues;
+
+  // The displacement from ToValue at time t is -exp(-Rate * t) * (A * sin(Frequency * t) + B * cos(Frequency * t) +
+  // C * t), which covers both the underdamped (C = 0) and the critically damped or overdamped (Frequency = 0) spring.
+  std::vector<float> m_rates;
+  std::vector<float> m_frequencies;
+  std::vector<float> m_a;
+  std::vector<float> m_b;
+  std::vector<float> m_c;
+  std::vector<float> m_times;
+  std::vector<float> m_displacements;
+  std::vector<float> m_velocities;
+};
+
+/// <summary>
+/// Evaluates many interpolations at once, in single precision and structure-of-arrays form.
+/// </summary>
+/// <remarks>
+/// Segment k of every interpolation is stored contiguously. Interpolations with fewer segments than the longest
+/// one repeat their last segment, so that every lane can test every segment without branching.
+/// </remarks>
+class InterpolationCurveBatch {
+ public:
+  size_t Size() const noexcept;
+  void Clear() noexcept;
+
+  // Returns the index of the interpolation in the batch.
+  size_t Add(
+      const std::vector<double> &inputRange,
+      const std::vector<double> &outputRange,
+      ExtrapolationType extrapolateLeft,
+      ExtrapolationType extrapolateRight);
+  void SetInput(size_t index, double input) noexcept;
+
+  void Evaluate() noexcept;
+  double Output(size_t index) const noexcept;
+
+ private:
+  struct Segment {
+    std::vector<float> InputMin;
+    std::vector<float> InputMax;
+    std::vector<float> OutputMin;
+    std::vector<float> Slope;
+  };
+
+  void Resize(size_t size);
+
+  size_t m_size{0};
+  std::vector<Segment> m_segments;
+
+  // 1 for the lanes using the extrapolation, 0 otherwise.
+  std::vector<float> m_leftIdentity;
+  std::vector<float> m_leftClamp;
+  std::vector<float> m_rightIdentity;
+  std::vector<float> m_rightClamp;
+  std::vector<float> m_firstOutputs;
+  std::vector<float> m_lastOutputs;
+  std::vector<float> m_inputs;
+  std::vector<float> m_outputs;
+};
+
+} // namespace Microsoft::ReactNative
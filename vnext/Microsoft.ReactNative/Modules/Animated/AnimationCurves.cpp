@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <cmath>
+#include "AnimationCurves.h"
+
+namespace Microsoft::ReactNative {
+
+AnimationSample EvaluateSpring(const SpringAnimationConfig &config, double startValue, double toValue, double time) {
+  const auto c = config.Damping;
+  const auto m = config.Mass;
+  const auto k = config.Stiffness;
+  const auto v0 = -config.InitialVelocity;
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
+  const auto x0 = toValue - startValue;
+
+  if (zeta < 1) {
+    const auto envelope = std::exp(-zeta * omega0 * time);
+    const auto sin = std::sin(omega1 * time);
+    const auto cos = std::cos(omega1 * time);
+    const auto value = toValue - envelope * ((v0 + zeta * omega0 * x0) / omega1 * sin + x0 * cos);
+    const auto velocity = zeta * omega0 * envelope * (sin * (v0 + zeta * omega0 * x0) / omega1 + x0 * cos) -
+        envelope * (cos * (v0 + zeta * omega0 * x0) - omega1 * x0 * sin);
+    return {value, velocity};
+  } else {
+    const auto envelope = std::exp(-omega0 * time);
+    const auto value = toValue - envelope * (x0 + (v0 + omega0 * x0) * time);
+    const auto velocity = envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
+    return {value, velocity};
+  }
+}
+
+bool IsSpringDone(const SpringAnimationConfig &config, double startValue, const AnimationSample &sample) {
+  const auto isAtRest = std::abs(sample.Velocity) <= config.RestSpeedThreshold &&
+      (std::abs(sample.Value - config.ToValue) <= config.RestDisplacementThreshold || config.Stiffness == 0);
+  const auto isOvershooting = config.Stiffness > 0 &&
+      ((startValue < config.ToValue && sample.Value > config.ToValue) ||
+       (startValue > config.ToValue && sample.Value < config.ToValue));
+  return isAtRest || (config.OvershootClamping && isOvershooting);
+}
+
+double EvaluateDecay(const DecayAnimationConfig &config, double startValue, double time) {
+  return startValue +
+      config.Velocity / (1 - config.Deceleration) * (1 - std::exp(-(1 - config.Deceleration) * (1000 * time)));
+}
+
+double DecayEndValue(const DecayAnimationConfig &config, double startValue) {
+  return startValue + config.Velocity / (1 - config.Deceleration);
+}
+
+bool IsDecayDone(const DecayAnimationConfig &config, double startValue, double value) {
+  return std::abs(DecayEndValue(config, startValue) - value) < 0.1;
+}
+
+double EvaluateFrames(const std::vector<double> &frames, double startValue, double toValue, double time) {
+  if (IsFramesDone(frames, time)) {
+    return toValue;
+  }
+
+  const auto frame = static_cast<size_t>(time * AnimationFrameRate);
+  return startValue + frames[frame] * (toValue - startValue);
+}
+
+bool IsFramesDone(const std::vector<double> &frames, double time) {
+  return frames.empty() || static_cast<size_t>(time * AnimationFrameRate) + 1 >= frames.size();
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Frame based animations provide one progress value per frame at this rate.
+constexpr double AnimationFrameRate = 60.0;
+
+struct SpringAnimationConfig {
+  double Stiffness{0};
+  double Damping{0};
+  double Mass{0};
+  double InitialVelocity{0};
+  double ToValue{0};
+  double RestSpeedThreshold{0};
+  double RestDisplacementThreshold{0};
+  bool OvershootClamping{false};
+};
+
+struct DecayAnimationConfig {
+  double Deceleration{0};
+  double Velocity{0};
+};
+
+struct AnimationSample {
+  double Value{0};
+  double Velocity{0};
+};
+
+// Closed form position and velocity of a damped spring moving from startValue to toValue.
+AnimationSample EvaluateSpring(const SpringAnimationConfig &config, double startValue, double toValue, double time);
+bool IsSpringDone(const SpringAnimationConfig &config, double startValue, const AnimationSample &sample);
+
+double EvaluateDecay(const DecayAnimationConfig &config, double startValue, double time);
+double DecayEndValue(const DecayAnimationConfig &config, double startValue);
+bool IsDecayDone(const DecayAnimationConfig &config, double startValue, double value);
+
+// The frames hold the progress from startValue to toValue. The last frame is always reported as toValue.
+double EvaluateFrames(const std::vector<double> &frames, double startValue, double toValue, double time);
+bool IsFramesDone(const std::vector<double> &frames, double time);
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,629 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include "AnimationGraphEvaluator.h"
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// Levels with fewer interpolation nodes than this are evaluated one node at a time, in double precision.
+constexpr size_t MinInterpolationBatchSize = AnimationCurveLaneCount;
+
+// Dense index of the inputs that do not exist (yet), which evaluate to zero.
+constexpr uint32_t MissingNode = std::numeric_limits<uint32_t>::max();
+
+double Interpolate(const AnimationGraphEvaluator::InterpolationConfig &config, double value) {
+  const auto &input = config.InputRange;
+  const auto &output = config.OutputRange;
+  if (input.size() < 2 || output.size() < input.size()) {
+    return value;
+  }
+
+  if (value < input.front()) {
+    if (config.ExtrapolateLeft == ExtrapolationType::Identity) {
+      return value;
+    } else if (config.ExtrapolateLeft == ExtrapolationType::Clamp) {
+      return output.front();
+    }
+  } else if (value > input.back()) {
+    if (config.ExtrapolateRight == ExtrapolationType::Identity) {
+      return value;
+    } else if (config.ExtrapolateRight == ExtrapolationType::Clamp) {
+      return output.back();
+    }
+  }
+
+  // Values outside of the input range are extended from the first or last segment.
+  size_t index = 1;
+  while (index < input.size() - 1 && value > input[index]) {
+    index++;
+  }
+
+  const auto inputMin = input[index - 1];
+  const auto inputMax = input[index];
+  const auto outputMin = output[index - 1];
+  const auto outputMax = output[index];
+  if (inputMin == inputMax) {
+    return value <= inputMin ? outputMin : outputMax;
+  }
+  return outputMin + (outputMax - outputMin) * ((value - inputMin) / (inputMax - inputMin));
+}
+
+} // namespace
+
+void AnimationGraphEvaluator::AddValueNode(int64_t tag, double value, double offset) {
+  Node node;
+  node.Value = value;
+  node.Offset = offset;
+  AddNode(tag, std::move(node));
+}
+
+void AnimationGraphEvaluator::AddOperatorNode(int64_t tag, NodeKind kind, std::vector<int64_t> inputs) {
+  assert(
+      kind == NodeKind::Addition || kind == NodeKind::Subtraction || kind == NodeKind::Multiplication ||
+      kind == NodeKind::Division);
+  Node node;
+  node.Kind = kind;
+  node.Inputs = std::move(inputs);
+  AddNode(tag, std::move(node));
+}
+
+void AnimationGraphEvaluator::AddModulusNode(int64_t tag, int64_t input, double modulus) {
+  Node node;
+  node.Kind = NodeKind::Modulus;
+  node.Inputs = {input};
+  node.Modulus = modulus;
+  AddNode(tag, std::move(node));
+}
+
+void AnimationGraphEvaluator::AddDiffClampNode(int64_t tag, int64_t input, double min, double max) {
+  Node node;
+  node.Kind = NodeKind::DiffClamp;
+  node.Inputs = {input};
+  node.Min = min;
+  node.Max = max;
+  AddNode(tag, std::move(node));
+}
+
+void AnimationGraphEvaluator::AddInterpolationNode(int64_t tag, InterpolationConfig config) {
+  Node node;
+  node.Kind = NodeKind::Interpolation;
+  node.Interpolation = std::move(config);
+  AddNode(tag, std::move(node));
+}
+
+void AnimationGraphEvaluator::AddNode(int64_t tag, Node &&node) {
+  node.Tag = tag;
+  node.IsDirty = true;
+  if (const auto existing = FindNode(tag)) {
+    *existing = std::move(node);
+  } else {
+    m_handles[tag] = m_nodes.Insert(std::move(node));
+  }
+  m_isSortDirty = true;
+  m_hasDirtyNodes = true;
+}
+
+void AnimationGraphEvaluator::RemoveNode(int64_t tag) {
+  const auto handle = m_handles.find(tag);
+  if (handle == m_handles.end()) {
+    return;
+  }
+
+  m_nodes.Erase(handle->second);
+  m_handles.erase(handle);
+  for (auto &node : m_nodes) {
+    node.Children.erase(std::remove(node.Children.begin(), node.Children.end(), tag), node.Children.end());
+    if (node.Kind == NodeKind::Interpolation && !node.Inputs.empty() && node.Inputs.front() == tag) {
+      node.Inputs.clear();
+    }
+  }
+
+  for (auto it = m_animations.begin(); it != m_animations.end();) {
+    it = it->second.ValueTag == tag ? m_animations.erase(it) : std::next(it);
+  }
+
+  m_isSortDirty = true;
+  m_isSpringBatchDirty = true;
+}
+
+bool AnimationGraphEvaluator::HasNode(int64_t tag) const {
+  return m_handles.count(tag) > 0;
+}
+
+void AnimationGraphEvaluator::ConnectNodes(int64_t parentTag, int64_t childTag) {
+  const auto parent = FindNode(parentTag);
+  const auto child = FindNode(childTag);
+  if (!parent || !child) {
+    return;
+  }
+
+  auto &children = parent->Children;
+  if (std::find(children.begin(), children.end(), childTag) == children.end()) {
+    children.push_back(childTag);
+  }
+  if (child->Kind == NodeKind::Interpolation) {
+    child->Inputs = {parentTag};
+  }
+
+  MarkDirty(*child);
+  m_isSortDirty = true;
+}
+
+void AnimationGraphEvaluator::DisconnectNodes(int64_t parentTag, int64_t childTag) {
+  const auto parent = FindNode(parentTag);
+  if (!parent) {
+    return;
+  }
+
+  auto &children = parent->Children;
+  children.erase(std::remove(children.begin(), children.end(), childTag), children.end());
+
+  if (const auto child = FindNode(childTag)) {
+    if (child->Kind == NodeKind::Interpolation) {
+      child->Inputs.clear();
+    }
+    MarkDirty(*child);
+  }
+
+  m_isSortDirty = true;
+}
+
+void AnimationGraphEvaluator::SetNodeValue(int64_t tag, double value) {
+  if (const auto node = FindNode(tag)) {
+    SetRawValue(*node, value);
+  }
+}
+
+void AnimationGraphEvaluator::SetNodeOffset(int64_t tag, double offset) {
+  const auto node = FindNode(tag);
+  if (node && node->Offset != offset) {
+    node->Offset = offset;
+    MarkDirty(*node);
+  }
+}
+
+void AnimationGraphEvaluator::FlattenNodeOffset(int64_t tag) {
+  if (const auto node = FindNode(tag)) {
+    node->Value += node->Offset;
+    node->Offset = 0;
+  }
+}
+
+void AnimationGraphEvaluator::ExtractNodeOffset(int64_t tag) {
+  if (const auto node = FindNode(tag)) {
+    node->Offset += node->Value;
+    node->Value = 0;
+  }
+}
+
+double AnimationGraphEvaluator::GetNodeValue(int64_t tag) {
+  Update();
+  const auto node = FindNode(tag);
+  return node ? node->Output : 0.0;
+}
+
+double AnimationGraphEvaluator::GetNodeRawValue(int64_t tag) const {
+  const auto node = FindNode(tag);
+  return node ? node->Value : 0.0;
+}
+
+AnimationGraphEvaluator::Node *AnimationGraphEvaluator::FindNode(int64_t tag) {
+  const auto handle = m_handles.find(tag);
+  return handle != m_handles.end() ? m_nodes.Get(handle->second) : nullptr;
+}
+
+const AnimationGraphEvaluator::Node *AnimationGraphEvaluator::FindNode(int64_t tag) const {
+  const auto handle = m_handles.find(tag);
+  return handle != m_handles.end() ? m_nodes.Get(handle->second) : nullptr;
+}
+
+AnimatedNodeHandle AnimationGraphEvaluator::NodeHandle(int64_t tag) const {
+  const auto handle = m_handles.find(tag);
+  return handle != m_handles.end() ? handle->second : AnimatedNodeHandle{};
+}
+
+void AnimationGraphEvaluator::StartSpringAnimation(
+    int64_t animationId,
+    int64_t valueTag,
+    const SpringAnimationConfig &config,
+    int iterations,
+    std::vector<double> dynamicToValues) {
+  Animation animation;
+  animation.Kind = AnimationKind::Spring;
+  animation.ValueTag = valueTag;
+  animation.Value = NodeHandle(valueTag);
+  animation.Iterations = iterations;
+  animation.Spring = config;
+  animation.Frames = std::move(dynamicToValues);
+  animation.ToValue = config.ToValue;
+  m_animations[animationId] = std::move(animation);
+}
+
+void AnimationGraphEvaluator::StartDecayAnimation(
+    int64_t animationId,
+    int64_t valueTag,
+    const DecayAnimationConfig &config,
+    int iterations) {
+  Animation animation;
+  animation.Kind = AnimationKind::Decay;
+  animation.ValueTag = valueTag;
+  animation.Value = NodeHandle(valueTag);
+  animation.Iterations = iterations;
+  animation.Decay = config;
+  m_animations[animationId] = std::move(animation);
+}
+
+void AnimationGraphEvaluator::StartFramesAnimation(
+    int64_t animationId,
+    int64_t valueTag,
+    std::vector<double> frames,
+    double toValue,
+    int iterations) {
+  Animation animation;
+  animation.Kind = AnimationKind::Frames;
+  animation.ValueTag = valueTag;
+  animation.Value = NodeHandle(valueTag);
+  animation.Iterations = iterations;
+  animation.Frames = std::move(frames);
+  animation.ToValue = toValue;
+  m_animations[animationId] = std::move(animation);
+}
+
+bool AnimationGraphEvaluator::StopAnimation(int64_t animationId) {
+  if (!m_animations.erase(animationId)) {
+    return false;
+  }
+
+  m_isSpringBatchDirty = true;
+  return true;
+}
+
+bool AnimationGraphEvaluator::HasActiveAnimations() const {
+  return !m_animations.empty();
+}
+
+void AnimationGraphEvaluator::Step(double time) {
+  m_animatedNodes.clear();
+  PrepareAnimations(time);
+  const auto finishedBegin = m_finishedAnimations.size();
+  for (auto it = m_animations.begin(); it != m_animations.end(); ++it) {
+    auto &animation = it->second;
+    auto &node = *m_nodes.Get(animation.Value);
+    const auto isDone = StepAnimation(animation, node, time);
+    m_animatedNodes.push_back(animation.ValueTag);
+    if (isDone) {
+      if (animation.Iterations != -1 && --animation.Iterations <= 0) {
+        m_finishedAnimations.push_back(it->first);
+        continue;
+      }
+
+      // The next iteration starts over from the original start value.
+      animation.StartTime = time;
+    }
+  }
+
+  for (auto i = finishedBegin; i < m_finishedAnimations.size(); i++) {
+    m_animations.erase(m_finishedAnimations[i]);
+    m_isSpringBatchDirty = true;
+  }
+
+  std::sort(m_animatedNodes.begin(), m_animatedNodes.end());
+  m_animatedNodes.erase(std::unique(m_animatedNodes.begin(), m_animatedNodes.end()), m_animatedNodes.end());
+  Update();
+}
+
+const std::vector<int64_t> &AnimationGraphEvaluator::AnimatedNodes() const {
+  return m_animatedNodes;
+}
+
+std::vector<int64_t> AnimationGraphEvaluator::TakeFinishedAnimations() {
+  return std::exchange(m_finishedAnimations, {});
+}
+
+void AnimationGraphEvaluator::PrepareAnimations(double time) {
+  // Animations start from the value of their node at their first step.
+  for (auto it = m_animations.begin(); it != m_animations.end();) {
+    auto &animation = it->second;
+    const auto node = m_nodes.Get(animation.Value);
+    if (!node) {
+      it = m_animations.erase(it);
+      m_isSpringBatchDirty = true;
+      continue;
+    }
+
+    if (!animation.StartTime) {
+      animation.StartTime = time;
+      animation.StartValue = node->Value;
+      m_isSpringBatchDirty |= animation.Kind == AnimationKind::Spring;
+    }
+    ++it;
+  }
+
+  if (m_isSpringBatchDirty) {
+    m_springs.Clear();
+    for (auto &[animationId, animation] : m_animations) {
+      if (animation.Kind == AnimationKind::Spring) {
+        animation.BatchIndex = m_springs.Add(animation.Spring, animation.StartValue, animation.ToValue);
+      }
+    }
+    m_isSpringBatchDirty = false;
+  }
+
+  if (m_springs.Size() == 0) {
+    return;
+  }
+
+  for (auto &[animationId, animation] : m_animations) {
+    if (animation.Kind != AnimationKind::Spring) {
+      continue;
+    }
+
+    // Springs tracking another animation move their to value along the frames of that animation.
+    const auto elapsed = time - *animation.StartTime;
+    if (!animation.Frames.empty()) {
+      const auto frame = static_cast<size_t>(elapsed * AnimationFrameRate);
+      const auto toValue = frame < animation.Frames.size()
+          ? animation.StartValue + animation.Frames[frame] * (animation.Spring.ToValue - animation.StartValue)
+          : animation.Spring.ToValue;
+      if (toValue != animation.ToValue) {
+        animation.ToValue = toValue;
+        m_springs.SetToValue(animation.BatchIndex, toValue);
+      }
+    }
+    m_springs.SetTime(animation.BatchIndex, elapsed);
+  }
+  m_springs.Evaluate();
+}
+
+bool AnimationGraphEvaluator::StepAnimation(Animation &animation, Node &node, double time) {
+  const auto elapsed = time - *animation.StartTime;
+  switch (animation.Kind) {
+    case AnimationKind::Spring: {
+      // PrepareAnimations has evaluated the spring for this frame.
+      const auto &spring = animation.Spring;
+      const auto sample = m_springs.Sample(animation.BatchIndex);
+      if (IsSpringDone(spring, animation.StartValue, sample)) {
+        SetRawValue(node, spring.Stiffness > 0 ? spring.ToValue : sample.Value);
+        return true;
+      }
+      SetRawValue(node, sample.Value);
+      return false;
+    }
+    case AnimationKind::Decay: {
+      const auto value = EvaluateDecay(animation.Decay, animation.StartValue, elapsed);
+      SetRawValue(node, value);
+      return IsDecayDone(animation.Decay, animation.StartValue, value);
+    }
+    case AnimationKind::Frames:
+      SetRawValue(node, EvaluateFrames(animation.Frames, animation.StartValue, animation.ToValue, elapsed));
+      return IsFramesDone(animation.Frames, elapsed);
+  }
+
+  assert(false);
+  return true;
+}
+
+void AnimationGraphEvaluator::MarkDirty(Node &node) {
+  node.IsDirty = true;
+  m_hasDirtyNodes = true;
+}
+
+void AnimationGraphEvaluator::SetRawValue(Node &node, double value) {
+  if (node.Value != value) {
+    node.Value = value;
+    node.IsDirty = true;
+    m_hasDirtyNodes = true;
+  }
+}
+
+void AnimationGraphEvaluator::SortNodes() {
+  // Resolve the tags of the connections to dense indices, so that Update does not look up any tag.
+  const auto count = m_nodes.Size();
+  const auto denseIndex = [this](int64_t tag) {
+    const auto handle = m_handles.find(tag);
+    return handle != m_handles.end() ? static_cast<uint32_t>(m_nodes.DenseIndex(handle->second)) : MissingNode;
+  };
+
+  // Kahn's algorithm over the connections and the configured inputs of operator nodes.
+  std::vector<std::vector<uint32_t>> successors(count);
+  std::vector<size_t> inDegrees(count, 0);
+  for (uint32_t index = 0; index < count; index++) {
+    auto &node = m_nodes[index];
+    node.ChildIndices.clear();
+    for (const auto child : node.Children) {
+      // ConnectNodes and RemoveNode only leave existing children, but a stale tag must not index out of bounds.
+      const auto childIndex = denseIndex(child);
+      if (childIndex != MissingNode) {
+        node.ChildIndices.push_back(childIndex);
+        successors[index].push_back(childIndex);
+        inDegrees[childIndex]++;
+      }
+    }
+
+    node.InputIndices.clear();
+    for (const auto input : node.Inputs) {
+      const auto inputIndex = denseIndex(input);
+      node.InputIndices.push_back(inputIndex);
+      if (inputIndex != MissingNode) {
+        successors[inputIndex].push_back(index);
+        inDegrees[index]++;
+      }
+    }
+  }
+
+  m_sortedNodes.clear();
+  m_levelEnds.clear();
+  for (uint32_t index = 0; index < count; index++) {
+    if (inDegrees[index] == 0) {
+      m_sortedNodes.push_back(index);
+    }
+  }
+
+  // Each level only depends on the levels before it.
+  for (size_t levelBegin = 0; levelBegin < m_sortedNodes.size();) {
+    const auto levelEnd = m_sortedNodes.size();
+    for (auto i = levelBegin; i < levelEnd; i++) {
+      for (const auto successor : successors[m_sortedNodes[i]]) {
+        if (--inDegrees[successor] == 0) {
+          m_sortedNodes.push_back(successor);
+        }
+      }
+    }
+    m_levelEnds.push_back(levelEnd);
+    levelBegin = levelEnd;
+  }
+
+  // Cycles are not expected from JS. Evaluate the remaining nodes anyway so that they still update.
+  assert(m_sortedNodes.size() == count);
+  for (uint32_t index = 0; index < count; index++) {
+    if (inDegrees[index] > 0) {
+      m_sortedNodes.push_back(index);
+    }
+  }
+  if (m_levelEnds.empty() || m_levelEnds.back() != m_sortedNodes.size()) {
+    m_levelEnds.push_back(m_sortedNodes.size());
+  }
+
+  m_interpolations.resize(m_levelEnds.size());
+  size_t levelBegin = 0;
+  for (size_t level = 0; level < m_levelEnds.size(); level++) {
+    auto &batch = m_interpolations[level];
+    batch.Clear();
+
+    size_t interpolationCount = 0;
+    for (auto i = levelBegin; i < m_levelEnds[level]; i++) {
+      interpolationCount += m_nodes[m_sortedNodes[i]].Kind == NodeKind::Interpolation;
+    }
+
+    const auto isBatched = interpolationCount >= MinInterpolationBatchSize;
+    for (auto i = levelBegin; i < m_levelEnds[level]; i++) {
+      auto &node = m_nodes[m_sortedNodes[i]];
+      node.BatchIndex.reset();
+      if (isBatched && node.Kind == NodeKind::Interpolation) {
+        const auto &config = node.Interpolation;
+        node.BatchIndex =
+            batch.Add(config.InputRange, config.OutputRange, config.ExtrapolateLeft, config.ExtrapolateRight);
+      }
+    }
+    levelBegin = m_levelEnds[level];
+  }
+
+  m_isSortDirty = false;
+}
+
+void AnimationGraphEvaluator::Update() {
+  if (m_isSortDirty) {
+    SortNodes();
+  }
+  if (!m_hasDirtyNodes) {
+    return;
+  }
+
+  m_hasDirtyNodes = false;
+  size_t levelBegin = 0;
+  for (size_t level = 0; level < m_levelEnds.size(); level++) {
+    const auto levelEnd = m_levelEnds[level];
+    auto &batch = m_interpolations[level];
+    auto hasBatchedNodes = false;
+    for (auto i = levelBegin; i < levelEnd; i++) {
+      auto &node = m_nodes[m_sortedNodes[i]];
+      if (!node.IsDirty) {
+        continue;
+      }
+
+      if (node.BatchIndex && !node.InputIndices.empty()) {
+        batch.SetInput(*node.BatchIndex, InputOutput(node.InputIndices.front()));
+        hasBatchedNodes = true;
+        continue;
+      }
+
+      node.IsDirty = false;
+      SetOutput(node, ComputeOutput(node));
+    }
+
+    if (hasBatchedNodes) {
+      batch.Evaluate();
+      for (auto i = levelBegin; i < levelEnd; i++) {
+        auto &node = m_nodes[m_sortedNodes[i]];
+        if (node.IsDirty) {
+          node.IsDirty = false;
+          SetOutput(node, batch.Output(*node.BatchIndex));
+        }
+      }
+    }
+    levelBegin = levelEnd;
+  }
+}
+
+void AnimationGraphEvaluator::SetOutput(Node &node, double output) {
+  if (output != node.Output) {
+    node.Output = output;
+    for (const auto child : node.ChildIndices) {
+      m_nodes[child].IsDirty = true;
+    }
+  }
+}
+
+double AnimationGraphEvaluator::InputOutput(uint32_t index) const {
+  return index != MissingNode ? m_nodes[index].Output : 0.0;
+}
+
+double AnimationGraphEvaluator::ComputeOutput(const Node &node) const {
+  switch (node.Kind) {
+    case NodeKind::Value:
+      return node.Value + node.Offset;
+    case NodeKind::Addition: {
+      auto output = 0.0;
+      for (const auto input : node.InputIndices) {
+        output += InputOutput(input);
+      }
+      return output;
+    }
+    case NodeKind::Subtraction:
+    case NodeKind::Division: {
+      if (node.InputIndices.empty()) {
+        return 0.0;
+      }
+
+      auto output = InputOutput(node.InputIndices.front());
+      for (size_t i = 1; i < node.InputIndices.size(); i++) {
+        const auto value = InputOutput(node.InputIndices[i]);
+        if (node.Kind == NodeKind::Subtraction) {
+          output -= value;
+        } else {
+          // A zero divisor yields zero rather than propagating infinity to the props.
+          output = value != 0 ? output / value : 0.0;
+        }
+      }
+      return output;
+    }
+    case NodeKind::Multiplication: {
+      auto output = 1.0;
+      for (const auto input : node.InputIndices) {
+        output *= InputOutput(input);
+      }
+      return output;
+    }
+    case NodeKind::Modulus:
+      return node.Modulus != 0 ? std::fmod(InputOutput(node.InputIndices.front()), node.Modulus) : 0.0;
+    case NodeKind::DiffClamp:
+      return std::clamp(InputOutput(node.InputIndices.front()), node.Min, node.Max);
+    case NodeKind::Interpolation:
+      return node.InputIndices.empty() ? node.Output
+                                       : Interpolate(node.Interpolation, InputOutput(node.InputIndices.front()));
+  }
+
+  assert(false);
+  return 0.0;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include "AnimatedNodeArena.h"
+#include "AnimationCurveBatch.h"
+#include "AnimationCurves.h"
+#include "ExtrapolationType.h"
+
+namespace Microsoft::ReactNative {
+
+/// <summary>
+/// Evaluates the value and operator nodes of the native animated graph, and the spring, decay and frame
+/// animations driving them, one frame at a time.
+/// </summary>
+/// <remarks>
+/// The evaluator only depends on the standard library so that it can be stepped without a compositor, e.g. in
+/// unit tests. NativeAnimatedNodeManager mirrors its value nodes into it and pumps Step from the rendering loop.
+///
+/// Nodes are stored densely in an AnimatedNodeArena and evaluated in topological order. The order, and the dense
+/// indices of the connections, are only recomputed when nodes or connections change, so that a frame is a linear
+/// pass without tag lookups. Only nodes downstream of a changed value are recomputed.
+///
+/// Springs are evaluated together in a SpringCurveBatch. Nodes are sorted in levels that do not depend on each
+/// other, and levels with enough interpolation nodes evaluate them together in an InterpolationCurveBatch.
+/// </remarks>
+class AnimationGraphEvaluator {
+ public:
+  enum class NodeKind {
+    Value,
+    Addition,
+    Subtraction,
+    Multiplication,
+    Division,
+    Modulus,
+    DiffClamp,
+    Interpolation,
+  };
+
+  struct InterpolationConfig {
+    std::vector<double> InputRange;
+    std::vector<double> OutputRange;
+    ExtrapolationType ExtrapolateLeft{ExtrapolationType::Extend};
+    ExtrapolationType ExtrapolateRight{ExtrapolationType::Extend};
+  };
+
+  void AddValueNode(int64_t tag, double value, double offset);
+
+  // Addition, subtraction, multiplication and division nodes, applied to the inputs in order.
+  void AddOperatorNode(int64_t tag, NodeKind kind, std::vector<int64_t> inputs);
+  void AddModulusNode(int64_t tag, int64_t input, double modulus);
+  void AddDiffClampNode(int64_t tag, int64_t input, double min, double max);
+
+  // The input of an interpolation node is the parent it is connected to.
+  void AddInterpolationNode(int64_t tag, InterpolationConfig config);
+
+  void RemoveNode(int64_t tag);
+  bool HasNode(int64_t tag) const;
+  void ConnectNodes(int64_t parentTag, int64_t childTag);
+  void DisconnectNodes(int64_t parentTag, int64_t childTag);
+
+  void SetNodeValue(int64_t tag, double value);
+  void SetNodeOffset(int64_t tag, double offset);
+  void FlattenNodeOffset(int64_t tag);
+  void ExtractNodeOffset(int64_t tag);
+
+  // Value plus offset of the node, after re-evaluating any stale nodes.
+  double GetNodeValue(int64_t tag);
+  double GetNodeRawValue(int64_t tag) const;
+
+  // An iteration count of -1 repeats the animation until it is stopped. Animations start at the first Step.
+  void StartSpringAnimation(
+      int64_t animationId,
+      int64_t valueTag,
+      const SpringAnimationConfig &config,
+      int iterations,
+      std::vector<double> dynamicToValues = {});
+  void StartDecayAnimation(int64_t animationId, int64_t valueTag, const DecayAnimationConfig &config, int iterations);
+  void StartFramesAnimation(
+      int64_t animationId,
+      int64_t valueTag,
+      std::vector<double> frames,
+      double toValue,
+      int iterations);
+  bool StopAnimation(int64_t animationId);
+  bool HasActiveAnimations() const;
+
+  // Advances the animations to the given time in seconds and re-evaluates the affected nodes.
+  void Step(double time);
+
+  // Value nodes whose raw value was set by an animation during the last Step.
+  const std::vector<int64_t> &AnimatedNodes() const;
+  std::vector<int64_t> TakeFinishedAnimations();
+
+ private:
+  struct Node {
+    int64_t Tag{0};
+    NodeKind Kind{NodeKind::Value};
+    double Value{0};
+    double Offset{0};
+    double Output{0};
+    bool IsDirty{true};
+
+    std::vector<int64_t> Inputs;
+    std::vector<int64_t> Children;
+
+    // Dense indices of Inputs and Children, resolved by SortNodes.
+    std::vector<uint32_t> InputIndices;
+    std::vector<uint32_t> ChildIndices;
+    double Modulus{0};
+    double Min{0};
+    double Max{0};
+    InterpolationConfig Interpolation;
+
+    // Index in the interpolation batch of the node's level, if any.
+    std::optional<size_t> BatchIndex;
+  };
+
+  enum class AnimationKind {
+    Spring,
+    Decay,
+    Frames,
+  };
+
+  struct Animation {
+    AnimationKind Kind{AnimationKind::Frames};
+    int64_t ValueTag{0};
+    AnimatedNodeHandle Value;
+    int Iterations{1};
+    std::optional<double> StartTime;
+    double StartValue{0};
+
+    SpringAnimationConfig Spring;
+    DecayAnimationConfig Decay;
+    std::vector<double> Frames;
+    double ToValue{0};
+
+    // Index in m_springs of started spring animations.
+    size_t BatchIndex{0};
+  };
+
+  void AddNode(int64_t tag, Node &&node);
+  Node *FindNode(int64_t tag);
+  const Node *FindNode(int64_t tag) const;
+  AnimatedNodeHandle NodeHandle(int64_t tag) const;
+  void MarkDirty(Node &node);
+  void SetRawValue(Node &node, double value);
+  void SortNodes();
+  void Update();
+  void SetOutput(Node &node, double output);
+
+  // Starts the animations added since the last step and evaluates the springs for the frame.
+  void PrepareAnimations(double time);
+  double ComputeOutput(const Node &node) const;
+  double InputOutput(uint32_t index) const;
+
+  // Returns whether the current iteration of the animation is done.
+  bool StepAnimation(Animation &animation, Node &node, double time);
+
+  AnimatedNodeArena<Node> m_nodes;
+  std::unordered_map<int64_t, AnimatedNodeHandle> m_handles;
+  std::unordered_map<int64_t, Animation> m_animations;
+
+  // Dense indices of the nodes sorted by level, m_levelEnds[i] being the end of level i in m_sortedNodes.
+  std::vector<uint32_t> m_sortedNodes;
+  std::vector<size_t> m_levelEnds;
+  std::vector<InterpolationCurveBatch> m_interpolations;
+  bool m_isSortDirty{false};
+  bool m_hasDirtyNodes{false};
+  std::vector<int64_t> m_animatedNodes;
+  std::vector<int64_t> m_finishedAnimations;
+  SpringCurveBatch m_springs;
+  bool m_isSpringBatchDirty{false};
+};
+
+} // namespace Microsoft::ReactNative
@@ -4,6 +4,7 @@
 #pragma once
 #include <folly/dynamic.h>
 #include "AnimatedNode.h"
+#include "AnimationCurves.h"
 #include "CalculatedAnimationDriver.h"
 
 namespace Microsoft::ReactNative {
@@ -18,13 +19,14 @@ class DecayAnimationDriver : public CalculatedAnimationDriver {
 
   double ToValue() override;
 
+  static DecayAnimationConfig ParseConfig(const folly::dynamic &config);
+
  protected:
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, double currentVelocity) override;
 
  private:
-  double m_velocity{0};
-  double m_deceleration{0};
+  DecayAnimationConfig m_decay{};
 
   static constexpr std::string_view s_velocityName{"velocity"};
   static constexpr std::string_view s_decelerationName{"deceleration"};
@@ -12,9 +12,11 @@ EventAnimationDriver::EventAnimationDriver(
     int64_t animatedValueTag,
     const std::shared_ptr<NativeAnimatedNodeManager> &manager)
     : m_animatedValueTag(animatedValueTag), m_manager(manager) {
-  for (const auto &path : eventPath) {
-    m_eventPath.push_back(path.getString());
+  std::vector<std::string> path;
+  for (const auto &segment : eventPath) {
+    path.push_back(segment.getString());
   }
+  m_eventPath = AnimatedEventPath::Compile(path);
 }
 
 ValueAnimatedNode *EventAnimationDriver::AnimatedValue() {
@@ -3,6 +3,8 @@
 
 #pragma once
 #include <folly/dynamic.h>
+#include <optional>
+#include "AnimatedEventPath.h"
 #include "AnimatedNode.h"
 #include "ValueAnimatedNode.h"
 
@@ -16,8 +18,18 @@ class EventAnimationDriver {
       const std::shared_ptr<NativeAnimatedNodeManager> &manager);
   ValueAnimatedNode *AnimatedValue();
 
+  int64_t AnimatedValueTag() const noexcept {
+    return m_animatedValueTag;
+  }
+
+  // The mapped field of the native event, or nothing when the path does not name one of its fields.
+  template <typename TEvent>
+  std::optional<double> Read(const TEvent &event) const noexcept {
+    return m_eventPath ? m_eventPath->Read(event) : std::nullopt;
+  }
+
  private:
-  std::vector<std::string> m_eventPath{};
+  std::optional<AnimatedEventPath> m_eventPath{};
   int64_t m_animatedValueTag{};
   std::weak_ptr<NativeAnimatedNodeManager> m_manager{};
 };
@@ -6,15 +6,35 @@
 #include "NativeAnimatedModule.h"
 
 #include <IReactDispatcher.h>
+#include <QuirkSettings.h>
 #include <cxxreact/Instance.h>
 #include <cxxreact/JsArgumentHelpers.h>
 
 namespace Microsoft::ReactNative {
 const char *NativeAnimatedModule::name{"NativeAnimatedModule"};
 
+winrt::Microsoft::ReactNative::ReactPropertyId<
+    winrt::Microsoft::ReactNative::ReactNonAbiValue<std::weak_ptr<NativeAnimatedNodeManager>>>
+NativeAnimatedNodeManagerProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::weak_ptr<NativeAnimatedNodeManager>>>
+      prop{L"ReactNative.NativeAnimated", L"NativeAnimatedNodeManager"};
+  return prop;
+}
+
+std::weak_ptr<NativeAnimatedNodeManager> GetNativeAnimatedNodeManager(const Mso::React::IReactContext &context) {
+  auto v =
+      winrt::Microsoft::ReactNative::ReactPropertyBag(context.Properties()).Get(NativeAnimatedNodeManagerProperty());
+  return v ? v.Value() : std::weak_ptr<NativeAnimatedNodeManager>{};
+}
+
 NativeAnimatedModule::NativeAnimatedModule(Mso::CntPtr<Mso::React::IReactContext> &&context)
     : m_context(std::move(context)) {
-  m_nodesManager = std::make_shared<NativeAnimatedNodeManager>(NativeAnimatedNodeManager());
+  m_nodesManager = std::make_shared<NativeAnimatedNodeManager>(
+      winrt::Microsoft::ReactNative::implementation::QuirkSettings::GetUseCompositionKeyFrameAnimations(
+          winrt::Microsoft::ReactNative::ReactPropertyBag(m_context->Properties())));
+  winrt::Microsoft::ReactNative::ReactPropertyBag(m_context->Properties())
+      .Set(NativeAnimatedNodeManagerProperty(), std::weak_ptr<NativeAnimatedNodeManager>(m_nodesManager));
 }
 
 NativeAnimatedModule::~NativeAnimatedModule() {
@@ -95,4 +95,7 @@ class NativeAnimatedModule final : public facebook::xplat::module::CxxModule {
   std::shared_ptr<NativeAnimatedNodeManager> m_nodesManager{};
   Mso::CntPtr<Mso::React::IReactContext> m_context;
 };
+
+// The node manager of the NativeAnimatedModule of the instance, for views to dispatch their animated events to.
+std::weak_ptr<NativeAnimatedNodeManager> GetNativeAnimatedNodeManager(const Mso::React::IReactContext &context);
 } // namespace Microsoft::ReactNative
@@ -20,71 +20,139 @@
 
 #include "AnimatedNodeType.h"
 #include "AnimationType.h"
+#include "ExtrapolationType.h"
 #include "FacadeType.h"
 
 #include <Modules/NativeUIManager.h>
 #include <Modules/PaperUIManagerModule.h>
 #include <Windows.Foundation.h>
+#include <algorithm>
+#include <optional>
 
 namespace Microsoft::ReactNative {
+
+namespace {
+
+struct NativeAnimatedEvent {
+  std::wstring_view NativeName;
+  std::string_view RegistrationName;
+};
+
+// The events dispatched to DispatchAnimatedEvent, by the name the views emit them with and the name of the prop
+// that JS maps them from.
+constexpr NativeAnimatedEvent NativeAnimatedEvents[] = {
+    {L"topScroll", "onScroll"},
+    {L"topScrollBeginDrag", "onScrollBeginDrag"},
+    {L"topScrollEndDrag", "onScrollEndDrag"},
+    {L"topScrollBeginMomentum", "onMomentumScrollBegin"},
+    {L"topScrollEndMomentum", "onMomentumScrollEnd"},
+    {L"topTouchStart", "onTouchStart"},
+    {L"topTouchMove", "onTouchMove"},
+    {L"topTouchEnd", "onTouchEnd"},
+    {L"topTouchCancel", "onTouchCancel"},
+};
+
+std::optional<uint32_t> NativeAnimatedEventId(std::wstring_view nativeName) noexcept {
+  for (uint32_t id = 0; id < std::size(NativeAnimatedEvents); id++) {
+    if (NativeAnimatedEvents[id].NativeName == nativeName) {
+      return id;
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
+NativeAnimatedNodeManager::NativeAnimatedNodeManager(bool useCompositionKeyFrameAnimations)
+    : m_useCompositionKeyFrameAnimations(useCompositionKeyFrameAnimations) {
+  for (const auto &event : NativeAnimatedEvents) {
+    InternEventName(std::string(event.RegistrationName));
+  }
+}
+
+template <typename TNode, typename TConcreteNode>
+void NativeAnimatedNodeManager::InsertNode(
+    AnimatedNodeArena<std::unique_ptr<TNode>> &arena,
+    NodeStore store,
+    int64_t tag,
+    std::unique_ptr<TConcreteNode> node) {
+  m_nodeSlots.emplace(tag, NodeSlot{store, arena.Insert(std::move(node))});
+}
+
+template <typename TNode>
+TNode *
+NativeAnimatedNodeManager::FindNode(AnimatedNodeArena<std::unique_ptr<TNode>> &arena, NodeStore store, int64_t tag) {
+  const auto slot = m_nodeSlots.find(tag);
+  if (slot == m_nodeSlots.end() || slot->second.Store != store) {
+    return nullptr;
+  }
+
+  const auto node = arena.Get(slot->second.Handle);
+  return node ? node->get() : nullptr;
+}
+
 void NativeAnimatedNodeManager::CreateAnimatedNode(
     int64_t tag,
     const folly::dynamic &config,
     const Mso::CntPtr<Mso::React::IReactContext> &context,
     const std::shared_ptr<NativeAnimatedNodeManager> &manager) {
-  if (m_transformNodes.count(tag) > 0 || m_propsNodes.count(tag) > 0 || m_styleNodes.count(tag) > 0 ||
-      m_valueNodes.count(tag) > 0) {
+  if (m_nodeSlots.count(tag) > 0) {
     throw std::invalid_argument("AnimatedNode with tag " + std::to_string(tag) + " already exists.");
     return;
   }
 
   switch (const auto type = AnimatedNodeTypeFromString(config.find("type").dereference().second.getString())) {
     case AnimatedNodeType::Style: {
-      m_styleNodes.emplace(tag, std::make_unique<StyleAnimatedNode>(tag, config, manager));
+      InsertNode(m_styleNodes, NodeStore::Style, tag, std::make_unique<StyleAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Value: {
-      m_valueNodes.emplace(tag, std::make_unique<ValueAnimatedNode>(tag, config, manager));
+      InsertNode(m_valueNodes, NodeStore::Value, tag, std::make_unique<ValueAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Props: {
-      m_propsNodes.emplace(tag, std::make_unique<PropsAnimatedNode>(tag, config, context, manager));
+      InsertNode(
+          m_propsNodes, NodeStore::Props, tag, std::make_unique<PropsAnimatedNode>(tag, config, context, manager));
       break;
     }
     case AnimatedNodeType::Interpolation: {
-      m_valueNodes.emplace(tag, std::make_unique<InterpolationAnimatedNode>(tag, config, manager));
+      InsertNode(
+          m_valueNodes, NodeStore::Value, tag, std::make_unique<InterpolationAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Addition: {
-      m_valueNodes.emplace(tag, std::make_unique<AdditionAnimatedNode>(tag, config, manager));
+      InsertNode(m_valueNodes, NodeStore::Value, tag, std::make_unique<AdditionAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Subtraction: {
-      m_valueNodes.emplace(tag, std::make_unique<SubtractionAnimatedNode>(tag, config, manager));
+      InsertNode(m_valueNodes, NodeStore::Value, tag, std::make_unique<SubtractionAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Division: {
-      m_valueNodes.emplace(tag, std::make_unique<DivisionAnimatedNode>(tag, config, manager));
+      InsertNode(m_valueNodes, NodeStore::Value, tag, std::make_unique<DivisionAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Multiplication: {
-      m_valueNodes.emplace(tag, std::make_unique<MultiplicationAnimatedNode>(tag, config, manager));
+      InsertNode(
+          m_valueNodes, NodeStore::Value, tag, std::make_unique<MultiplicationAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Modulus: {
-      m_valueNodes.emplace(tag, std::make_unique<ModulusAnimatedNode>(tag, config, manager));
+      InsertNode(m_valueNodes, NodeStore::Value, tag, std::make_unique<ModulusAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Diffclamp: {
-      m_valueNodes.emplace(tag, std::make_unique<DiffClampAnimatedNode>(tag, config, manager));
+      InsertNode(m_valueNodes, NodeStore::Value, tag, std::make_unique<DiffClampAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Transform: {
-      m_transformNodes.emplace(tag, std::make_unique<TransformAnimatedNode>(tag, config, manager));
+      InsertNode(
+          m_transformNodes, NodeStore::Transform, tag, std::make_unique<TransformAnimatedNode>(tag, config, manager));
       break;
     }
     case AnimatedNodeType::Tracking: {
-      m_trackingNodes.emplace(tag, std::make_unique<TrackingAnimatedNode>(tag, config, manager));
+      InsertNode(
+          m_trackingNodes, NodeStore::Tracking, tag, std::make_unique<TrackingAnimatedNode>(tag, config, manager));
       break;
     }
     default: {
@@ -92,35 +160,108 @@ void NativeAnimatedNodeManager::CreateAnimatedNode(
       break;
     }
   }
+
+  AddEvaluatorNode(tag, type, config);
+}
+
+void NativeAnimatedNodeManager::AddEvaluatorNode(int64_t tag, AnimatedNodeType type, const folly::dynamic &config) {
+  const auto inputs = [&config]() {
+    std::vector<int64_t> inputs;
+    for (const auto &input : config.find("input").dereference().second) {
+      inputs.push_back(static_cast<int64_t>(input.asDouble()));
+    }
+    return inputs;
+  };
+  const auto asDouble = [&config](std::string_view name) {
+    return config.find(name).dereference().second.asDouble();
+  };
+
+  switch (type) {
+    case AnimatedNodeType::Value:
+      m_evaluator.AddValueNode(tag, asDouble("value"), asDouble("offset"));
+      break;
+    case AnimatedNodeType::Addition:
+      m_evaluator.AddOperatorNode(tag, AnimationGraphEvaluator::NodeKind::Addition, inputs());
+      break;
+    case AnimatedNodeType::Subtraction:
+      m_evaluator.AddOperatorNode(tag, AnimationGraphEvaluator::NodeKind::Subtraction, inputs());
+      break;
+    case AnimatedNodeType::Multiplication:
+      m_evaluator.AddOperatorNode(tag, AnimationGraphEvaluator::NodeKind::Multiplication, inputs());
+      break;
+    case AnimatedNodeType::Division:
+      m_evaluator.AddOperatorNode(tag, AnimationGraphEvaluator::NodeKind::Division, inputs());
+      break;
+    case AnimatedNodeType::Modulus:
+      m_evaluator.AddModulusNode(tag, static_cast<int64_t>(asDouble("input")), asDouble("modulus"));
+      break;
+    case AnimatedNodeType::Diffclamp:
+      m_evaluator.AddDiffClampNode(tag, static_cast<int64_t>(asDouble("input")), asDouble("min"), asDouble("max"));
+      break;
+    case AnimatedNodeType::Interpolation: {
+      AnimationGraphEvaluator::InterpolationConfig interpolation;
+      for (const auto &value : config.find("inputRange").dereference().second) {
+        interpolation.InputRange.push_back(value.asDouble());
+      }
+      for (const auto &value : config.find("outputRange").dereference().second) {
+        interpolation.OutputRange.push_back(value.asDouble());
+      }
+      interpolation.ExtrapolateLeft =
+          ExtrapolationTypeFromString(config.find("extrapolateLeft").dereference().second.asString());
+      interpolation.ExtrapolateRight =
+          ExtrapolationTypeFromString(config.find("extrapolateRight").dereference().second.asString());
+      m_evaluator.AddInterpolationNode(tag, std::move(interpolation));
+      break;
+    }
+    default:
+      // Props, style, transform and tracking nodes are bound to the property sets by composition expressions.
+      break;
+  }
 }
 
 void NativeAnimatedNodeManager::GetValue(int64_t animatedNodeTag, const Callback &saveValueCallback) {
-  if (const auto valueNode = m_valueNodes.at(animatedNodeTag).get()) {
-    saveValueCallback(std::vector<folly::dynamic>{folly::dynamic(valueNode->Value())});
+  if (const auto valueNode = GetValueAnimatedNode(animatedNodeTag)) {
+    // The property sets of operator nodes are driven by expressions, so their evaluated value is only known to
+    // the evaluator.
+    const auto value = !m_useCompositionKeyFrameAnimations && m_evaluator.HasNode(animatedNodeTag)
+        ? m_evaluator.GetNodeValue(animatedNodeTag)
+        : valueNode->Value();
+    saveValueCallback(std::vector<folly::dynamic>{folly::dynamic(value)});
   }
 }
 
 void NativeAnimatedNodeManager::ConnectAnimatedNodeToView(int64_t propsNodeTag, int64_t viewTag) {
-  m_propsNodes.at(propsNodeTag)->ConnectToView(viewTag);
+  const auto propsNode = GetPropsAnimatedNode(propsNodeTag);
+  if (!propsNode) {
+    throw std::out_of_range("PropsAnimatedNode with tag " + std::to_string(propsNodeTag) + " does not exist.");
+  }
+  propsNode->ConnectToView(viewTag);
 }
 
 void NativeAnimatedNodeManager::DisconnectAnimatedNodeToView(int64_t propsNodeTag, int64_t viewTag) {
-  m_propsNodes.at(propsNodeTag)->DisconnectFromView(viewTag);
+  const auto propsNode = GetPropsAnimatedNode(propsNodeTag);
+  if (!propsNode) {
+    throw std::out_of_range("PropsAnimatedNode with tag " + std::to_string(propsNodeTag) + " does not exist.");
+  }
+  propsNode->DisconnectFromView(viewTag);
 }
 
 void NativeAnimatedNodeManager::ConnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
   if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
     parentNode->AddChild(childNodeTag);
   }
+  m_evaluator.ConnectNodes(parentNodeTag, childNodeTag);
 }
 
 void NativeAnimatedNodeManager::DisconnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
   if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
     parentNode->RemoveChild(childNodeTag);
   }
+  m_evaluator.DisconnectNodes(parentNodeTag, childNodeTag);
 }
 
 void NativeAnimatedNodeManager::StopAnimation(int64_t animationId) {
+  EndFrameDrivenAnimation(animationId, false);
   if (m_activeAnimations.count(animationId)) {
     if (const auto animation = m_activeAnimations.at(animationId).get()) {
       animation->StopAnimation();
@@ -149,6 +290,19 @@ void NativeAnimatedNodeManager::RestartTrackingAnimatedNode(
           manager,
           /*track*/ false);
     }
+  } else if (m_frameDrivenAnimations.count(animationId)) {
+    // Like the key frame animation above, the animation is replaced without calling its end callback.
+    auto const animation = m_frameDrivenAnimations.at(animationId);
+    m_frameDrivenAnimations.erase(animationId);
+    m_evaluator.StopAnimation(animationId);
+    StartTrackingAnimatedNode(
+        animationId,
+        animation.AnimatedValueTag,
+        animatedToValueTag,
+        animation.AnimationConfig,
+        animation.EndCallback,
+        manager,
+        /*track*/ false);
   }
 }
 
@@ -160,46 +314,56 @@ void NativeAnimatedNodeManager::StartTrackingAnimatedNode(
     const Callback &endCallback,
     const std::shared_ptr<NativeAnimatedNodeManager> &manager,
     bool track) {
-  auto updatedAnimationConfig = animationConfig;
-  for (auto &item : m_activeAnimations) {
-    if (item.second->AnimatedValueTag() == animatedToValueTag) {
-      updatedAnimationConfig.insert(static_cast<folly::StringPiece>(s_toValueIdName), item.second->ToValue());
-
-      switch (AnimationTypeFromString(animationConfig.find("type").dereference().second.getString())) {
-        case AnimationType::Frames:
-          updatedAnimationConfig.insert(
-              static_cast<folly::StringPiece>(s_framesName), [animationConfig, activeFrames = item.second->Frames()]() {
-                auto frames = folly::dynamic::array();
-                for (auto const &frame : animationConfig.find("frames").dereference().second) {
-                  (void)frame;
-                  frames.push_back(0.0);
-                }
-                for (auto const &frame : activeFrames) {
-                  frames.push_back(frame);
-                }
-                return frames;
-              }());
-          break;
-        case AnimationType::Spring:
-          updatedAnimationConfig.insert(
-              static_cast<folly::StringPiece>(s_dynamicToValuesName), [activeFrames = item.second->Frames()]() {
-                auto dynamicToValues = folly::dynamic::array();
-                for (auto const &frame : activeFrames) {
-                  dynamicToValues.push_back(frame);
-                }
-                return dynamicToValues;
-              }());
-          break;
-          // Animated.Decay does not have a to value,
-          // so they cannot track other nodes. So we'll never
-          // have a decay tracking node.
-        case AnimationType::Decay:
-        default:
-          assert(false);
-          break;
+  auto const leader = [this, animatedToValueTag]() -> std::optional<std::tuple<double, std::vector<double>>> {
+    for (auto &item : m_activeAnimations) {
+      if (item.second->AnimatedValueTag() == animatedToValueTag) {
+        return std::make_tuple(item.second->ToValue(), item.second->Frames());
+      }
+    }
+    for (auto const &item : m_frameDrivenAnimations) {
+      if (item.second.AnimatedValueTag == animatedToValueTag) {
+        return std::make_tuple(item.second.ToValue, item.second.Frames);
       }
+    }
+    return std::nullopt;
+  }();
 
-      break;
+  auto updatedAnimationConfig = animationConfig;
+  if (leader) {
+    auto const toValue = std::get<0>(*leader);
+    auto const &activeFrames = std::get<1>(*leader);
+    updatedAnimationConfig.insert(static_cast<folly::StringPiece>(s_toValueIdName), toValue);
+
+    switch (AnimationTypeFromString(animationConfig.find("type").dereference().second.getString())) {
+      case AnimationType::Frames:
+        updatedAnimationConfig.insert(static_cast<folly::StringPiece>(s_framesName), [animationConfig, activeFrames]() {
+          auto frames = folly::dynamic::array();
+          for (auto const &frame : animationConfig.find("frames").dereference().second) {
+            (void)frame;
+            frames.push_back(0.0);
+          }
+          for (auto const &frame : activeFrames) {
+            frames.push_back(frame);
+          }
+          return frames;
+        }());
+        break;
+      case AnimationType::Spring:
+        updatedAnimationConfig.insert(static_cast<folly::StringPiece>(s_dynamicToValuesName), [activeFrames]() {
+          auto dynamicToValues = folly::dynamic::array();
+          for (auto const &frame : activeFrames) {
+            dynamicToValues.push_back(frame);
+          }
+          return dynamicToValues;
+        }());
+        break;
+        // Animated.Decay does not have a to value,
+        // so they cannot track other nodes. So we'll never
+        // have a decay tracking node.
+      case AnimationType::Decay:
+      default:
+        assert(false);
+        break;
     }
   }
   if (track) {
@@ -214,6 +378,17 @@ void NativeAnimatedNodeManager::StartAnimatingNode(
     const folly::dynamic &animationConfig,
     const Callback &endCallback,
     const std::shared_ptr<NativeAnimatedNodeManager> &manager) {
+  if (!m_useCompositionKeyFrameAnimations) {
+    if (StartFrameDrivenAnimation(animationId, animatedNodeTag, animationConfig, endCallback, manager)) {
+      for (auto const &trackingAndLead : m_trackingAndLeadNodeTags) {
+        if (std::get<1>(trackingAndLead) == animatedNodeTag) {
+          RestartTrackingAnimatedNode(std::get<0>(trackingAndLead), std::get<1>(trackingAndLead), manager);
+        }
+      }
+    }
+    return;
+  }
+
   switch (AnimationTypeFromString(animationConfig.find("type").dereference().second.getString())) {
     case AnimationType::Decay:
       m_activeAnimations.emplace(
@@ -252,33 +427,180 @@ void NativeAnimatedNodeManager::StartAnimatingNode(
   }
 }
 
+bool NativeAnimatedNodeManager::StartFrameDrivenAnimation(
+    int64_t animationId,
+    int64_t animatedNodeTag,
+    const folly::dynamic &animationConfig,
+    const Callback &endCallback,
+    const std::shared_ptr<NativeAnimatedNodeManager> &manager) {
+  const auto valueNode = GetValueAnimatedNode(animatedNodeTag);
+  if (!valueNode || !m_evaluator.HasNode(animatedNodeTag)) {
+    return false;
+  }
+
+  // Animations start from the value currently in the property set.
+  m_evaluator.SetNodeValue(animatedNodeTag, valueNode->RawValue());
+  m_evaluator.SetNodeOffset(animatedNodeTag, valueNode->Offset());
+
+  const auto iterations = [&animationConfig]() {
+    if (animationConfig.count(s_iterationsName)) {
+      return static_cast<int>(animationConfig.at(s_iterationsName).asDouble());
+    }
+    return 1;
+  }();
+
+  FrameDrivenAnimation animation{animatedNodeTag, endCallback, animationConfig};
+  switch (AnimationTypeFromString(animationConfig.find("type").dereference().second.getString())) {
+    case AnimationType::Decay: {
+      const auto decay = DecayAnimationDriver::ParseConfig(animationConfig);
+      animation.ToValue = DecayEndValue(decay, valueNode->RawValue());
+      m_evaluator.StartDecayAnimation(animationId, animatedNodeTag, decay, iterations);
+      break;
+    }
+    case AnimationType::Frames: {
+      for (const auto &frame : animationConfig.find(s_framesName).dereference().second) {
+        animation.Frames.push_back(frame.asDouble());
+      }
+      animation.ToValue = animationConfig.find(s_toValueIdName).dereference().second.asDouble();
+      m_evaluator.StartFramesAnimation(animationId, animatedNodeTag, animation.Frames, animation.ToValue, iterations);
+      break;
+    }
+    case AnimationType::Spring: {
+      const auto spring = SpringAnimationDriver::ParseConfig(animationConfig);
+      std::vector<double> dynamicToValues;
+      if (animationConfig.count(s_dynamicToValuesName)) {
+        for (const auto &value : animationConfig.at(s_dynamicToValuesName)) {
+          dynamicToValues.push_back(value.asDouble());
+        }
+      }
+      animation.ToValue = spring.ToValue;
+      m_evaluator.StartSpringAnimation(animationId, animatedNodeTag, spring, iterations, std::move(dynamicToValues));
+      break;
+    }
+    default:
+      assert(false);
+      return false;
+  }
+
+  m_frameDrivenAnimations.insert_or_assign(animationId, std::move(animation));
+  valueNode->AddActiveAnimation(animationId);
+
+  if (!m_rendering) {
+    m_rendering = xaml::Media::CompositionTarget::Rendering(
+        winrt::auto_revoke,
+        [weakManager = std::weak_ptr(manager)](const winrt::IInspectable &, const winrt::IInspectable & /*args*/) {
+          if (const auto manager = weakManager.lock()) {
+            manager->OnRendering();
+          }
+        });
+  }
+  return true;
+}
+
+void NativeAnimatedNodeManager::EndFrameDrivenAnimation(int64_t animationId, bool finished) {
+  const auto it = m_frameDrivenAnimations.find(animationId);
+  if (it == m_frameDrivenAnimations.end()) {
+    return;
+  }
+
+  const auto animation = std::move(it->second);
+  m_frameDrivenAnimations.erase(it);
+  m_evaluator.StopAnimation(animationId);
+
+  if (const auto valueNode = GetValueAnimatedNode(animation.AnimatedValueTag)) {
+    valueNode->RemoveActiveAnimation(animationId);
+  }
+  if (animation.EndCallback) {
+    animation.EndCallback(std::vector<folly::dynamic>{folly::dynamic::object("finished", finished)});
+  }
+}
+
+void NativeAnimatedNodeManager::EndFrameDrivenAnimationsForNode(int64_t tag) {
+  std::vector<int64_t> animationIds;
+  for (const auto &item : m_frameDrivenAnimations) {
+    if (item.second.AnimatedValueTag == tag) {
+      animationIds.push_back(item.first);
+    }
+  }
+  for (const auto animationId : animationIds) {
+    EndFrameDrivenAnimation(animationId, false);
+  }
+}
+
+void NativeAnimatedNodeManager::OnRendering() {
+  const auto time = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_renderingOrigin).count();
+  m_evaluator.Step(time);
+
+  for (const auto tag : m_evaluator.AnimatedNodes()) {
+    if (const auto valueNode = GetValueAnimatedNode(tag)) {
+      valueNode->RawValue(m_evaluator.GetNodeRawValue(tag));
+    }
+  }
+  for (const auto animationId : m_evaluator.TakeFinishedAnimations()) {
+    EndFrameDrivenAnimation(animationId, true);
+  }
+
+  if (!m_evaluator.HasActiveAnimations()) {
+    m_rendering.revoke();
+  }
+}
+
 void NativeAnimatedNodeManager::DropAnimatedNode(int64_t tag) {
-  m_valueNodes.erase(tag);
-  m_propsNodes.erase(tag);
-  m_styleNodes.erase(tag);
-  m_transformNodes.erase(tag);
+  EndFrameDrivenAnimationsForNode(tag);
+  m_evaluator.RemoveNode(tag);
+
+  const auto slot = m_nodeSlots.find(tag);
+  if (slot == m_nodeSlots.end()) {
+    return;
+  }
+
+  const auto handle = slot->second.Handle;
+  switch (slot->second.Store) {
+    case NodeStore::Value:
+      m_valueNodes.Erase(handle);
+      break;
+    case NodeStore::Props:
+      m_propsNodes.Erase(handle);
+      break;
+    case NodeStore::Style:
+      m_styleNodes.Erase(handle);
+      break;
+    case NodeStore::Transform:
+      m_transformNodes.Erase(handle);
+      break;
+    case NodeStore::Tracking:
+      m_trackingNodes.Erase(handle);
+      break;
+  }
+  m_nodeSlots.erase(slot);
 }
 
 void NativeAnimatedNodeManager::SetAnimatedNodeValue(int64_t tag, double value) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  // Setting the value interrupts the animations driving it, like on the other platforms.
+  EndFrameDrivenAnimationsForNode(tag);
+  m_evaluator.SetNodeValue(tag, value);
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->RawValue(static_cast<float>(value));
   }
 }
 
 void NativeAnimatedNodeManager::SetAnimatedNodeOffset(int64_t tag, double offset) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  m_evaluator.SetNodeOffset(tag, offset);
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->Offset(static_cast<float>(offset));
   }
 }
 
 void NativeAnimatedNodeManager::FlattenAnimatedNodeOffset(int64_t tag) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  m_evaluator.FlattenNodeOffset(tag);
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->FlattenOffset();
   }
 }
 
 void NativeAnimatedNodeManager::ExtractAnimatedNodeOffset(int64_t tag) {
-  if (const auto valueNode = m_valueNodes.at(tag).get()) {
+  m_evaluator.ExtractNodeOffset(tag);
+  if (const auto valueNode = GetValueAnimatedNode(tag)) {
     valueNode->ExtractOffset();
   }
 }
@@ -291,40 +613,102 @@ void NativeAnimatedNodeManager::AddAnimatedEventToView(
   const auto valueNodeTag = static_cast<int64_t>(eventMapping.find("animatedValueTag").dereference().second.asDouble());
   const auto pathList = eventMapping.find("nativeEventPath").dereference().second;
 
-  const auto key = std::make_tuple(viewTag, eventName);
-  if (m_eventDrivers.count(key)) {
-    m_eventDrivers.at(key).emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
-  } else {
-    auto vector = std::vector<std::unique_ptr<EventAnimationDriver>>{};
-    vector.emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
-    m_eventDrivers.insert({key, std::move(vector)});
+  const auto eventNameId = InternEventName(eventName);
+  auto &viewDrivers = m_eventDrivers[viewTag];
+  auto eventDrivers = std::find_if(viewDrivers.begin(), viewDrivers.end(), [eventNameId](const auto &item) {
+    return item.EventName == eventNameId;
+  });
+  if (eventDrivers == viewDrivers.end()) {
+    eventDrivers = viewDrivers.insert(viewDrivers.end(), EventDrivers{eventNameId});
   }
+  eventDrivers->Drivers.emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
 }
 
 void NativeAnimatedNodeManager::RemoveAnimatedEventFromView(
     int64_t viewTag,
     const std::string &eventName,
     int64_t animatedValueTag) {
-  const auto key = std::make_tuple(viewTag, eventName);
-  if (m_eventDrivers.count(key)) {
-    auto &drivers = m_eventDrivers.at(key);
-
-    for (auto iterator = drivers.begin(); iterator != drivers.end();) {
-      if (const auto value = iterator->get()->AnimatedValue()) {
-        if (value->Tag() == animatedValueTag) {
-          iterator = drivers.erase(iterator);
-          continue;
-        }
+  const auto eventNameId = m_eventNames.find(eventName);
+  const auto viewDrivers = m_eventDrivers.find(viewTag);
+  if (eventNameId == m_eventNames.end() || viewDrivers == m_eventDrivers.end()) {
+    return;
+  }
+
+  auto &events = viewDrivers->second;
+  const auto eventDrivers = std::find_if(events.begin(), events.end(), [eventNameId](const auto &item) {
+    return item.EventName == eventNameId->second;
+  });
+  if (eventDrivers == events.end()) {
+    return;
+  }
+
+  auto &drivers = eventDrivers->Drivers;
+  for (auto iterator = drivers.begin(); iterator != drivers.end();) {
+    if (const auto value = iterator->get()->AnimatedValue()) {
+      if (value->Tag() == animatedValueTag) {
+        iterator = drivers.erase(iterator);
+        continue;
       }
-      ++iterator;
+    }
+    ++iterator;
+  }
+
+  if (drivers.empty()) {
+    events.erase(eventDrivers);
+  }
+  if (events.empty()) {
+    m_eventDrivers.erase(viewDrivers);
+  }
+}
+
+uint32_t NativeAnimatedNodeManager::InternEventName(const std::string &eventName) {
+  return m_eventNames.try_emplace(eventName, static_cast<uint32_t>(m_eventNames.size())).first->second;
+}
+
+template <typename TEvent>
+void NativeAnimatedNodeManager::DispatchNativeEvent(int64_t viewTag, std::wstring_view eventName, const TEvent &event) {
+  // Most events come from views without animated events, so look the view up first.
+  const auto viewDrivers = m_eventDrivers.find(viewTag);
+  if (viewDrivers == m_eventDrivers.end()) {
+    return;
+  }
+
+  const auto eventNameId = NativeAnimatedEventId(eventName);
+  if (!eventNameId) {
+    return;
+  }
+
+  for (const auto &eventDrivers : viewDrivers->second) {
+    if (eventDrivers.EventName != *eventNameId) {
+      continue;
     }
 
-    if (!drivers.size()) {
-      m_eventDrivers.erase(key);
+    // Unlike SetAnimatedNodeValue, events update the value without interrupting its animations.
+    for (const auto &driver : eventDrivers.Drivers) {
+      if (const auto value = driver->Read(event)) {
+        m_evaluator.SetNodeValue(driver->AnimatedValueTag(), *value);
+        if (const auto valueNode = GetValueAnimatedNode(driver->AnimatedValueTag())) {
+          valueNode->RawValue(static_cast<float>(*value));
+        }
+      }
     }
   }
 }
 
+void NativeAnimatedNodeManager::DispatchAnimatedEvent(
+    int64_t viewTag,
+    std::wstring_view eventName,
+    const ScrollEventData &event) {
+  DispatchNativeEvent(viewTag, eventName, event);
+}
+
+void NativeAnimatedNodeManager::DispatchAnimatedEvent(
+    int64_t viewTag,
+    std::wstring_view eventName,
+    const PointerEventData &event) {
+  DispatchNativeEvent(viewTag, eventName, event);
+}
+
 void NativeAnimatedNodeManager::ProcessDelayedPropsNodes() {
   // If StartAnimations fails we'll put the props nodes back into this queue to
   // try again when the next batch completes. Because of this we need to copy
@@ -332,8 +716,8 @@ void NativeAnimatedNodeManager::ProcessDelayedPropsNodes() {
   const auto delayedPropsNodes = m_delayedPropsNodes;
   m_delayedPropsNodes.clear();
   for (const auto tag : delayedPropsNodes) {
-    if (m_propsNodes.count(tag) > 0) {
-      m_propsNodes.at(tag)->StartAnimations();
+    if (const auto propsNode = GetPropsAnimatedNode(tag)) {
+      propsNode->StartAnimations();
     }
   }
 }
@@ -350,57 +734,44 @@ void NativeAnimatedNodeManager::AddDelayedPropsNode(
 }
 
 AnimatedNode *NativeAnimatedNodeManager::GetAnimatedNode(int64_t tag) {
-  if (m_valueNodes.count(tag)) {
-    return m_valueNodes.at(tag).get();
+  const auto slot = m_nodeSlots.find(tag);
+  if (slot == m_nodeSlots.end()) {
+    return static_cast<AnimatedNode *>(nullptr);
   }
-  if (m_styleNodes.count(tag)) {
-    return m_styleNodes.at(tag).get();
-  }
-  if (m_propsNodes.count(tag)) {
-    return m_propsNodes.at(tag).get();
-  }
-  if (m_transformNodes.count(tag)) {
-    return m_transformNodes.at(tag).get();
-  }
-  if (m_trackingNodes.count(tag)) {
-    return m_trackingNodes.at(tag).get();
+
+  switch (slot->second.Store) {
+    case NodeStore::Value:
+      return GetValueAnimatedNode(tag);
+    case NodeStore::Props:
+      return GetPropsAnimatedNode(tag);
+    case NodeStore::Style:
+      return GetStyleAnimatedNode(tag);
+    case NodeStore::Transform:
+      return GetTransformAnimatedNode(tag);
+    case NodeStore::Tracking:
+      return GetTrackingAnimatedNode(tag);
   }
   return static_cast<AnimatedNode *>(nullptr);
 }
 
 ValueAnimatedNode *NativeAnimatedNodeManager::GetValueAnimatedNode(int64_t tag) {
-  if (m_valueNodes.count(tag)) {
-    return m_valueNodes.at(tag).get();
-  }
-  return static_cast<ValueAnimatedNode *>(nullptr);
+  return FindNode(m_valueNodes, NodeStore::Value, tag);
 }
 
 PropsAnimatedNode *NativeAnimatedNodeManager::GetPropsAnimatedNode(int64_t tag) {
-  if (m_propsNodes.count(tag)) {
-    return m_propsNodes.at(tag).get();
-  }
-  return static_cast<PropsAnimatedNode *>(nullptr);
+  return FindNode(m_propsNodes, NodeStore::Props, tag);
 }
 
 StyleAnimatedNode *NativeAnimatedNodeManager::GetStyleAnimatedNode(int64_t tag) {
-  if (m_styleNodes.count(tag)) {
-    return m_styleNodes.at(tag).get();
-  }
-  return static_cast<StyleAnimatedNode *>(nullptr);
+  return FindNode(m_styleNodes, NodeStore::Style, tag);
 }
 
 TransformAnimatedNode *NativeAnimatedNodeManager::GetTransformAnimatedNode(int64_t tag) {
-  if (m_transformNodes.count(tag)) {
-    return m_transformNodes.at(tag).get();
-  }
-  return static_cast<TransformAnimatedNode *>(nullptr);
+  return FindNode(m_transformNodes, NodeStore::Transform, tag);
 }
 
 TrackingAnimatedNode *NativeAnimatedNodeManager::GetTrackingAnimatedNode(int64_t tag) {
-  if (m_trackingNodes.count(tag)) {
-    return m_trackingNodes.at(tag).get();
-  }
-  return nullptr;
+  return FindNode(m_trackingNodes, NodeStore::Tracking, tag);
 }
 
 void NativeAnimatedNodeManager::RemoveActiveAnimation(int64_t tag) {
@@ -5,10 +5,16 @@
 // Licensed under the MIT License.
 
 #include <IReactInstance.h>
+#include <UI.Xaml.Media.h>
 #include <cxxreact/CxxModule.h>
 #include <folly/dynamic.h>
+#include <chrono>
+#include <string_view>
 #include "AnimatedNode.h"
+#include "AnimatedNodeArena.h"
+#include "AnimatedNodeType.h"
 #include "AnimationDriver.h"
+#include "AnimationGraphEvaluator.h"
 #include "EventAnimationDriver.h"
 #include "PropsAnimatedNode.h"
 #include "StyleAnimatedNode.h"
@@ -25,6 +31,19 @@ namespace Microsoft::ReactNative {
 /// establishes a number of composistion animations and property sets to
 /// drive the animating of the nodes to the Xaml elements off the UI Thread
 ///
+/// Spring, decay and frame animations are stepped on each rendered frame by an
+/// AnimationGraphEvaluator, which writes the animated values into the property
+/// sets. Precomputed composition key frame animations are only used when the
+/// UseCompositionKeyFrameAnimations quirk is set.
+///
+/// Nodes are stored in one AnimatedNodeArena per node type, and JS tags are
+/// resolved with a single lookup into the arena holding the node. Event names
+/// are interned, so event drivers are found without hashing strings.
+///
+/// Scroll and touch events are also dispatched here by the views emitting
+/// them, with their native data. Event drivers read the field their path names
+/// from that data, so scroll-linked values are updated without building or
+/// walking the JS payload of the event.
 /// </summary>
 
 typedef std::function<void(std::vector<folly::dynamic>)> Callback;
@@ -39,6 +58,8 @@ class AnimationDriver;
 class EventAnimationDriver;
 class NativeAnimatedNodeManager {
  public:
+  explicit NativeAnimatedNodeManager(bool useCompositionKeyFrameAnimations = false);
+
   void CreateAnimatedNode(
       int64_t tag,
       const folly::dynamic &config,
@@ -79,6 +100,8 @@ class NativeAnimatedNodeManager {
       const folly::dynamic &eventMapping,
       const std::shared_ptr<NativeAnimatedNodeManager> &manager);
   void RemoveAnimatedEventFromView(int64_t viewTag, const std::string &eventName, int64_t animatedValueTag);
+  void DispatchAnimatedEvent(int64_t viewTag, std::wstring_view eventName, const ScrollEventData &event);
+  void DispatchAnimatedEvent(int64_t viewTag, std::wstring_view eventName, const PointerEventData &event);
   void ProcessDelayedPropsNodes();
   void AddDelayedPropsNode(int64_t propsNodeTag, const Mso::CntPtr<Mso::React::IReactContext> &context);
 
@@ -91,13 +114,71 @@ class NativeAnimatedNodeManager {
   void RemoveActiveAnimation(int64_t tag);
 
  private:
-  std::unordered_map<int64_t, std::unique_ptr<ValueAnimatedNode>> m_valueNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<PropsAnimatedNode>> m_propsNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<StyleAnimatedNode>> m_styleNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<TransformAnimatedNode>> m_transformNodes{};
-  std::unordered_map<int64_t, std::unique_ptr<TrackingAnimatedNode>> m_trackingNodes{};
-  std::unordered_map<std::tuple<int64_t, std::string>, std::vector<std::unique_ptr<EventAnimationDriver>>>
-      m_eventDrivers{};
+  enum class NodeStore : uint8_t {
+    Value,
+    Props,
+    Style,
+    Transform,
+    Tracking,
+  };
+
+  struct NodeSlot {
+    NodeStore Store{NodeStore::Value};
+    AnimatedNodeHandle Handle{};
+  };
+
+  struct EventDrivers {
+    uint32_t EventName{0};
+    std::vector<std::unique_ptr<EventAnimationDriver>> Drivers{};
+  };
+
+  struct FrameDrivenAnimation {
+    int64_t AnimatedValueTag{0};
+    Callback EndCallback{};
+    folly::dynamic AnimationConfig{};
+    double ToValue{0};
+    std::vector<double> Frames{};
+  };
+
+  template <typename TNode, typename TConcreteNode>
+  void InsertNode(
+      AnimatedNodeArena<std::unique_ptr<TNode>> &arena,
+      NodeStore store,
+      int64_t tag,
+      std::unique_ptr<TConcreteNode> node);
+  template <typename TNode>
+  TNode *FindNode(AnimatedNodeArena<std::unique_ptr<TNode>> &arena, NodeStore store, int64_t tag);
+  uint32_t InternEventName(const std::string &eventName);
+  template <typename TEvent>
+  void DispatchNativeEvent(int64_t viewTag, std::wstring_view eventName, const TEvent &event);
+  void AddEvaluatorNode(int64_t tag, AnimatedNodeType type, const folly::dynamic &config);
+  bool StartFrameDrivenAnimation(
+      int64_t animationId,
+      int64_t animatedNodeTag,
+      const folly::dynamic &animationConfig,
+      const Callback &endCallback,
+      const std::shared_ptr<NativeAnimatedNodeManager> &manager);
+  void EndFrameDrivenAnimation(int64_t animationId, bool finished);
+  void EndFrameDrivenAnimationsForNode(int64_t tag);
+  void OnRendering();
+
+  bool m_useCompositionKeyFrameAnimations{false};
+  AnimationGraphEvaluator m_evaluator{};
+  std::unordered_map<int64_t, FrameDrivenAnimation> m_frameDrivenAnimations{};
+  std::chrono::steady_clock::time_point m_renderingOrigin{std::chrono::steady_clock::now()};
+  xaml::Media::CompositionTarget::Rendering_revoker m_rendering{};
+
+  AnimatedNodeArena<std::unique_ptr<ValueAnimatedNode>> m_valueNodes{};
+  AnimatedNodeArena<std::unique_ptr<PropsAnimatedNode>> m_propsNodes{};
+  AnimatedNodeArena<std::unique_ptr<StyleAnimatedNode>> m_styleNodes{};
+  AnimatedNodeArena<std::unique_ptr<TransformAnimatedNode>> m_transformNodes{};
+  AnimatedNodeArena<std::unique_ptr<TrackingAnimatedNode>> m_trackingNodes{};
+  std::unordered_map<int64_t, NodeSlot> m_nodeSlots{};
+
+  // Event drivers of each view tag, by interned event name. The names of the native events that can be dispatched
+  // are interned first, in the order of their table, so their ids are their positions in it.
+  std::unordered_map<int64_t, std::vector<EventDrivers>> m_eventDrivers{};
+  std::unordered_map<std::string, uint32_t> m_eventNames{};
   std::unordered_map<int64_t, std::unique_ptr<AnimationDriver>> m_activeAnimations{};
   std::vector<std::tuple<int64_t, int64_t>> m_trackingAndLeadNodeTags{};
   std::vector<int64_t> m_delayedPropsNodes{};
@@ -105,5 +186,6 @@ class NativeAnimatedNodeManager {
   static constexpr std::string_view s_toValueIdName{"toValue"};
   static constexpr std::string_view s_framesName{"frames"};
   static constexpr std::string_view s_dynamicToValuesName{"dynamicToValues"};
+  static constexpr std::string_view s_iterationsName{"iterations"};
 };
 } // namespace Microsoft::ReactNative
@@ -5,6 +5,7 @@
 #pragma once
 #include <folly/dynamic.h>
 #include "AnimatedNode.h"
+#include "AnimationCurves.h"
 #include "CalculatedAnimationDriver.h"
 
 namespace Microsoft::ReactNative {
@@ -20,22 +21,14 @@ class SpringAnimationDriver : public CalculatedAnimationDriver {
 
   double ToValue() override;
 
+  static SpringAnimationConfig ParseConfig(const folly::dynamic &config);
+
  protected:
   std::tuple<float, double> GetValueAndVelocityForTime(double time) override;
   bool IsAnimationDone(double currentValue, double currentVelocity) override;
 
  private:
-  bool IsAtRest(double currentVelocity, double currentPosition, double endValue);
-  bool IsOvershooting(double currentValue);
-
-  double m_springStiffness{0};
-  double m_springDamping{0};
-  double m_springMass{0};
-  double m_initialVelocity{0};
-  double m_endValue{0};
-  double m_restSpeedThreshold{0};
-  double m_displacementFromRestThreshold{0};
-  bool m_overshootClampingEnabled{0};
+  SpringAnimationConfig m_spring{};
   int m_iterations{0};
   folly::dynamic m_dynamicToValues{};
 
@@ -7,7 +7,13 @@
 #include <UI.Xaml.Input.h>
 #include <UI.Xaml.Media.h>
 #include <Views/ShadowNodeBase.h>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string_view>
 #include "Modules/I18nManagerModule.h"
+#include "Modules/YogaStylePropTable.h"
 #include "NativeUIManager.h"
 
 #include "CppWinRTIncludes.h"
@@ -60,6 +66,99 @@ static int YogaLog(
 }
 #endif
 
+namespace {
+
+// Lets yoga calculate layout on thread pool threads while the XAML elements that yoga needs to measure are
+// measured on the UI thread. The UI thread serves the measure requests until the layout of all roots is calculated.
+struct ParallelLayoutScope {
+  explicit ParallelLayoutScope(size_t rootCount) noexcept : m_pendingRoots(rootCount) {}
+
+  // Called from a thread pool thread. Blocks until the UI thread measured the node.
+  YGSize Measure(
+      YGMeasureFunc func,
+      YGNodeRef node,
+      float width,
+      YGMeasureMode widthMode,
+      float height,
+      YGMeasureMode heightMode) noexcept {
+    MeasureRequest request{func, node, width, widthMode, height, heightMode};
+    std::unique_lock lock{m_mutex};
+    m_requests.push_back(&request);
+    m_cv.notify_all();
+    m_cv.wait(lock, [&request] { return request.isDone; });
+    return request.result;
+  }
+
+  void OnRootCompleted() noexcept {
+    std::scoped_lock lock{m_mutex};
+    --m_pendingRoots;
+    m_cv.notify_all();
+  }
+
+  // Called from the UI thread. Returns when the layout of all roots is calculated.
+  void ServeMeasureRequests() noexcept {
+    std::unique_lock lock{m_mutex};
+    for (;;) {
+      m_cv.wait(lock, [this] { return !m_requests.empty() || m_pendingRoots == 0; });
+      if (m_requests.empty())
+        return;
+
+      MeasureRequest *request = m_requests.front();
+      m_requests.pop_front();
+      lock.unlock();
+      YGSize result =
+          request->func(request->node, request->width, request->widthMode, request->height, request->heightMode);
+      lock.lock();
+      request->result = result;
+      request->isDone = true;
+      m_cv.notify_all();
+    }
+  }
+
+ private:
+  struct MeasureRequest {
+    YGMeasureFunc func;
+    YGNodeRef node;
+    float width;
+    YGMeasureMode widthMode;
+    float height;
+    YGMeasureMode heightMode;
+    YGSize result{};
+    bool isDone{false};
+  };
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<MeasureRequest *> m_requests;
+  size_t m_pendingRoots;
+};
+
+thread_local ParallelLayoutScope *tls_parallelLayoutScope{nullptr};
+
+} // namespace
+
+static YGSize
+MeasureYogaNode(YGNodeRef node, float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode) {
+  auto context = reinterpret_cast<YogaContext *>(YGNodeGetContext(node));
+  if (auto scope = tls_parallelLayoutScope)
+    return scope->Measure(context->measureFunc, node, width, widthMode, height, heightMode);
+  return context->measureFunc(node, width, widthMode, height, heightMode);
+}
+
+YGNodeRef NativeUIManager::CreateYogaNode(ShadowNodeBase &node) {
+  auto result = m_tagsToYogaNodes.emplace(node.m_tag, make_yoga_node(m_yogaConfig));
+  if (!result.second)
+    return nullptr;
+
+  // Every yoga node carries a context pointing back to its shadow node, so that DoLayout can apply the layout
+  // results while walking the yoga tree.
+  YGNodeRef yogaNode = result.first->second.get();
+  auto context = std::make_unique<YogaContext>(node.GetView(), &node);
+  YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
+  m_tagsToYogaContext[node.m_tag] = std::move(context);
+  return yogaNode;
+}
+
 YGNodeRef NativeUIManager::GetYogaNode(int64_t tag) const {
   auto iter = m_tagsToYogaNodes.find(tag);
   if (iter == m_tagsToYogaNodes.end())
@@ -135,6 +234,8 @@ NativeUIManager::NativeUIManager(winrt::Microsoft::ReactNative::ReactContext con
   if (React::implementation::QuirkSettings::GetMatchAndroidAndIOSStretchBehavior(m_context.Properties()))
     YGConfigSetUseLegacyStretchBehaviour(m_yogaConfig, true);
 
+  m_parallelRootLayout = Mso::React::ReactOptions::EnableParallelRootLayout(m_context.Properties().Handle());
+
 #if defined(_DEBUG)
   YGConfigSetLogger(m_yogaConfig, &YogaLog);
 
@@ -225,7 +326,7 @@ void NativeUIManager::AddRootView(ShadowNode &shadowNode, facebook::react::IReac
   view.as<xaml::FrameworkElement>().FlowDirection(
       I18nManager::IsRTL(m_context.Properties()) ? xaml::FlowDirection::RightToLeft : xaml::FlowDirection::LeftToRight);
 
-  m_tagsToYogaNodes.emplace(shadowNode.m_tag, make_yoga_node(m_yogaConfig));
+  CreateYogaNode(static_cast<ShadowNodeBase &>(shadowNode));
 
   auto element = view.as<xaml::FrameworkElement>();
   element.Tag(winrt::PropertyValue::CreateInt64(shadowNode.m_tag));
@@ -399,360 +500,333 @@ static void SetYogaValueAutoHelper(
   }
 }
 
-static void StyleYogaNode(
+template <typename TEnum>
+struct YogaEnumValue {
+  std::string_view name;
+  TEnum value;
+};
+
+// Maps a string style value to a yoga enum value. Null and unknown values map to the first entry, which is the
+// default value of the style.
+template <typename TEnum, size_t N>
+static TEnum YogaEnumOrDefault(
+    const winrt::Microsoft::ReactNative::JSValue &value,
+    const YogaEnumValue<TEnum> (&values)[N],
+    bool assertOnUnknown = true) {
+  if (auto str = value.TryGetString()) {
+    for (const auto &entry : values) {
+      if (entry.name == *str)
+        return entry.value;
+    }
+  }
+
+  if (!value.IsNull() && assertOnUnknown)
+    assert(false);
+
+  return values[0].value;
+}
+
+constexpr YogaEnumValue<YGFlexDirection> flexDirectionValues[] = {
+    {"column", YGFlexDirectionColumn},
+    {"row", YGFlexDirectionRow},
+    {"column-reverse", YGFlexDirectionColumnReverse},
+    {"row-reverse", YGFlexDirectionRowReverse}};
+
+constexpr YogaEnumValue<YGJustify> justifyContentValues[] = {
+    {"flex-start", YGJustifyFlexStart},
+    {"flex-end", YGJustifyFlexEnd},
+    {"center", YGJustifyCenter},
+    {"space-between", YGJustifySpaceBetween},
+    {"space-around", YGJustifySpaceAround},
+    {"space-evenly", YGJustifySpaceEvenly}};
+
+constexpr YogaEnumValue<YGWrap> flexWrapValues[] = {{"nowrap", YGWrapNoWrap}, {"wrap", YGWrapWrap}};
+
+constexpr YogaEnumValue<YGAlign> alignItemsValues[] = {
+    {"stretch", YGAlignStretch},
+    {"flex-start", YGAlignFlexStart},
+    {"flex-end", YGAlignFlexEnd},
+    {"center", YGAlignCenter},
+    {"baseline", YGAlignBaseline}};
+
+constexpr YogaEnumValue<YGAlign> alignSelfValues[] = {
+    {"auto", YGAlignAuto},
+    {"stretch", YGAlignStretch},
+    {"flex-start", YGAlignFlexStart},
+    {"flex-end", YGAlignFlexEnd},
+    {"center", YGAlignCenter},
+    {"baseline", YGAlignBaseline}};
+
+constexpr YogaEnumValue<YGAlign> alignContentValues[] = {
+    {"flex-start", YGAlignFlexStart},
+    {"stretch", YGAlignStretch},
+    {"flex-end", YGAlignFlexEnd},
+    {"center", YGAlignCenter},
+    {"space-between", YGAlignSpaceBetween},
+    {"space-around", YGAlignSpaceAround}};
+
+constexpr YogaEnumValue<YGPositionType> positionValues[] = {
+    {"relative", YGPositionTypeRelative},
+    {"absolute", YGPositionTypeAbsolute},
+    {"static", YGPositionTypeStatic}};
+
+constexpr YogaEnumValue<YGOverflow> overflowValues[] = {
+    {"visible", YGOverflowVisible},
+    {"hidden", YGOverflowHidden},
+    {"scroll", YGOverflowScroll}};
+
+constexpr YogaEnumValue<YGDisplay> displayValues[] = {{"flex", YGDisplayFlex}, {"none", YGDisplayNone}};
+
+typedef void (*YogaStylePropSetter)(
     ShadowNodeBase &shadowNode,
     const YGNodeRef yogaNode,
-    const winrt::Microsoft::ReactNative::JSValueObject &props) {
-  for (const auto &pair : props) {
-    const std::string &key = pair.first;
-    const auto &value = pair.second;
-
-    if (key == "flexDirection") {
-      YGFlexDirection direction = YGFlexDirectionColumn;
-
-      if (value == "column" || value.IsNull())
-        direction = YGFlexDirectionColumn;
-      else if (value == "row")
-        direction = YGFlexDirectionRow;
-      else if (value == "column-reverse")
-        direction = YGFlexDirectionColumnReverse;
-      else if (value == "row-reverse")
-        direction = YGFlexDirectionRowReverse;
-      else
-        assert(false);
+    const winrt::Microsoft::ReactNative::JSValue &value,
+    const std::string &key);
 
-      YGNodeStyleSetFlexDirection(yogaNode, direction);
-    } else if (key == "justifyContent") {
-      YGJustify justify = YGJustifyFlexStart;
-
-      if (value == "flex-start" || value.IsNull())
-        justify = YGJustifyFlexStart;
-      else if (value == "flex-end")
-        justify = YGJustifyFlexEnd;
-      else if (value == "center")
-        justify = YGJustifyCenter;
-      else if (value == "space-between")
-        justify = YGJustifySpaceBetween;
-      else if (value == "space-around")
-        justify = YGJustifySpaceAround;
-      else if (value == "space-evenly")
-        justify = YGJustifySpaceEvenly;
-      else
-        assert(false);
+template <YGEdge edge>
+static void SetPositionStyle(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const winrt::Microsoft::ReactNative::JSValue &value,
+    const std::string &key) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetJustifyContent(yogaNode, justify);
-    } else if (key == "flexWrap") {
-      YGWrap wrap = YGWrapNoWrap;
+  SetYogaValueHelper(yogaNode, edge, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+}
 
-      if (value == "nowrap" || value.IsNull())
-        wrap = YGWrapNoWrap;
-      else if (value == "wrap")
-        wrap = YGWrapWrap;
-      else
-        assert(false);
+template <YGEdge edge>
+static void SetMarginStyle(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const winrt::Microsoft::ReactNative::JSValue &value,
+    const std::string &key) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetFlexWrap(yogaNode, wrap);
-    } else if (key == "alignItems") {
-      YGAlign align = YGAlignStretch;
-
-      if (value == "stretch" || value.IsNull())
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+  SetYogaValueAutoHelper(
+      yogaNode, edge, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+}
 
-      YGNodeStyleSetAlignItems(yogaNode, align);
-    } else if (key == "alignSelf") {
-      YGAlign align = YGAlignAuto;
-
-      if (value == "auto" || value.IsNull())
-        align = YGAlignAuto;
-      else if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+template <YGEdge edge, bool skipIfImplementsPadding = true>
+static void SetPaddingStyle(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const winrt::Microsoft::ReactNative::JSValue &value,
+    const std::string &key) {
+  if (skipIfImplementsPadding && shadowNode.ImplementsPadding())
+    return;
 
-      YGNodeStyleSetAlignSelf(yogaNode, align);
-    } else if (key == "alignContent") {
-      YGAlign align = YGAlignFlexStart;
-
-      if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start" || value.IsNull())
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "space-between")
-        align = YGAlignSpaceBetween;
-      else if (value == "space-around")
-        align = YGAlignSpaceAround;
-      else
-        assert(false);
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetAlignContent(yogaNode, align);
-    } else if (key == "flex") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+  SetYogaValueHelper(yogaNode, edge, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+}
 
-      YGNodeStyleSetFlex(yogaNode, result);
-    } else if (key == "flexGrow") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+template <YGEdge edge>
+static void SetBorderStyle(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const winrt::Microsoft::ReactNative::JSValue &value,
+    const std::string & /*key*/) {
+  float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetFlexGrow(yogaNode, result);
-    } else if (key == "flexShrink") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+  YGNodeStyleSetBorder(yogaNode, edge, result);
+}
 
-      YGNodeStyleSetFlexShrink(yogaNode, result);
-    } else if (key == "flexBasis") {
+// Setters of the style props named in yogaStylePropNames, in the same order.
+constexpr YogaStylePropSetter yogaStylePropSetters[] = {
+    // flexDirection
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetFlexDirection(yogaNode, YogaEnumOrDefault(value, flexDirectionValues));
+    },
+    // justifyContent
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetJustifyContent(yogaNode, YogaEnumOrDefault(value, justifyContentValues));
+    },
+    // flexWrap
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetFlexWrap(yogaNode, YogaEnumOrDefault(value, flexWrapValues));
+    },
+    // alignItems
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetAlignItems(yogaNode, YogaEnumOrDefault(value, alignItemsValues));
+    },
+    // alignSelf
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetAlignSelf(yogaNode, YogaEnumOrDefault(value, alignSelfValues));
+    },
+    // alignContent
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetAlignContent(yogaNode, YogaEnumOrDefault(value, alignContentValues));
+    },
+    // flex
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetFlex(yogaNode, NumberOrDefault(value, 0.0f /*default*/));
+    },
+    // flexGrow
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetFlexGrow(yogaNode, NumberOrDefault(value, 0.0f /*default*/));
+    },
+    // flexShrink
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetFlexShrink(yogaNode, NumberOrDefault(value, 0.0f /*default*/));
+    },
+    // flexBasis
+    [](ShadowNodeBase &shadowNode,
+       const YGNodeRef yogaNode,
+       const React::JSValue &value,
+       const std::string &key) {
       YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
       SetYogaUnitValueAutoHelper(
           yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
-    } else if (key == "position") {
-      YGPositionType position = YGPositionTypeRelative;
-
-      if (value == "relative" || value.IsNull())
-        position = YGPositionTypeRelative;
-      else if (value == "absolute")
-        position = YGPositionTypeAbsolute;
-      else if (value == "static")
-        position = YGPositionTypeStatic;
-      else
-        assert(false);
-
-      YGNodeStyleSetPositionType(yogaNode, position);
-    } else if (key == "overflow") {
-      YGOverflow overflow = YGOverflowVisible;
-      if (value == "visible" || value.IsNull())
-        overflow = YGOverflowVisible;
-      else if (value == "hidden")
-        overflow = YGOverflowHidden;
-      else if (value == "scroll")
-        overflow = YGOverflowScroll;
-
-      YGNodeStyleSetOverflow(yogaNode, overflow);
-    } else if (key == "display") {
-      YGDisplay display = YGDisplayFlex;
-      if (value == "flex" || value.IsNull())
-        display = YGDisplayFlex;
-      else if (value == "none")
-        display = YGDisplayNone;
-
-      YGNodeStyleSetDisplay(yogaNode, display);
-    } else if (key == "direction") {
+    },
+    // position
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetPositionType(yogaNode, YogaEnumOrDefault(value, positionValues));
+    },
+    // overflow
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetOverflow(yogaNode, YogaEnumOrDefault(value, overflowValues, false /*assertOnUnknown*/));
+    },
+    // display
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetDisplay(yogaNode, YogaEnumOrDefault(value, displayValues, false /*assertOnUnknown*/));
+    },
+    // direction
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &, const std::string &) {
       // https://github.com/microsoft/react-native-windows/issues/4668
       // In order to support the direction property, we tell yoga to always layout
       // in LTR direction, then push the appropriate FlowDirection into XAML.
       // This way XAML handles flipping in RTL mode, which works both for RN components
       // as well as native components that have purely XAML sub-trees (eg ComboBox).
-      YGDirection direction = YGDirectionLTR;
-
-      YGNodeStyleSetDirection(yogaNode, direction);
-    } else if (key == "aspectRatio") {
-      float result = NumberOrDefault(value, 1.0f /*default*/);
-
-      YGNodeStyleSetAspectRatio(yogaNode, result);
-    } else if (key == "left") {
+      YGNodeStyleSetDirection(yogaNode, YGDirectionLTR);
+    },
+    // aspectRatio
+    [](ShadowNodeBase &, const YGNodeRef yogaNode, const React::JSValue &value, const std::string &) {
+      YGNodeStyleSetAspectRatio(yogaNode, NumberOrDefault(value, 1.0f /*default*/));
+    },
+    // left
+    SetPositionStyle<YGEdgeLeft>,
+    // top
+    SetPositionStyle<YGEdgeTop>,
+    // right
+    SetPositionStyle<YGEdgeRight>,
+    // bottom
+    SetPositionStyle<YGEdgeBottom>,
+    // end
+    SetPositionStyle<YGEdgeEnd>,
+    // start
+    SetPositionStyle<YGEdgeStart>,
+    // width
+    [](ShadowNodeBase &shadowNode,
+       const YGNodeRef yogaNode,
+       const React::JSValue &value,
+       const std::string &key) {
       YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "top") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "right") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "bottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "end") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "start") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "width") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
       SetYogaUnitValueAutoHelper(
           yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
-    } else if (key == "minWidth") {
+    },
+    // minWidth
+    [](ShadowNodeBase &shadowNode,
+       const YGNodeRef yogaNode,
+       const React::JSValue &value,
+       const std::string &key) {
       YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
       SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
-    } else if (key == "maxWidth") {
+    },
+    // maxWidth
+    [](ShadowNodeBase &shadowNode,
+       const YGNodeRef yogaNode,
+       const React::JSValue &value,
+       const std::string &key) {
       YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
       SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
-    } else if (key == "height") {
+    },
+    // height
+    [](ShadowNodeBase &shadowNode,
+       const YGNodeRef yogaNode,
+       const React::JSValue &value,
+       const std::string &key) {
       YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
       SetYogaUnitValueAutoHelper(
           yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
-    } else if (key == "minHeight") {
+    },
+    // minHeight
+    [](ShadowNodeBase &shadowNode,
+       const YGNodeRef yogaNode,
+       const React::JSValue &value,
+       const std::string &key) {
       YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
       SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
-    } else if (key == "maxHeight") {
+    },
+    // maxHeight
+    [](ShadowNodeBase &shadowNode,
+       const YGNodeRef yogaNode,
+       const React::JSValue &value,
+       const std::string &key) {
       YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
       SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
-    } else if (key == "margin") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeAll, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginLeft") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeLeft, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginStart") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeStart, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginTop") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeTop, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeRight, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginEnd") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeEnd, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginBottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeBottom, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginHorizontal") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeHorizontal,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "marginVertical") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeVertical,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "padding") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeAll, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingLeft") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingStart") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingTop") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-    } else if (key == "paddingEnd") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingBottom") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingHorizontal") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeHorizontal, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingVertical") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeVertical, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "borderWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeAll, result);
-    } else if (key == "borderLeftWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeLeft, result);
-    } else if (key == "borderStartWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeStart, result);
-    } else if (key == "borderTopWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeTop, result);
-    } else if (key == "borderRightWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeRight, result);
-    } else if (key == "borderEndWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetBorder(yogaNode, YGEdgeEnd, result);
-    } else if (key == "borderBottomWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+    },
+    // margin
+    SetMarginStyle<YGEdgeAll>,
+    // marginLeft
+    SetMarginStyle<YGEdgeLeft>,
+    // marginStart
+    SetMarginStyle<YGEdgeStart>,
+    // marginTop
+    SetMarginStyle<YGEdgeTop>,
+    // marginRight
+    SetMarginStyle<YGEdgeRight>,
+    // marginEnd
+    SetMarginStyle<YGEdgeEnd>,
+    // marginBottom
+    SetMarginStyle<YGEdgeBottom>,
+    // marginHorizontal
+    SetMarginStyle<YGEdgeHorizontal>,
+    // marginVertical
+    SetMarginStyle<YGEdgeVertical>,
+    // padding
+    SetPaddingStyle<YGEdgeAll>,
+    // paddingLeft
+    SetPaddingStyle<YGEdgeLeft>,
+    // paddingStart
+    SetPaddingStyle<YGEdgeStart>,
+    // paddingTop
+    SetPaddingStyle<YGEdgeTop>,
+    // paddingRight has always been passed to yoga, even for views that implement padding themselves.
+    // paddingRight
+    SetPaddingStyle<YGEdgeRight, false /*skipIfImplementsPadding*/>,
+    // paddingEnd
+    SetPaddingStyle<YGEdgeEnd>,
+    // paddingBottom
+    SetPaddingStyle<YGEdgeBottom>,
+    // paddingHorizontal
+    SetPaddingStyle<YGEdgeHorizontal>,
+    // paddingVertical
+    SetPaddingStyle<YGEdgeVertical>,
+    // borderWidth
+    SetBorderStyle<YGEdgeAll>,
+    // borderLeftWidth
+    SetBorderStyle<YGEdgeLeft>,
+    // borderStartWidth
+    SetBorderStyle<YGEdgeStart>,
+    // borderTopWidth
+    SetBorderStyle<YGEdgeTop>,
+    // borderRightWidth
+    SetBorderStyle<YGEdgeRight>,
+    // borderEndWidth
+    SetBorderStyle<YGEdgeEnd>,
+    // borderBottomWidth
+    SetBorderStyle<YGEdgeBottom>,
+};
+static_assert(std::size(yogaStylePropSetters) == std::size(yogaStylePropNames));
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeBottom, result);
+static void StyleYogaNode(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const winrt::Microsoft::ReactNative::JSValueObject &props) {
+  for (const auto &pair : props) {
+    uint8_t index = FindYogaStyleProp(pair.first);
+    if (index != noYogaStyleProp) {
+      yogaStylePropSetters[index](shadowNode, yogaNode, pair.second, pair.first);
     }
   }
 }
@@ -767,19 +841,13 @@ void NativeUIManager::CreateView(ShadowNode &shadowNode, React::JSValueObject &p
       m_extraLayoutNodes.push_back(node.m_tag);
     }
 
-    auto result = m_tagsToYogaNodes.emplace(node.m_tag, make_yoga_node(m_yogaConfig));
-    if (result.second == true) {
-      YGNodeRef yogaNode = result.first->second.get();
+    if (YGNodeRef yogaNode = CreateYogaNode(node)) {
       StyleYogaNode(node, yogaNode, props);
 
       YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
       if (func != nullptr) {
-        YGNodeSetMeasureFunc(yogaNode, func);
-
-        auto context = std::make_unique<Microsoft::ReactNative::YogaContext>(node.GetView());
-        YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
-
-        m_tagsToYogaContext.emplace(node.m_tag, std::move(context));
+        reinterpret_cast<YogaContext *>(YGNodeGetContext(yogaNode))->measureFunc = func;
+        YGNodeSetMeasureFunc(yogaNode, MeasureYogaNode);
       }
     }
   }
@@ -829,18 +897,9 @@ void NativeUIManager::ReplaceView(ShadowNode &shadowNode) {
   auto *pViewManager = node.GetViewManager();
 
   if (pViewManager->RequiresYogaNode()) {
-    auto it = m_tagsToYogaNodes.find(node.m_tag);
-    if (it != m_tagsToYogaNodes.end()) {
-      YGNodeRef yogaNode = it->second.get();
-
-      YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
-      if (func != nullptr) {
-        auto context = std::make_unique<YogaContext>(node.GetView());
-        YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
-
-        m_tagsToYogaContext.erase(node.m_tag);
-        m_tagsToYogaContext.emplace(node.m_tag, std::move(context));
-      }
+    auto it = m_tagsToYogaContext.find(node.m_tag);
+    if (it != m_tagsToYogaContext.end()) {
+      it->second->view = node.GetView();
     } else {
       assert(false);
       return;
@@ -889,6 +948,11 @@ void NativeUIManager::DoLayout() {
   // Values need to be cleared from the vector before next call to DoLayout.
   m_extraLayoutNodes.clear();
   auto &rootTags = m_host->GetAllRootTags();
+  if (m_parallelRootLayout && rootTags.size() > 1) {
+    DoParallelRootLayout(rootTags);
+    return;
+  }
+
   for (int64_t rootTag : rootTags) {
     UpdateExtraLayout(rootTag);
 
@@ -903,22 +967,74 @@ void NativeUIManager::DoLayout() {
     // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
     // which will inherit down the XAML tree, allowing all native controls to pick it up.
     YGNodeCalculateLayout(rootNode, actualWidth, actualHeight, YGDirectionLTR);
+
+    ApplyLayout(rootNode);
   }
+}
+
+void NativeUIManager::DoParallelRootLayout(const std::unordered_set<int64_t> &rootTags) {
+  struct RootLayout {
+    YGNodeRef rootNode;
+    float width;
+    float height;
+  };
+
+  // Everything that touches XAML stays on the UI thread: the extra layout preparation and reading the root sizes
+  // before the yoga pass, and applying the results after it.
+  std::vector<RootLayout> rootLayouts;
+  rootLayouts.reserve(rootTags.size());
+  for (int64_t rootTag : rootTags) {
+    UpdateExtraLayout(rootTag);
 
-  for (auto &tagToYogaNode : m_tagsToYogaNodes) {
-    int64_t tag = tagToYogaNode.first;
-    YGNodeRef yogaNode = tagToYogaNode.second.get();
+    ShadowNodeBase &rootShadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(rootTag));
+    auto rootElement = rootShadowNode.GetView().as<xaml::FrameworkElement>();
+    rootLayouts.push_back(RootLayout{GetYogaNode(rootTag),
+                                     static_cast<float>(rootElement.ActualWidth()),
+                                     static_cast<float>(rootElement.ActualHeight())});
+  }
+
+  // The yoga trees of the roots are independent. The UI thread serves the XAML measure requests of the yoga
+  // passes until all of them complete, so the stack allocated scope outlives the thread pool work items.
+  ParallelLayoutScope scope{rootLayouts.size()};
+  for (const auto &rootLayout : rootLayouts) {
+    Mso::DispatchQueue::ConcurrentQueue().Post([&scope, rootLayout]() noexcept {
+      tls_parallelLayoutScope = &scope;
+      // See DoLayout for why we always run layout in LTR mode.
+      YGNodeCalculateLayout(rootLayout.rootNode, rootLayout.width, rootLayout.height, YGDirectionLTR);
+      tls_parallelLayoutScope = nullptr;
+      scope.OnRootCompleted();
+    });
+  }
+  scope.ServeMeasureRequests();
+
+  for (const auto &rootLayout : rootLayouts) {
+    ApplyLayout(rootLayout.rootNode);
+  }
+}
+
+void NativeUIManager::ApplyLayout(YGNodeRef rootNode) {
+  // Yoga only lays out the children of nodes that got a new layout, so the subtrees of nodes without a new
+  // layout can be skipped. This keeps the cost proportional to the nodes that actually changed.
+  m_layoutStack.push_back(rootNode);
+  while (!m_layoutStack.empty()) {
+    YGNodeRef yogaNode = m_layoutStack.back();
+    m_layoutStack.pop_back();
 
     if (!YGNodeGetHasNewLayout(yogaNode))
       continue;
     YGNodeSetHasNewLayout(yogaNode, false);
 
+    for (uint32_t i = YGNodeGetChildCount(yogaNode); i > 0; --i) {
+      m_layoutStack.push_back(YGNodeGetChild(yogaNode, i - 1));
+    }
+
     float left = YGNodeLayoutGetLeft(yogaNode);
     float top = YGNodeLayoutGetTop(yogaNode);
     float width = YGNodeLayoutGetWidth(yogaNode);
     float height = YGNodeLayoutGetHeight(yogaNode);
 
-    ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
+    auto context = reinterpret_cast<YogaContext *>(YGNodeGetContext(yogaNode));
+    ShadowNodeBase &shadowNode = *context->shadowNode;
     auto view = shadowNode.GetView();
     auto pViewManager = shadowNode.GetViewManager();
     pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
@@ -13,8 +13,9 @@
 #include <ReactHost/React.h>
 #include <ReactRootView.h>
 #include <nativemodules.h>
-#include <map>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace Microsoft::ReactNative {
@@ -96,7 +97,10 @@ class NativeUIManager final : public INativeUIManager {
 
  private:
   void DoLayout();
+  void DoParallelRootLayout(const std::unordered_set<int64_t> &rootTags);
+  void ApplyLayout(YGNodeRef rootNode);
   void UpdateExtraLayout(int64_t tag);
+  YGNodeRef CreateYogaNode(ShadowNodeBase &node);
   YGNodeRef GetYogaNode(int64_t tag) const;
 
   winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView> GetParentXamlReactControl(int64_t tag) const;
@@ -106,14 +110,16 @@ class NativeUIManager final : public INativeUIManager {
   winrt::Microsoft::ReactNative::ReactContext m_context;
   YGConfigRef m_yogaConfig;
   bool m_inBatch = false;
+  bool m_parallelRootLayout = false;
 
-  std::map<int64_t, YogaNodePtr> m_tagsToYogaNodes;
-  std::map<int64_t, std::unique_ptr<YogaContext>> m_tagsToYogaContext;
+  std::unordered_map<int64_t, YogaNodePtr> m_tagsToYogaNodes;
+  std::unordered_map<int64_t, std::unique_ptr<YogaContext>> m_tagsToYogaContext;
   std::vector<xaml::FrameworkElement::SizeChanged_revoker> m_sizeChangedVector;
   std::vector<std::function<void()>> m_batchCompletedCallbacks;
   std::vector<int64_t> m_extraLayoutNodes;
+  std::vector<YGNodeRef> m_layoutStack;
 
-  std::map<int64_t, winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView>> m_tagsToXamlReactControl;
+  std::unordered_map<int64_t, winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView>> m_tagsToXamlReactControl;
 };
 
 } // namespace Microsoft::ReactNative
@@ -7,6 +7,7 @@
 #include <IReactContext.h>
 #include <IReactRootView.h>
 #include <Modules/PaperUIManagerModule.h>
+#include <Modules/PerformanceLoggerModule.h>
 #include <Modules\NativeUIManager.h>
 #include <Views/ViewManager.h>
 #include <XamlUtils.h>
@@ -50,7 +51,7 @@ UIManagerSettingsProperty() noexcept {
 }
 
 UIManagerSettings::UIManagerSettings(
-    const std::shared_ptr<facebook::react::MessageQueueThread> batchingUIMessageQueue,
+    const std::shared_ptr<facebook::react::BatchingMessageQueueThread> batchingUIMessageQueue,
     std::vector<std::unique_ptr<IViewManager>> &&viewManagers)
     : batchingUIMessageQueue(std::move(batchingUIMessageQueue)), viewManagers(std::move(viewManagers)) {}
 
@@ -97,6 +98,8 @@ class UIManagerModule : public std::enable_shared_from_this<UIManagerModule>, pu
     auto settings = m_context.Properties().Get(UIManagerSettingsProperty());
     m_viewManagers = std::move((*settings)->viewManagers);
     m_nativeUIManager->setHost(this);
+
+    m_startupTimeline = PerformanceLogger::GetStartupTimeline(m_context.Properties().Handle());
   }
 
   React::JSValueObject getConstantsForViewManager(std::string &&viewManagerName) noexcept {
@@ -125,6 +128,9 @@ class UIManagerModule : public std::enable_shared_from_this<UIManagerModule>, pu
   }
 
   void createView(int64_t reactTag, std::string viewName, int64_t rootTag, React::JSValueObject &&props) noexcept {
+    if (m_startupTimeline && !std::exchange(m_createdView, true))
+      m_startupTimeline->Mark(Microsoft::React::StartupMarker::FirstCreateView, viewName);
+
     m_nativeUIManager->ensureInBatch();
     auto viewManager = GetViewManager(viewName);
     auto node = viewManager->createShadow();
@@ -365,6 +371,12 @@ class UIManagerModule : public std::enable_shared_from_this<UIManagerModule>, pu
 
   void onBatchComplete() {
     m_nativeUIManager->onBatchComplete();
+
+    // The batch that created the first view has been laid out. The timeline is not needed after that.
+    if (m_startupTimeline && m_createdView) {
+      m_startupTimeline->Mark(Microsoft::React::StartupMarker::FirstLayout);
+      m_startupTimeline = nullptr;
+    }
   }
 
   void manageChildren(
@@ -503,10 +515,95 @@ class UIManagerModule : public std::enable_shared_from_this<UIManagerModule>, pu
   winrt::Microsoft::ReactNative::ReactContext m_context;
   std::vector<std::unique_ptr<IViewManager>> m_viewManagers;
   ShadowNodeRegistry m_nodeRegistry;
+  std::shared_ptr<Microsoft::React::StartupTimeline> m_startupTimeline;
+  bool m_createdView{false};
   std::shared_ptr<NativeUIManager> m_nativeUIManager;
   const React::JSValueObject accessibilityEventTypes = React::JSValueObject{{"typeViewFocused", 8}};
 };
 
+// createView and updateView keep their props in the batch, so that later updates of the same view queued in the
+// same batch are merged into them instead of being applied one by one on the UI thread.
+struct ViewPropsOperation final : facebook::react::ICoalescingOperation {
+  ViewPropsOperation(
+      std::weak_ptr<UIManagerModule> &&module,
+      facebook::react::CoalescingOperationKind kind,
+      int64_t reactTag,
+      std::string &&viewName,
+      int64_t rootTag,
+      React::JSValueObject &&props) noexcept
+      : m_module(std::move(module)),
+        m_kind(kind),
+        m_reactTag(reactTag),
+        m_viewName(std::move(viewName)),
+        m_rootTag(rootTag),
+        m_props(std::move(props)) {}
+
+  int64_t Tag() const noexcept override {
+    return m_reactTag;
+  }
+
+  facebook::react::CoalescingOperationKind Kind() const noexcept override {
+    return m_kind;
+  }
+
+  bool TryCoalesce(facebook::react::ICoalescingOperation &next) noexcept override {
+    if (next.Kind() != facebook::react::CoalescingOperationKind::UpdateView) {
+      return false;
+    }
+
+    // Later values win, including nulls which reset a prop to its default.
+    auto &nextOperation = static_cast<ViewPropsOperation &>(next);
+    for (auto &prop : nextOperation.m_props) {
+      m_props[prop.first] = std::move(prop.second);
+    }
+    return true;
+  }
+
+  void Execute() noexcept override {
+    if (auto module = m_module.lock()) {
+      if (m_kind == facebook::react::CoalescingOperationKind::CreateView) {
+        module->createView(m_reactTag, std::move(m_viewName), m_rootTag, std::move(m_props));
+      } else {
+        module->updateView(m_reactTag, std::move(m_viewName), std::move(m_props));
+      }
+    }
+  }
+
+ private:
+  std::weak_ptr<UIManagerModule> m_module;
+  facebook::react::CoalescingOperationKind m_kind;
+  int64_t m_reactTag;
+  std::string m_viewName;
+  int64_t m_rootTag;
+  React::JSValueObject m_props;
+};
+
+// Operations that may observe the props of a view. They are never merged, and they stop all earlier createView or
+// updateView operations from absorbing updates queued after them.
+struct ViewOperation final : facebook::react::ICoalescingOperation {
+  ViewOperation(int64_t reactTag, Mso::VoidFunctor &&func) noexcept : m_reactTag(reactTag), m_func(std::move(func)) {}
+
+  int64_t Tag() const noexcept override {
+    return m_reactTag;
+  }
+
+  facebook::react::CoalescingOperationKind Kind() const noexcept override {
+    return facebook::react::CoalescingOperationKind::Other;
+  }
+
+  bool TryCoalesce(facebook::react::ICoalescingOperation & /*next*/) noexcept override {
+    return false;
+  }
+
+  void Execute() noexcept override {
+    m_func();
+  }
+
+ private:
+  int64_t m_reactTag;
+  Mso::VoidFunctor m_func;
+};
+
 UIManager::UIManager() : m_module(std::make_shared<UIManagerModule>()) {}
 
 UIManager::~UIManager() {
@@ -555,42 +652,41 @@ void UIManager::createView(
     std::string viewName,
     double rootTag,
     React::JSValueObject &&props) noexcept {
-  m_batchingUIMessageQueue->runOnQueue(Mso::VoidFunctor([m = std::weak_ptr<UIManagerModule>(m_module),
-                                                         reactTag,
-                                                         viewName = std::move(viewName),
-                                                         rootTag,
-                                                         props = std::move(props)]() mutable {
-    if (auto module = m.lock()) {
-      module->createView(static_cast<int64_t>(reactTag), viewName, static_cast<int64_t>(rootTag), std::move(props));
-    }
-  }));
+  m_batchingUIMessageQueue->runCoalescingOnQueue(std::make_shared<ViewPropsOperation>(
+      std::weak_ptr<UIManagerModule>(m_module),
+      facebook::react::CoalescingOperationKind::CreateView,
+      static_cast<int64_t>(reactTag),
+      std::move(viewName),
+      static_cast<int64_t>(rootTag),
+      std::move(props)));
 }
 
 void UIManager::updateView(double reactTag, std::string viewName, React::JSValueObject &&props) noexcept {
-  m_batchingUIMessageQueue->runOnQueue(Mso::VoidFunctor([m = std::weak_ptr<UIManagerModule>(m_module),
-                                                         reactTag,
-                                                         viewName = std::move(viewName),
-                                                         props = std::move(props)]() mutable {
-    if (auto module = m.lock()) {
-      module->updateView(static_cast<int64_t>(reactTag), viewName, std::move(props));
-    }
-  }));
+  m_batchingUIMessageQueue->runCoalescingOnQueue(std::make_shared<ViewPropsOperation>(
+      std::weak_ptr<UIManagerModule>(m_module),
+      facebook::react::CoalescingOperationKind::UpdateView,
+      static_cast<int64_t>(reactTag),
+      std::move(viewName),
+      -1,
+      std::move(props)));
 }
 
 void UIManager::focus(double reactTag) noexcept {
-  m_batchingUIMessageQueue->runOnQueue([m = std::weak_ptr<UIManagerModule>(m_module), reactTag]() {
-    if (auto module = m.lock()) {
-      module->focus(static_cast<int64_t>(reactTag));
-    }
-  });
+  m_batchingUIMessageQueue->runCoalescingOnQueue(std::make_shared<ViewOperation>(
+      static_cast<int64_t>(reactTag), [m = std::weak_ptr<UIManagerModule>(m_module), reactTag]() {
+        if (auto module = m.lock()) {
+          module->focus(static_cast<int64_t>(reactTag));
+        }
+      }));
 }
 
 void UIManager::blur(double reactTag) noexcept {
-  m_batchingUIMessageQueue->runOnQueue(Mso::VoidFunctor([m = std::weak_ptr<UIManagerModule>(m_module), reactTag]() {
-    if (auto module = m.lock()) {
-      module->blur(static_cast<int64_t>(reactTag));
-    }
-  }));
+  m_batchingUIMessageQueue->runCoalescingOnQueue(std::make_shared<ViewOperation>(
+      static_cast<int64_t>(reactTag), [m = std::weak_ptr<UIManagerModule>(m_module), reactTag]() {
+        if (auto module = m.lock()) {
+          module->blur(static_cast<int64_t>(reactTag));
+        }
+      }));
 }
 
 void UIManager::findSubviewIn(
@@ -612,14 +708,17 @@ void UIManager::dispatchViewManagerCommand(
     double reactTag,
     winrt::Microsoft::ReactNative::JSValue &&commandID,
     React::JSValueArray &&commandArgs) noexcept {
-  m_batchingUIMessageQueue->runOnQueue(Mso::VoidFunctor([m = std::weak_ptr<UIManagerModule>(m_module),
-                                                         reactTag,
-                                                         commandID = std::move(commandID),
-                                                         commandArgs = std::move(commandArgs)]() mutable {
-    if (auto module = m.lock()) {
-      module->dispatchViewManagerCommand(static_cast<int64_t>(reactTag), std::move(commandID), std::move(commandArgs));
-    }
-  }));
+  m_batchingUIMessageQueue->runCoalescingOnQueue(std::make_shared<ViewOperation>(
+      static_cast<int64_t>(reactTag),
+      [m = std::weak_ptr<UIManagerModule>(m_module),
+       reactTag,
+       commandID = std::move(commandID),
+       commandArgs = std::move(commandArgs)]() mutable {
+        if (auto module = m.lock()) {
+          module->dispatchViewManagerCommand(
+              static_cast<int64_t>(reactTag), std::move(commandID), std::move(commandArgs));
+        }
+      }));
 }
 
 void UIManager::measure(
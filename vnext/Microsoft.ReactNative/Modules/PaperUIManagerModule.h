@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #pragma once
 
+#include <BatchingMessageQueueThread.h>
 #include <CxxMessageQueue.h>
 #include <INativeUIManager.h>
 #include <NativeModules.h>
@@ -20,10 +21,10 @@ class NativeUIManager;
 // UIManager
 struct UIManagerSettings {
   UIManagerSettings(
-      const std::shared_ptr<facebook::react::MessageQueueThread> batchingUIMessageQueue,
+      const std::shared_ptr<facebook::react::BatchingMessageQueueThread> batchingUIMessageQueue,
       std::vector<std::unique_ptr<IViewManager>> &&viewManagers);
   UIManagerSettings(UIManagerSettings const &) = delete;
-  const std::shared_ptr<facebook::react::MessageQueueThread> batchingUIMessageQueue;
+  const std::shared_ptr<facebook::react::BatchingMessageQueueThread> batchingUIMessageQueue;
   std::vector<std::unique_ptr<IViewManager>> viewManagers;
 };
 
@@ -167,7 +168,7 @@ struct UIManager final {
   void dismissPopupMenu() noexcept;
 
  private:
-  std::shared_ptr<facebook::react::MessageQueueThread> m_batchingUIMessageQueue;
+  std::shared_ptr<facebook::react::BatchingMessageQueueThread> m_batchingUIMessageQueue;
   std::shared_ptr<UIManagerModule> m_module;
   winrt::Microsoft::ReactNative::ReactContext m_context;
 };
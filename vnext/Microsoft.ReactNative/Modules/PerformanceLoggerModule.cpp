@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PerformanceLoggerModule.h"
+
+namespace Microsoft::ReactNative {
+
+winrt::Microsoft::ReactNative::ReactPropertyId<
+    winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<Microsoft::React::StartupTimeline>>>
+StartupTimelineProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<Microsoft::React::StartupTimeline>>>
+      prop{L"ReactNative.PerformanceLogger", L"StartupTimeline"};
+  return prop;
+}
+
+/*static*/ void PerformanceLogger::SetStartupTimeline(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+    std::shared_ptr<Microsoft::React::StartupTimeline> const &startupTimeline) noexcept {
+  winrt::Microsoft::ReactNative::ReactPropertyBag(properties).Set(StartupTimelineProperty(), startupTimeline);
+}
+
+/*static*/ std::shared_ptr<Microsoft::React::StartupTimeline> PerformanceLogger::GetStartupTimeline(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept {
+  auto value = winrt::Microsoft::ReactNative::ReactPropertyBag(properties).Get(StartupTimelineProperty());
+  return value ? value.Value() : nullptr;
+}
+
+void PerformanceLogger::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
+  m_startupTimeline = GetStartupTimeline(reactContext.Properties().Handle());
+}
+
+void PerformanceLogger::getStartupMarkers(React::ReactPromise<React::JSValueArray> result) noexcept {
+  React::JSValueArray markers;
+  if (m_startupTimeline) {
+    for (const auto &entry : m_startupTimeline->GetEntries()) {
+      markers.push_back(React::JSValueObject{
+          {"name", Microsoft::React::StartupTimeline::GetMarkerName(entry.Marker)},
+          {"tag", entry.Tag},
+          {"elapsed", entry.ElapsedMilliseconds}});
+    }
+  }
+
+  result.Resolve(std::move(markers));
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+
+#include <NativeModules.h>
+#include <StartupTimeline.h>
+
+namespace Microsoft::ReactNative {
+
+// Gives JavaScript access to the startup timeline of the instance, e.g. to report it with other telemetry.
+REACT_MODULE(PerformanceLogger)
+struct PerformanceLogger {
+  static void SetStartupTimeline(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+      std::shared_ptr<Microsoft::React::StartupTimeline> const &startupTimeline) noexcept;
+  static std::shared_ptr<Microsoft::React::StartupTimeline> GetStartupTimeline(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept;
+
+  REACT_INIT(Initialize)
+  void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
+
+  // Resolves with an array of {name, tag, elapsed} objects, where elapsed is in milliseconds since the instance was
+  // created.
+  REACT_METHOD(getStartupMarkers)
+  void getStartupMarkers(React::ReactPromise<React::JSValueArray> result) noexcept;
+
+ private:
+  std::shared_ptr<Microsoft::React::StartupTimeline> m_startupTimeline;
+};
+
+} // namespace Microsoft::ReactNative
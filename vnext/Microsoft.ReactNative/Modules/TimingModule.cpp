@@ -34,48 +34,14 @@ static bool IsAnimationFrameRequest(TTimeSpan period, bool repeat) {
   return !repeat && period == std::chrono::milliseconds(1);
 }
 
-//
-// TimerQueue
-//
-
-TimerQueue::TimerQueue() {
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Push(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-  m_timerVector.emplace_back(id, targetTime, period, repeat);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
-}
-
-void TimerQueue::Remove(int64_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end())
-    m_timerVector.erase(found);
-
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-bool TimerQueue::IsEmpty() {
-  return m_timerVector.empty();
-}
-
 //
 // Timing
 //
 
-Timing::Timing(TimingModule *parent) : m_parent(parent) {}
+// Timers due within this long after the first one share its wakeup of the dispatcher timer.
+constexpr std::chrono::milliseconds TimerSlack{4};
+
+Timing::Timing(TimingModule *parent) : m_parent(parent), m_timerQueue(TimerSlack) {}
 
 void Timing::Disconnect() {
   m_parent = nullptr;
@@ -94,18 +60,11 @@ void Timing::OnTick() {
   auto now = TDateTime::clock::now();
 
   auto emittedAnimationFrame = false;
-  while (!m_timerQueue.IsEmpty() && m_timerQueue.Front().TargetTime < now) {
-    // Pop first timer from the queue and add it to list of timers ready to fire
-    Timer next = m_timerQueue.Front();
-    m_timerQueue.Pop();
-    readyTimers.push_back(next.Id);
-
-    // If timer is repeating push it back onto the queue for the next repetition
-    if (next.Repeat)
-      m_timerQueue.Push(next.Id, now + next.Period, next.Period, true);
-    else if (IsAnimationFrameRequest(next.Period, next.Repeat))
+  m_timerQueue.PopDue(now, [&readyTimers, &emittedAnimationFrame](const auto &timer) {
+    readyTimers.push_back(timer.Id);
+    if (IsAnimationFrameRequest(timer.Period, timer.Repeat))
       emittedAnimationFrame = true;
-  }
+  });
 
   if (m_timerQueue.IsEmpty()) {
     StopTicks();
@@ -161,11 +120,11 @@ void Timing::StartRendering() {
 }
 
 void Timing::StartDispatcherTimer() {
-  const auto &nextTimer = m_timerQueue.Front();
+  const auto wakeupTime = m_timerQueue.WakeupTime();
   m_rendering.revoke();
   m_usingRendering = false;
   auto timer = EnsureDispatcherTimer();
-  timer.Interval(std::max(nextTimer.TargetTime - TDateTime::clock::now(), TTimeSpan::zero()));
+  timer.Interval(std::max(wakeupTime - TDateTime::clock::now(), TTimeSpan::zero()));
   timer.Start();
 }
 
@@ -195,7 +154,7 @@ void Timing::createTimer(int64_t id, double duration, double jsSchedulingTime, b
   if (!m_usingRendering) {
     if (IsAnimationFrameRequest(period, repeat)) {
       StartRendering();
-    } else if (initialTargetTime <= m_timerQueue.Front().TargetTime) {
+    } else if (initialTargetTime <= m_timerQueue.Front().DueTime) {
       StartDispatcherTimer();
     }
   }
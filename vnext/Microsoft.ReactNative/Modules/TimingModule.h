@@ -7,6 +7,7 @@
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/MessageQueueThread.h>
 
+#include <Modules/TimerHeap.h>
 #include <folly/dynamic.h>
 #include <memory>
 #include <vector>
@@ -19,43 +20,6 @@ typedef winrt::Windows::Foundation::TimeSpan TTimeSpan;
 
 class TimingModule;
 
-struct Timer {
-  Timer(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-    Id = id;
-    TargetTime = targetTime;
-    Period = period;
-    Repeat = repeat;
-  }
-
-  bool operator<(const Timer &timer) const {
-    return timer.TargetTime < TargetTime;
-  }
-
-  bool operator==(int64_t id) const {
-    return id == Id;
-  }
-
-  int64_t Id;
-  TDateTime TargetTime;
-  TTimeSpan Period;
-  bool Repeat;
-};
-
-class TimerQueue {
- public:
-  TimerQueue();
-
-  void Push(int64_t id, TDateTime targetTime, TTimeSpan period, bool repeat);
-  void Pop();
-  Timer &Front();
-  void Remove(int64_t id);
-
-  bool IsEmpty();
-
- private:
-  std::vector<Timer> m_timerVector;
-};
-
 class Timing : public std::enable_shared_from_this<Timing> {
  public:
   Timing(TimingModule *parent);
@@ -75,7 +39,7 @@ class Timing : public std::enable_shared_from_this<Timing> {
 
  private:
   TimingModule *m_parent;
-  TimerQueue m_timerQueue;
+  Microsoft::React::TimerHeap<TDateTime> m_timerQueue;
   xaml::Media::CompositionTarget::Rendering_revoker m_rendering;
   winrt::system::DispatcherQueueTimer m_dispatcherQueueTimer{nullptr};
   bool m_usingRendering{false};
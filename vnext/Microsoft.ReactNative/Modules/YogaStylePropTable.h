@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+namespace Microsoft::ReactNative {
+
+// The style props that NativeUIManager applies to yoga nodes. Their setters are listed in the same order in
+// NativeUIManager.cpp.
+constexpr std::string_view yogaStylePropNames[] = {
+    "flexDirection", "justifyContent", "flexWrap", "alignItems", "alignSelf", "alignContent", "flex", "flexGrow",
+    "flexShrink", "flexBasis", "position", "overflow", "display", "direction", "aspectRatio", "left", "top", "right",
+    "bottom", "end", "start", "width", "minWidth", "maxWidth", "height", "minHeight", "maxHeight", "margin",
+    "marginLeft", "marginStart", "marginTop", "marginRight", "marginEnd", "marginBottom", "marginHorizontal",
+    "marginVertical", "padding", "paddingLeft", "paddingStart", "paddingTop", "paddingRight", "paddingEnd",
+    "paddingBottom", "paddingHorizontal", "paddingVertical", "borderWidth", "borderLeftWidth", "borderStartWidth",
+    "borderTopWidth", "borderRightWidth", "borderEndWidth", "borderBottomWidth"};
+
+// Most props of a view are not yoga styles, so every prop name of every createView/updateView is looked up here.
+// The lookup table is a perfect hash built at compile time: a prop name is resolved with a single hash and at most
+// one string comparison.
+constexpr size_t yogaStylePropSlotCount = 1024;
+constexpr uint8_t noYogaStyleProp = 0xFF;
+static_assert(std::size(yogaStylePropNames) < noYogaStyleProp);
+
+constexpr uint32_t HashYogaStyleProp(std::string_view name, uint32_t seed) noexcept {
+  // FNV-1a
+  uint32_t hash = 2166136261u ^ seed;
+  for (char ch : name) {
+    hash ^= static_cast<uint8_t>(ch);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+struct YogaStylePropTable {
+  bool isValid{false};
+  uint32_t seed{0};
+  std::array<uint8_t, yogaStylePropSlotCount> slots{};
+};
+
+constexpr YogaStylePropTable MakeYogaStylePropTable() noexcept {
+  for (uint32_t seed = 0; seed < 64; ++seed) {
+    YogaStylePropTable table;
+    table.seed = seed;
+    for (size_t i = 0; i < yogaStylePropSlotCount; ++i) {
+      table.slots[i] = noYogaStyleProp;
+    }
+
+    table.isValid = true;
+    for (size_t i = 0; i < std::size(yogaStylePropNames) && table.isValid; ++i) {
+      auto &slot = table.slots[HashYogaStyleProp(yogaStylePropNames[i], seed) % yogaStylePropSlotCount];
+      if (slot == noYogaStyleProp) {
+        slot = static_cast<uint8_t>(i);
+      } else {
+        table.isValid = false;
+      }
+    }
+
+    if (table.isValid)
+      return table;
+  }
+
+  return YogaStylePropTable{};
+}
+
+constexpr YogaStylePropTable yogaStylePropTable = MakeYogaStylePropTable();
+static_assert(yogaStylePropTable.isValid, "No collision-free seed found. Increase yogaStylePropSlotCount.");
+
+// Returns the index of the prop in yogaStylePropNames, or noYogaStyleProp if it is not a yoga style.
+inline uint8_t FindYogaStyleProp(std::string_view key) noexcept {
+  uint8_t index =
+      yogaStylePropTable.slots[HashYogaStyleProp(key, yogaStylePropTable.seed) % yogaStylePropSlotCount];
+  if (index != noYogaStyleProp && yogaStylePropNames[index] == key)
+    return index;
+  return noYogaStyleProp;
+}
+
+} // namespace Microsoft::ReactNative
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "NativeModulesProvider.h"
 #include "ABICxxModule.h"
+#include "EagerModuleInitializer.h"
 #include "IReactContext.h"
 #include "IReactModuleBuilder.h"
 #include "Threading/MessageQueueThreadFactory.h"
@@ -25,25 +26,74 @@ std::vector<facebook::react::NativeModuleDescription> NativeModulesProvider::Get
   std::vector<facebook::react::NativeModuleDescription> modules;
 
   auto winrtReactContext = winrt::make<implementation::ReactContext>(Mso::Copy(reactContext));
+  auto makeModule = [winrtReactContext](std::string const &moduleName, ReactModuleProvider const &moduleProvider) {
+    IReactModuleBuilder moduleBuilder = winrt::make<ReactModuleBuilder>(winrtReactContext);
+    auto providedModule = moduleProvider(moduleBuilder);
+    return moduleBuilder.as<ReactModuleBuilder>()->MakeCxxModule(moduleName, providedModule);
+  };
 
+  std::shared_ptr<EagerModuleInitializer> eagerModules;
   for (auto &entry : m_moduleProviders) {
+    auto dependencies = m_eagerModuleDependencies.find(entry.first);
+    if (dependencies == m_eagerModuleDependencies.end()) {
+      modules.emplace_back(
+          entry.first,
+          [moduleName = entry.first, moduleProvider = entry.second, makeModule]() noexcept {
+            return makeModule(moduleName, moduleProvider);
+          },
+          defaultQueueThread);
+      continue;
+    }
+
+    // The module is constructed in the background, and its first use waits for it.
+    if (!eagerModules) {
+      eagerModules = std::make_shared<EagerModuleInitializer>();
+    }
+
+    auto eagerModule = std::make_shared<std::unique_ptr<facebook::xplat::module::CxxModule>>();
+    eagerModules->AddModule(
+        entry.first,
+        dependencies->second,
+        [eagerModule, moduleName = entry.first, moduleProvider = entry.second, makeModule]() noexcept {
+          *eagerModule = makeModule(moduleName, moduleProvider);
+        });
     modules.emplace_back(
         entry.first,
-        [moduleName = entry.first, moduleProvider = entry.second, winrtReactContext]() noexcept {
-          IReactModuleBuilder moduleBuilder = winrt::make<ReactModuleBuilder>(winrtReactContext);
-          auto providedModule = moduleProvider(moduleBuilder);
-          return moduleBuilder.as<ReactModuleBuilder>()->MakeCxxModule(moduleName, providedModule);
+        [eagerModule, eagerModules, moduleName = entry.first]() noexcept {
+          eagerModules->EnsureConstructed(moduleName);
+          return std::move(*eagerModule);
         },
         defaultQueueThread);
   }
 
+  if (eagerModules) {
+    eagerModules->Start();
+  }
+
   return modules;
 }
 
+std::shared_ptr<Mso::React::NativeModuleProvider2> NativeModulesProvider::CloneModuleProviders() const noexcept {
+  auto clone = std::make_shared<NativeModulesProvider>();
+  clone->m_moduleProviders = m_moduleProviders;
+  clone->m_eagerModuleDependencies = m_eagerModuleDependencies;
+  return clone;
+}
+
 void NativeModulesProvider::AddModuleProvider(
     winrt::hstring const &moduleName,
     ReactModuleProvider const &moduleProvider) noexcept {
   m_moduleProviders.emplace(to_string(moduleName), moduleProvider);
 }
 
+void NativeModulesProvider::AddEagerModuleProvider(
+    winrt::hstring const &moduleName,
+    ReactModuleProvider const &moduleProvider,
+    std::vector<std::string> &&dependencies) noexcept {
+  auto key = to_string(moduleName);
+  if (m_moduleProviders.emplace(key, moduleProvider).second) {
+    m_eagerModuleDependencies.emplace(std::move(key), std::move(dependencies));
+  }
+}
+
 } // namespace winrt::Microsoft::ReactNative
@@ -13,12 +13,20 @@ class NativeModulesProvider final : public Mso::React::NativeModuleProvider2 {
   virtual std::vector<facebook::react::NativeModuleDescription> GetModules(
       Mso::CntPtr<Mso::React::IReactContext> const &reactContext,
       std::shared_ptr<facebook::react::MessageQueueThread> const &defaultQueueThread) override;
+  std::shared_ptr<Mso::React::NativeModuleProvider2> CloneModuleProviders() const noexcept override;
 
  public:
   void AddModuleProvider(winrt::hstring const &moduleName, ReactModuleProvider const &moduleProvider) noexcept;
 
+  // Adds a module that is constructed in the background after the eager modules it depends on.
+  void AddEagerModuleProvider(
+      winrt::hstring const &moduleName,
+      ReactModuleProvider const &moduleProvider,
+      std::vector<std::string> &&dependencies) noexcept;
+
  private:
   std::map<std::string, ReactModuleProvider> m_moduleProviders;
+  std::map<std::string, std::vector<std::string>> m_eagerModuleDependencies;
   IReactPackageBuilder m_packageBuilder;
 };
 
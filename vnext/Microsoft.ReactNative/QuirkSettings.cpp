@@ -32,6 +32,12 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> AcceptSelfSignedCertsProper
   return propId;
 }
 
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> UseCompositionKeyFrameAnimationsProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> propId{
+      L"ReactNative.QuirkSettings", L"UseCompositionKeyFrameAnimations"};
+  return propId;
+}
+
 #pragma region IDL interface
 
 /*static*/ void QuirkSettings::SetMatchAndroidAndIOSStretchBehavior(
@@ -46,6 +52,12 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> AcceptSelfSignedCertsProper
   ReactPropertyBag(settings.Properties()).Set(AcceptSelfSignedCertsProperty(), value);
 }
 
+/*static*/ void QuirkSettings::SetUseCompositionKeyFrameAnimations(
+    winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
+    bool value) noexcept {
+  ReactPropertyBag(settings.Properties()).Set(UseCompositionKeyFrameAnimationsProperty(), value);
+}
+
 #pragma endregion IDL interface
 
 /*static*/ bool QuirkSettings::GetMatchAndroidAndIOSStretchBehavior(ReactPropertyBag properties) noexcept {
@@ -56,4 +68,8 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> AcceptSelfSignedCertsProper
   return properties.Get(AcceptSelfSignedCertsProperty()).value_or(false);
 }
 
+/*static*/ bool QuirkSettings::GetUseCompositionKeyFrameAnimations(ReactPropertyBag properties) noexcept {
+  return properties.Get(UseCompositionKeyFrameAnimationsProperty()).value_or(false);
+}
+
 } // namespace winrt::Microsoft::ReactNative::implementation
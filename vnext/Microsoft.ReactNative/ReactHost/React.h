@@ -59,6 +59,8 @@ using OnLoggingCallback = Mso::Functor<void(LogLevel logLevel, const char *messa
 using OnReactInstanceCreatedCallback = Mso::Functor<void(Mso::CntPtr<IReactContext> &&)>;
 using OnReactInstanceLoadedCallback = Mso::Functor<void(Mso::CntPtr<IReactContext> &&, const Mso::ErrorCode &)>;
 using OnReactInstanceDestroyedCallback = Mso::Functor<void(Mso::CntPtr<IReactContext> &&)>;
+using OnReactInstanceStartupMarkerCallback = Mso::Functor<
+    void(Mso::CntPtr<IReactContext> &&, const char *name, const std::string &tag, double elapsedMilliseconds)>;
 
 //! Returns default OnError handler.
 LIBLET_PUBLICAPI OnErrorCallback GetDefaultOnErrorHandler() noexcept;
@@ -161,6 +163,9 @@ struct NativeModuleProvider2 {
   virtual std::vector<facebook::react::NativeModuleDescription> GetModules(
       Mso::CntPtr<IReactContext> const &reactContext,
       std::shared_ptr<facebook::react::MessageQueueThread> const &defaultQueueThread) = 0;
+
+  //! Creates a provider with the same module providers that can be used by another React instance.
+  virtual std::shared_ptr<NativeModuleProvider2> CloneModuleProviders() const noexcept = 0;
 };
 
 struct ViewManagerProvider2 {
@@ -244,6 +249,14 @@ struct ReactOptions {
   //! It is not safe to expose to Custom Function. Add this flag so we can turn it off for Custom Function.
   bool EnableNativePerformanceNow{true};
 
+  //! Maximum time a batch of UI operations may run on the UI thread before yielding to input and rendering.
+  //! Zero means that batches always run to completion.
+  std::chrono::milliseconds UIBatchFrameBudget{0};
+
+  //! Number of instances that IReactHost keeps loaded in the background to replace the current instance on reload.
+  //! Zero disables the instance pool.
+  uint32_t InstancePoolSize{0};
+
   ReactDevOptions DeveloperSettings = {};
 
   //! This controls the availability of various developer support functionality including
@@ -298,6 +311,15 @@ struct ReactOptions {
       bool value) noexcept;
   static bool UseDirectDebugger(winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept;
 
+  //! Calculates the layout of independent root views concurrently on the thread pool.
+  //! Layout results are still applied to the views on the UI thread.
+  void SetEnableParallelRootLayout(bool enable) noexcept;
+  bool EnableParallelRootLayout() const noexcept;
+  static void SetEnableParallelRootLayout(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+      bool value) noexcept;
+  static bool EnableParallelRootLayout(winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept;
+
   //! Adds registered JS bundle to JSBundles.
   LIBLET_PUBLICAPI ReactOptions &AddRegisteredJSBundle(std::string_view jsBundleId) noexcept;
 
@@ -322,6 +344,11 @@ struct ReactOptions {
   //! The callback is called when IReactInstance is destroyed and must not be used anymore.
   //! It is called from the native queue.
   OnReactInstanceDestroyedCallback OnInstanceDestroyed;
+
+  //! The callback is called when IReactInstance reaches a startup phase, such as the evaluation of a JS bundle.
+  //! The elapsed time is measured from the creation of IReactInstance.
+  //! It is called from the queue that reached the phase.
+  OnReactInstanceStartupMarkerCallback OnStartupMarker;
 };
 
 //! IReactHost manages a RactNative instance.
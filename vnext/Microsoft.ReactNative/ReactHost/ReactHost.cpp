@@ -4,6 +4,9 @@
 #include "ReactHost.h"
 #include <Future/FutureWait.h>
 #include <winrt/Windows.Foundation.h>
+#include <algorithm>
+#include "IReactPropertyBag.h"
+#include "TurboModulesProvider.h"
 
 namespace Mso::React {
 
@@ -59,6 +62,14 @@ winrt::Microsoft::ReactNative::IReactPropertyName UseDirectDebuggerProperty() no
   return propName;
 }
 
+winrt::Microsoft::ReactNative::IReactPropertyName EnableParallelRootLayoutProperty() noexcept {
+  static winrt::Microsoft::ReactNative::IReactPropertyName propName =
+      winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetName(
+          winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetNamespace(L"ReactNative.ReactOptions"),
+          L"EnableParallelRootLayout");
+  return propName;
+}
+
 winrt::Microsoft::ReactNative::IReactPropertyName EnableFabricProperty() noexcept {
   static winrt::Microsoft::ReactNative::IReactPropertyName propName =
       winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetName(
@@ -208,6 +219,253 @@ bool ReactOptions::UseDirectDebugger() const noexcept {
   return winrt::unbox_value_or<bool>(properties.Get(UseDirectDebuggerProperty()), false);
 }
 
+void ReactOptions::SetEnableParallelRootLayout(bool enabled) noexcept {
+  Properties.Set(EnableParallelRootLayoutProperty(), winrt::box_value(enabled));
+}
+
+bool ReactOptions::EnableParallelRootLayout() const noexcept {
+  return EnableParallelRootLayout(Properties);
+}
+
+/*static*/ void ReactOptions::SetEnableParallelRootLayout(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+    bool value) noexcept {
+  properties.Set(EnableParallelRootLayoutProperty(), winrt::box_value(value));
+}
+
+/*static*/ bool ReactOptions::EnableParallelRootLayout(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept {
+  return winrt::unbox_value_or<bool>(properties.Get(EnableParallelRootLayoutProperty()), false);
+}
+
+//=============================================================================================
+// ReactHost instance pool
+//=============================================================================================
+
+namespace {
+
+// Instances used for debugging or reloaded on file changes must be created from the current sources.
+bool CanPoolInstances(ReactOptions const &options) noexcept {
+  return options.InstancePoolSize > 0 && !options.UseWebDebugger() && !options.UseDirectDebugger() &&
+      !options.UseFastRefresh() && !options.UseLiveReload();
+}
+
+bool AreSameJSBundles(
+    std::vector<Mso::CntPtr<IJSBundle>> const &left,
+    std::vector<Mso::CntPtr<IJSBundle>> const &right) noexcept {
+  if (left.size() != right.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < left.size(); ++i) {
+    auto leftInfo = left[i]->Info();
+    auto rightInfo = right[i]->Info();
+    if (leftInfo.Id != rightInfo.Id || leftInfo.Timestamp != rightInfo.Timestamp) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// A warm instance can be claimed if it was created with the bundle and engine settings requested for the reload.
+bool CanReuseWarmInstance(ReactOptions const &warmOptions, ReactOptions const &options) noexcept {
+  return CanPoolInstances(options) && warmOptions.Properties == options.Properties &&
+      warmOptions.Identity == options.Identity && warmOptions.BundleRootPath == options.BundleRootPath &&
+      warmOptions.JsiEngine == options.JsiEngine && warmOptions.EnableJITCompilation == options.EnableJITCompilation &&
+      warmOptions.EnableByteCodeCaching == options.EnableByteCodeCaching &&
+      warmOptions.ByteCodeFileUri == options.ByteCodeFileUri &&
+      static_cast<bool>(warmOptions.OnLogging) == static_cast<bool>(options.OnLogging) &&
+      AreSameJSBundles(warmOptions.JSBundles, options.JSBundles);
+}
+
+} // namespace
+
+void ReactHost::FillInstancePoolInQueue() noexcept {
+  if (IsClosed()) {
+    return;
+  }
+
+  // Instances are warmed one at a time to avoid competing with the current instance for the CPU.
+  auto &instancePool = m_instancePool.Load();
+  ReactOptions const &options = m_options.Load();
+  if (!CanPoolInstances(options) || instancePool.size() >= options.InstancePoolSize ||
+      std::any_of(instancePool.begin(), instancePool.end(), [](auto const &entry) { return !entry.IsLoaded; })) {
+    return;
+  }
+
+  WarmInstance warmInstance{};
+  warmInstance.Options = Mso::Copy(options);
+  warmInstance.Properties =
+      winrt::make<winrt::Microsoft::ReactNative::implementation::StagedReactPropertyBag>(options.Properties);
+  warmInstance.IsClaimed = std::make_shared<std::atomic<bool>>(false);
+  warmInstance.Callbacks = std::make_shared<WarmInstanceCallbacks>();
+  warmInstance.Callbacks->OnError = options.OnError;
+  warmInstance.Callbacks->OnLogging = options.OnLogging;
+
+  // The warm instance must not notify the application until it replaces the current instance.
+  ReactOptions instanceOptions = Mso::Copy(options);
+  instanceOptions.Properties = warmInstance.Properties;
+  if (options.ModuleProvider) {
+    instanceOptions.ModuleProvider = options.ModuleProvider->CloneModuleProviders();
+  }
+
+  if (options.TurboModuleProvider) {
+    instanceOptions.TurboModuleProvider = options.TurboModuleProvider->CloneModuleProviders();
+  }
+
+  // Errors and logs go to the callbacks of the reload that claims the instance.
+  instanceOptions.OnError = [callbacks = warmInstance.Callbacks](const Mso::ErrorCode &errorCode) noexcept {
+    OnErrorCallback onError;
+    {
+      std::scoped_lock lock{callbacks->Mutex};
+      onError = callbacks->OnError;
+    }
+
+    if (onError) {
+      onError(errorCode);
+    }
+  };
+
+  if (options.OnLogging) {
+    instanceOptions.OnLogging = [callbacks = warmInstance.Callbacks](LogLevel logLevel, const char *message) noexcept {
+      OnLoggingCallback onLogging;
+      {
+        std::scoped_lock lock{callbacks->Mutex};
+        onLogging = callbacks->OnLogging;
+      }
+
+      if (onLogging) {
+        onLogging(logLevel, message);
+      }
+    };
+  }
+
+  instanceOptions.OnInstanceCreated = nullptr;
+  instanceOptions.OnInstanceLoaded = nullptr;
+  instanceOptions.OnStartupMarker = nullptr;
+  if (options.OnInstanceDestroyed) {
+    instanceOptions.OnInstanceDestroyed =
+        [onDestroyed = options.OnInstanceDestroyed,
+         isClaimed = warmInstance.IsClaimed](Mso::CntPtr<IReactContext> &&reactContext) noexcept {
+          if (*isClaimed) {
+            onDestroyed.Get()->Invoke(std::move(reactContext));
+          }
+        };
+  }
+
+  Mso::Promise<void> whenLoaded;
+  warmInstance.Instance = MakeReactInstance(
+      *this,
+      std::move(instanceOptions),
+      Mso::Promise<void>{},
+      Mso::Copy(whenLoaded),
+      [weakThis = Mso::WeakPtr{this}, isClaimed = warmInstance.IsClaimed]() noexcept {
+        if (*isClaimed) {
+          if (auto strongThis = weakThis.GetStrongPtr()) {
+            strongThis->InvokeInQueue([strongThis]() noexcept {
+              strongThis->ForEachViewHost([](auto &viewHost) noexcept { viewHost.UpdateViewInstanceInQueue(); });
+            });
+          }
+        }
+      });
+
+  whenLoaded.AsFuture().Then(
+      m_executor,
+      [weakThis = Mso::WeakPtr{this}, instance = warmInstance.Instance.Get()](Mso::Maybe<void> &&value) noexcept {
+        if (auto strongThis = weakThis.GetStrongPtr()) {
+          strongThis->OnWarmInstanceLoaded(instance, value.IsValue());
+        }
+      });
+
+  instancePool.push_back(std::move(warmInstance));
+}
+
+void ReactHost::OnWarmInstanceLoaded(IReactInstanceInternal *instance, bool isSucceeded) noexcept {
+  auto &instancePool = m_instancePool.Load();
+  auto it = std::find_if(instancePool.begin(), instancePool.end(), [instance](auto const &entry) {
+    return entry.Instance.Get() == instance;
+  });
+
+  // The instance was already destroyed.
+  if (it == instancePool.end()) {
+    return;
+  }
+
+  // We do not retry failed instances: the current instance reports the same error on reload.
+  if (!isSucceeded) {
+    auto failedInstance = std::move(it->Instance);
+    auto whenSettled = std::move(it->WhenSettled);
+    instancePool.erase(it);
+    failedInstance->Destroy();
+    whenSettled.TrySetValue();
+    return;
+  }
+
+  it->IsLoaded = true;
+  it->WhenSettled.TrySetValue();
+  FillInstancePoolInQueue();
+}
+
+std::optional<ReactHost::WarmInstance> ReactHost::TakeWarmInstanceInQueue(ReactOptions const &options) noexcept {
+  auto &instancePool = m_instancePool.Load();
+  auto it = std::find_if(instancePool.begin(), instancePool.end(), [&options](auto const &entry) {
+    return entry.IsLoaded && CanReuseWarmInstance(entry.Options, options);
+  });
+
+  if (it == instancePool.end()) {
+    return std::nullopt;
+  }
+
+  WarmInstance warmInstance = std::move(*it);
+  instancePool.erase(it);
+  return warmInstance;
+}
+
+void ReactHost::DestroyWarmInstancesInQueue() noexcept {
+  auto instancePool = std::exchange(m_instancePool.Load(), {});
+  for (auto &warmInstance : instancePool) {
+    warmInstance.Instance->Destroy();
+    warmInstance.WhenSettled.TrySetValue();
+  }
+}
+
+Mso::Future<void> ReactHost::LoadWarmInstanceInQueue(
+    WarmInstance &&warmInstance,
+    ReactOptions const &options) noexcept {
+  // From now on the instance changes the properties shared with the application.
+  winrt::get_self<winrt::Microsoft::ReactNative::implementation::StagedReactPropertyBag>(warmInstance.Properties)
+      ->Commit();
+  {
+    std::scoped_lock lock{warmInstance.Callbacks->Mutex};
+    warmInstance.Callbacks->OnError = options.OnError;
+    warmInstance.Callbacks->OnLogging = options.OnLogging;
+  }
+
+  *warmInstance.IsClaimed = true;
+  m_reactInstance.Exchange(Mso::Copy(warmInstance.Instance));
+
+  // The instance is already created and loaded: we raise both events for the application.
+  Mso::CntPtr<IReactContext> reactContext{&warmInstance.Instance->GetReactContext()};
+  if (options.OnInstanceCreated) {
+    options.OnInstanceCreated.Get()->Invoke(Mso::Copy(reactContext));
+  }
+
+  if (options.OnInstanceLoaded) {
+    options.OnInstanceLoaded.Get()->Invoke(Mso::Copy(reactContext), Mso::ErrorCode());
+  }
+
+  ForEachViewHost([](auto &viewHost) noexcept { viewHost.InitViewInstanceInQueue(viewHost.Options()); });
+
+  std::vector<Mso::Future<void>> loadCompletionList;
+  ForEachViewHost([&loadCompletionList](auto &viewHost) noexcept {
+    loadCompletionList.push_back(viewHost.UpdateViewInstanceInQueue());
+  });
+
+  FillInstancePoolInQueue();
+  return Mso::WhenAllCompleted(loadCompletionList);
+}
+
 //=============================================================================================
 // ReactHost implementation
 //=============================================================================================
@@ -224,6 +482,7 @@ void ReactHost::Finalize() noexcept {
   // If we are here, then it means that the current ref count is zero.
   // Since each AsyncAction has a strong ref count to ReactHost, the AsyncActionQueue must be empty.
   // Thus, we only need to call UnloadInQueue to unload ReactInstance if the ReactHost is not closed yet.
+  DestroyWarmInstancesInQueue();
   if (Mso::Promise<void> notifyWhenClosed = m_notifyWhenClosed.Exchange(nullptr)) {
     UnloadInQueue(0).Then<Mso::Executors::Inline>(
         [notifyWhenClosed = std::move(notifyWhenClosed)]() noexcept { notifyWhenClosed.TrySetValue(); });
@@ -233,6 +492,7 @@ void ReactHost::Finalize() noexcept {
 void ReactHost::Close() noexcept {
   InvokeInQueue([this]() noexcept {
     // Put the ReactHost to the closed state, unload ReactInstance, and notify the closing Promise.
+    DestroyWarmInstancesInQueue();
     auto whenClosed = m_actionQueue.Load()->PostAction(MakeUnloadInstanceAction());
 
     // After we set the m_notifyWhenClosed to null, the ReactHost is considered to be closed.
@@ -334,6 +594,26 @@ Mso::Future<void> ReactHost::LoadInQueue(ReactOptions &&options) noexcept {
     return Mso::MakeCanceledFuture();
   }
 
+  if (auto warmInstance = TakeWarmInstanceInQueue(options)) {
+    return LoadWarmInstanceInQueue(std::move(*warmInstance), options);
+  }
+
+  // A warm instance created for these options is still loading: we claim it once it is loaded instead of loading
+  // another instance.
+  auto &instancePool = m_instancePool.Load();
+  auto loadingIt = std::find_if(instancePool.begin(), instancePool.end(), [&options](auto const &entry) {
+    return !entry.IsLoaded && CanReuseWarmInstance(entry.Options, options);
+  });
+  if (loadingIt != instancePool.end()) {
+    return loadingIt->WhenSettled.AsFuture().Then(
+        m_executor, [this, options = std::move(options)](Mso::Maybe<void> && /*value*/) mutable noexcept {
+          return LoadInQueue(std::move(options));
+        });
+  }
+
+  // Warm instances left in the pool were created for different options.
+  DestroyWarmInstancesInQueue();
+
   Mso::Promise<void> whenCreated;
   Mso::Promise<void> whenLoaded;
 
@@ -359,6 +639,9 @@ Mso::Future<void> ReactHost::LoadInQueue(ReactOptions &&options) noexcept {
         loadCompletionList.push_back(viewHost.UpdateViewInstanceInQueue());
       });
 
+      // Warm the next instances only after the current one is loaded.
+      FillInstancePoolInQueue();
+
       return Mso::WhenAllCompleted(loadCompletionList);
     });
   });
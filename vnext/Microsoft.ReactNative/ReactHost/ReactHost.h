@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 #include "AsyncActionQueue.h"
 #include "IReactInstanceInternal.h"
 #include "InstanceFactory.h"
@@ -77,6 +80,32 @@ class ReactHost final : public Mso::ActiveObject<IReactHost> {
   AsyncAction MakeLoadInstanceAction(ReactOptions &&options) noexcept;
   AsyncAction MakeUnloadInstanceAction() noexcept;
 
+  //! Error and logging callbacks of a warm instance. The reload that claims the instance replaces them with its own.
+  struct WarmInstanceCallbacks {
+    std::mutex Mutex;
+    OnErrorCallback OnError;
+    OnLoggingCallback OnLogging;
+  };
+
+  //! A React instance that is loaded in the background to replace the current instance on reload.
+  //! Its property changes are staged in Properties until the instance is claimed.
+  struct WarmInstance {
+    Mso::CntPtr<IReactInstanceInternal> Instance;
+    ReactOptions Options;
+    winrt::Microsoft::ReactNative::IReactPropertyBag Properties;
+    std::shared_ptr<std::atomic<bool>> IsClaimed;
+    std::shared_ptr<WarmInstanceCallbacks> Callbacks;
+    //! Completed when the instance is loaded, fails to load, or is destroyed.
+    Mso::Promise<void> WhenSettled;
+    bool IsLoaded{false};
+  };
+
+  void FillInstancePoolInQueue() noexcept;
+  void OnWarmInstanceLoaded(IReactInstanceInternal *instance, bool isSucceeded) noexcept;
+  std::optional<WarmInstance> TakeWarmInstanceInQueue(ReactOptions const &options) noexcept;
+  void DestroyWarmInstancesInQueue() noexcept;
+  Mso::Future<void> LoadWarmInstanceInQueue(WarmInstance &&warmInstance, ReactOptions const &options) noexcept;
+
  private:
   mutable std::mutex m_mutex;
   const Mso::InvokeElsePostExecutor m_executor{Queue()};
@@ -92,6 +121,7 @@ class ReactHost final : public Mso::ActiveObject<IReactHost> {
   size_t m_pendingUnloadActionId{0};
   size_t m_nextUnloadActionId{0};
   const Mso::ActiveField<bool> m_isInstanceUnloading{false, Queue()};
+  const Mso::ActiveField<std::vector<WarmInstance>> m_instancePool{Queue()};
 };
 
 //! Implements a cross-platform host for a React view
@@ -59,6 +59,7 @@
 #include "Modules/NativeUIManager.h"
 #include "Modules/PaperUIManagerModule.h"
 #endif
+#include "Modules/PerformanceLoggerModule.h"
 #include "Modules/ReactRootViewTagGenerator.h"
 
 #ifndef CORE_ABI
@@ -233,6 +234,17 @@ ReactInstanceWin::ReactInstanceWin(
         whenLoaded.SetValue(std::move(value));
       });
 
+  if (m_options.OnStartupMarker) {
+    m_startupTimeline->SetListener([onStartupMarker = m_options.OnStartupMarker, reactContext = m_reactContext](
+                                       const Microsoft::React::StartupMarkerEntry &entry) noexcept {
+      onStartupMarker.Get()->Invoke(
+          Mso::CntPtr<Mso::React::IReactContext>{reactContext},
+          Microsoft::React::StartupTimeline::GetMarkerName(entry.Marker),
+          entry.Tag,
+          entry.ElapsedMilliseconds);
+    });
+  }
+
   // When the JS queue is shutdown, we set the m_whenDestroyed promise value as the last work item in the JS queue.
   // No JS queue work can be done after that for the instance.
   // The promise continuation synchronously calls the OnInstanceDestroyed event.
@@ -319,6 +331,10 @@ void ReactInstanceWin::LoadModules(
           ::Microsoft::ReactNativeSpecs::DeviceInfoSpec>());
 #endif
 
+  registerTurboModule(
+      L"PerformanceLogger",
+      winrt::Microsoft::ReactNative::MakeModuleProvider<::Microsoft::ReactNative::PerformanceLogger>());
+
   registerTurboModule(
       L"DevSettings",
       winrt::Microsoft::ReactNative::MakeTurboModuleProvider<
@@ -336,9 +352,13 @@ void ReactInstanceWin::LoadModules(
 
 //! Initialize() is called from the native queue.
 void ReactInstanceWin::Initialize() noexcept {
+  m_startupTimeline->Mark(Microsoft::React::StartupMarker::CreateQueuesStart);
   InitJSMessageThread();
   InitNativeMessageThread();
   InitUIMessageThread();
+  m_startupTimeline->Mark(Microsoft::React::StartupMarker::CreateQueuesStop);
+
+  Microsoft::ReactNative::PerformanceLogger::SetStartupTimeline(m_options.Properties, m_startupTimeline);
 
 #ifndef CORE_ABI
   // InitUIManager uses m_legacyReactInstance
@@ -383,6 +403,7 @@ void ReactInstanceWin::Initialize() noexcept {
       devSettings->useWebDebugger = m_useWebDebugger;
       devSettings->useFastRefresh = m_isFastReloadEnabled;
       // devSettings->memoryTracker = GetMemoryTracker();
+      devSettings->startupTimeline = m_startupTimeline;
       devSettings->bundleRootPath = BundleRootPath();
 
       devSettings->waitingForDebuggerCallback = GetWaitingForDebuggerCallback();
@@ -403,6 +424,7 @@ void ReactInstanceWin::Initialize() noexcept {
       // Bug https://office.visualstudio.com/DefaultCollection/OC/_workitems/edit/3441551 is tracking this
       devSettings->debuggerConsoleRedirection = false; // JSHost::ChangeGate::ChakraCoreDebuggerConsoleRedirection();
 
+      m_startupTimeline->Mark(Microsoft::React::StartupMarker::RegisterModulesStart);
 #ifdef CORE_ABI
       std::vector<facebook::react::NativeModuleDescription> cxxModules;
 #else
@@ -430,6 +452,8 @@ void ReactInstanceWin::Initialize() noexcept {
         cxxModules.insert(std::end(cxxModules), std::begin(customCxxModules), std::end(customCxxModules));
       }
 
+      m_startupTimeline->Mark(Microsoft::React::StartupMarker::RegisterModulesStop);
+
       std::unique_ptr<facebook::jsi::ScriptStore> scriptStore = nullptr;
       std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore = nullptr;
 
@@ -660,7 +684,8 @@ void ReactInstanceWin::InitUIMessageThread() noexcept {
   m_uiMessageThread.Exchange(
       std::make_shared<MessageDispatchQueue>(m_uiQueue, Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError)));
 
-  auto batchingUIThread = Microsoft::ReactNative::MakeBatchingQueueThread(m_uiMessageThread.Load());
+  auto batchingUIThread =
+      Microsoft::ReactNative::MakeBatchingQueueThread(m_uiMessageThread.Load(), m_options.UIBatchFrameBudget);
   m_batchingUIThread = batchingUIThread;
 
   ReactPropertyBag(m_reactContext->Properties())
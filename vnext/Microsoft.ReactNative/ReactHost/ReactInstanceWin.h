@@ -7,6 +7,7 @@
 #include "ReactContext.h"
 #include "ReactNativeHeaders.h"
 #include "React_win.h"
+#include "StartupTimeline.h"
 #include "activeObject/activeObject.h"
 
 #ifndef CORE_ABI
@@ -148,6 +149,8 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   const bool m_useWebDebugger : 1;
 
   const Mso::CntPtr<ReactContext> m_reactContext;
+  const std::shared_ptr<Microsoft::React::StartupTimeline> m_startupTimeline{
+      std::make_shared<Microsoft::React::StartupTimeline>()};
 
   std::atomic<bool> m_isLoaded{false};
   std::atomic<bool> m_isDestroyed{false};
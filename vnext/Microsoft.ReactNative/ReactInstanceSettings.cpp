@@ -38,6 +38,32 @@ winrt::Microsoft::ReactNative::IReactContext InstanceDestroyedEventArgs::Context
   return m_context;
 }
 
+StartupMarkerEventArgs::StartupMarkerEventArgs(
+    Mso::CntPtr<Mso::React::IReactContext> &&context,
+    hstring const &name,
+    hstring const &tag,
+    double elapsedMilliseconds)
+    : m_context(winrt::make<ReactContext>(std::move(context))),
+      m_name(name),
+      m_tag(tag),
+      m_elapsedMilliseconds(elapsedMilliseconds) {}
+
+winrt::Microsoft::ReactNative::IReactContext StartupMarkerEventArgs::Context() noexcept {
+  return m_context;
+}
+
+hstring StartupMarkerEventArgs::Name() noexcept {
+  return m_name;
+}
+
+hstring StartupMarkerEventArgs::Tag() noexcept {
+  return m_tag;
+}
+
+double StartupMarkerEventArgs::ElapsedMilliseconds() noexcept {
+  return m_elapsedMilliseconds;
+}
+
 ReactInstanceSettings::ReactInstanceSettings() noexcept {
   // Use current thread dispatcher as a default UI dispatcher.
   m_properties.Set(ReactDispatcherHelper::UIDispatcherProperty(), ReactDispatcherHelper::UIThreadDispatcher());
@@ -128,6 +154,11 @@ IReactPropertyName InstanceDestroyedEventName() noexcept {
   return propName;
 }
 
+IReactPropertyName StartupMarkerEventName() noexcept {
+  static IReactPropertyName propName = ReactPropertyBagHelper::GetName(InstanceSettingsNamespace(), L"StartupMarker");
+  return propName;
+}
+
 /*static*/ void ReactInstanceSettings::RaiseInstanceCreated(
     IReactNotificationService const &notificationService,
     winrt::Microsoft::ReactNative::InstanceCreatedEventArgs const &args) noexcept {
@@ -146,6 +177,12 @@ IReactPropertyName InstanceDestroyedEventName() noexcept {
   notificationService.SendNotification(InstanceDestroyedEventName(), nullptr, args);
 }
 
+/*static*/ void ReactInstanceSettings::RaiseStartupMarker(
+    IReactNotificationService const &notificationService,
+    winrt::Microsoft::ReactNative::StartupMarkerEventArgs const &args) noexcept {
+  notificationService.SendNotification(StartupMarkerEventName(), nullptr, args);
+}
+
 // Subscribes to a notification from a ReactNotificationService, then returns the IReactNotificationSubscription as a
 // event_token This allows easy implementation of winrt events which are implemented using the ReactNotifictionService.
 template <typename argsT>
@@ -205,4 +242,13 @@ void ReactInstanceSettings::InstanceDestroyed(winrt::event_token const &token) n
   unsubscribeFromNotifications(token);
 }
 
+winrt::event_token ReactInstanceSettings::StartupMarker(
+    Windows::Foundation::EventHandler<winrt::Microsoft::ReactNative::StartupMarkerEventArgs> const &handler) noexcept {
+  return subscribeToNotifications(Notifications(), StartupMarkerEventName(), handler);
+}
+
+void ReactInstanceSettings::StartupMarker(winrt::event_token const &token) noexcept {
+  unsubscribeFromNotifications(token);
+}
+
 } // namespace winrt::Microsoft::ReactNative::implementation
@@ -7,6 +7,7 @@
 #include "InstanceDestroyedEventArgs.g.h"
 #include "InstanceLoadedEventArgs.g.h"
 #include "ReactInstanceSettings.g.h"
+#include "StartupMarkerEventArgs.g.h"
 #include <winrt/Windows.Foundation.Collections.h>
 #include <winrt/Windows.Foundation.h>
 #include "React.h"
@@ -46,6 +47,26 @@ struct InstanceDestroyedEventArgs : InstanceDestroyedEventArgsT<InstanceDestroye
   winrt::Microsoft::ReactNative::IReactContext m_context;
 };
 
+struct StartupMarkerEventArgs : StartupMarkerEventArgsT<StartupMarkerEventArgs> {
+  StartupMarkerEventArgs() = default;
+  StartupMarkerEventArgs(
+      Mso::CntPtr<Mso::React::IReactContext> &&context,
+      hstring const &name,
+      hstring const &tag,
+      double elapsedMilliseconds);
+
+  winrt::Microsoft::ReactNative::IReactContext Context() noexcept;
+  hstring Name() noexcept;
+  hstring Tag() noexcept;
+  double ElapsedMilliseconds() noexcept;
+
+ private:
+  winrt::Microsoft::ReactNative::IReactContext m_context;
+  hstring m_name;
+  hstring m_tag;
+  double m_elapsedMilliseconds;
+};
+
 struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   ReactInstanceSettings() noexcept;
 
@@ -127,6 +148,15 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   JSIEngine JSIEngineOverride() noexcept;
   void JSIEngineOverride(JSIEngine value) noexcept;
 
+  Windows::Foundation::TimeSpan UIBatchFrameBudget() noexcept;
+  void UIBatchFrameBudget(Windows::Foundation::TimeSpan const &value) noexcept;
+
+  bool EnableParallelRootLayout() noexcept;
+  void EnableParallelRootLayout(bool value) noexcept;
+
+  uint32_t InstancePoolSize() noexcept;
+  void InstancePoolSize(uint32_t value) noexcept;
+
   winrt::event_token InstanceCreated(
       Windows::Foundation::EventHandler<winrt::Microsoft::ReactNative::InstanceCreatedEventArgs> const
           &handler) noexcept;
@@ -142,6 +172,11 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
           &handler) noexcept;
   void InstanceDestroyed(winrt::event_token const &token) noexcept;
 
+  winrt::event_token StartupMarker(
+      Windows::Foundation::EventHandler<winrt::Microsoft::ReactNative::StartupMarkerEventArgs> const
+          &handler) noexcept;
+  void StartupMarker(winrt::event_token const &token) noexcept;
+
   static void RaiseInstanceCreated(
       IReactNotificationService const &notificationService,
       winrt::Microsoft::ReactNative::InstanceCreatedEventArgs const &args) noexcept;
@@ -151,6 +186,9 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   static void RaiseInstanceDestroyed(
       IReactNotificationService const &notificationService,
       winrt::Microsoft::ReactNative::InstanceDestroyedEventArgs const &args) noexcept;
+  static void RaiseStartupMarker(
+      IReactNotificationService const &notificationService,
+      winrt::Microsoft::ReactNative::StartupMarkerEventArgs const &args) noexcept;
 
  private:
   IReactPropertyBag m_properties{ReactPropertyBagHelper::CreatePropertyBag()};
@@ -167,6 +205,9 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   IRedBoxHandler m_redBoxHandler{nullptr};
   hstring m_sourceBundleHost{};
   uint16_t m_sourceBundlePort{0};
+  Windows::Foundation::TimeSpan m_uiBatchFrameBudget{0};
+  bool m_enableParallelRootLayout{false};
+  uint32_t m_instancePoolSize{0};
 
 #if USE_HERMES
   JSIEngine m_jSIEngineOverride{JSIEngine::Hermes};
@@ -292,4 +333,28 @@ inline void ReactInstanceSettings::JSIEngineOverride(JSIEngine value) noexcept {
   m_jSIEngineOverride = value;
 }
 
+inline Windows::Foundation::TimeSpan ReactInstanceSettings::UIBatchFrameBudget() noexcept {
+  return m_uiBatchFrameBudget;
+}
+
+inline void ReactInstanceSettings::UIBatchFrameBudget(Windows::Foundation::TimeSpan const &value) noexcept {
+  m_uiBatchFrameBudget = value;
+}
+
+inline bool ReactInstanceSettings::EnableParallelRootLayout() noexcept {
+  return m_enableParallelRootLayout;
+}
+
+inline void ReactInstanceSettings::EnableParallelRootLayout(bool value) noexcept {
+  m_enableParallelRootLayout = value;
+}
+
+inline uint32_t ReactInstanceSettings::InstancePoolSize() noexcept {
+  return m_instancePoolSize;
+}
+
+inline void ReactInstanceSettings::InstancePoolSize(uint32_t value) noexcept {
+  m_instancePoolSize = value;
+}
+
 } // namespace winrt::Microsoft::ReactNative::implementation
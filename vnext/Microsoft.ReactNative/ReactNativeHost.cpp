@@ -112,6 +112,7 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
   reactOptions.SetDebuggerBreakOnNextLine(m_instanceSettings.DebuggerBreakOnNextLine());
   reactOptions.SetUseFastRefresh(m_instanceSettings.UseFastRefresh());
   reactOptions.SetUseLiveReload(m_instanceSettings.UseLiveReload());
+  reactOptions.SetEnableParallelRootLayout(m_instanceSettings.EnableParallelRootLayout());
   reactOptions.EnableJITCompilation = m_instanceSettings.EnableJITCompilation();
   reactOptions.BundleRootPath = to_string(m_instanceSettings.BundleRootPath());
   reactOptions.DeveloperSettings.DebuggerPort = m_instanceSettings.DebuggerPort();
@@ -124,6 +125,9 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
   reactOptions.ByteCodeFileUri = to_string(m_instanceSettings.ByteCodeFileUri());
   reactOptions.EnableByteCodeCaching = m_instanceSettings.EnableByteCodeCaching();
   reactOptions.JsiEngine = static_cast<Mso::React::JSIEngine>(m_instanceSettings.JSIEngineOverride());
+  reactOptions.UIBatchFrameBudget =
+      std::chrono::duration_cast<std::chrono::milliseconds>(m_instanceSettings.UIBatchFrameBudget());
+  reactOptions.InstancePoolSize = m_instanceSettings.InstancePoolSize();
 
   reactOptions.ModuleProvider = modulesProvider;
 #ifndef CORE_ABI
@@ -146,6 +150,16 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
     ReactInstanceSettings::RaiseInstanceDestroyed(
         notifications, winrt::make<InstanceDestroyedEventArgs>(std::move(context)));
   };
+  reactOptions.OnStartupMarker = [](Mso::CntPtr<Mso::React::IReactContext> &&context,
+                                   const char *name,
+                                   const std::string &tag,
+                                   double elapsedMilliseconds) {
+    auto notifications = context->Notifications();
+    ReactInstanceSettings::RaiseStartupMarker(
+        notifications,
+        winrt::make<StartupMarkerEventArgs>(
+            std::move(context), winrt::to_hstring(name), winrt::to_hstring(tag), elapsedMilliseconds));
+  };
 
   std::string jsBundleFile = to_string(m_instanceSettings.JavaScriptBundleFile());
   if (jsBundleFile.empty()) {
@@ -41,4 +41,18 @@ void ReactPackageBuilder::AddTurboModule(
   m_turboModulesProvider->AddModuleProvider(moduleName, moduleProvider);
 }
 
+void ReactPackageBuilder::AddEagerModule(
+    hstring const &moduleName,
+    ReactModuleProvider const &moduleProvider,
+    Windows::Foundation::Collections::IVectorView<hstring> const &dependencies) noexcept {
+  std::vector<std::string> dependencyNames;
+  if (dependencies) {
+    for (auto const &dependency : dependencies) {
+      dependencyNames.push_back(to_string(dependency));
+    }
+  }
+
+  m_modulesProvider->AddEagerModuleProvider(moduleName, moduleProvider, std::move(dependencyNames));
+}
+
 } // namespace winrt::Microsoft::ReactNative
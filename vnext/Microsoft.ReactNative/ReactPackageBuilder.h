@@ -26,6 +26,10 @@ struct ReactPackageBuilder
   void AddViewManager(hstring const &viewManagerName, ReactViewManagerProvider const &viewManagerProvider) noexcept;
 #endif
   void AddTurboModule(hstring const &moduleName, ReactModuleProvider const &moduleProvider) noexcept;
+  void AddEagerModule(
+      hstring const &moduleName,
+      ReactModuleProvider const &moduleProvider,
+      Windows::Foundation::Collections::IVectorView<hstring> const &dependencies) noexcept;
 
  private:
   std::shared_ptr<NativeModulesProvider> m_modulesProvider;
@@ -346,4 +346,10 @@ void TurboModulesProvider::AddModuleProvider(
   }
 }
 
+std::shared_ptr<TurboModulesProvider> TurboModulesProvider::CloneModuleProviders() const noexcept {
+  auto clone = std::make_shared<TurboModulesProvider>();
+  clone->m_moduleProviders = m_moduleProviders;
+  return clone;
+}
+
 } // namespace winrt::Microsoft::ReactNative
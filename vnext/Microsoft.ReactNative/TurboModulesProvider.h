@@ -28,6 +28,9 @@ class TurboModulesProvider final : public facebook::react::TurboModuleRegistry {
   void SetReactContext(const IReactContext &reactContext) noexcept;
   void AddModuleProvider(winrt::hstring const &moduleName, ReactModuleProvider const &moduleProvider) noexcept;
 
+  // Creates a provider with the same module providers that can be used by another React instance.
+  std::shared_ptr<TurboModulesProvider> CloneModuleProviders() const noexcept;
+
  private:
   std::unordered_map<std::string, ReactModuleProvider> m_moduleProviders;
   IReactContext m_reactContext;
@@ -6,6 +6,7 @@
 #include <DynamicReader.h>
 #include <JSValueWriter.h>
 #include <JsiWriter.h>
+#include <Modules/Animated/NativeAnimatedModule.h>
 #include <Views/SIPEventHandler.h>
 #include <Views/ShadowNodeBase.h>
 #include "Impl/ScrollViewUWPImplementation.h"
@@ -338,6 +339,19 @@ void ScrollViewShadowNode::EmitScrollEvent(
     CoalesceType coalesceType) {
   const auto scrollViewerNotNull = scrollViewer;
 
+  // Animated events mapped from the scroll event read its native data, before any of the JS payload is built.
+  if (const auto animatedNodeManager = GetNativeAnimatedNodeManager(GetViewManager()->GetReactContext()).lock()) {
+    ScrollEventData eventData;
+    eventData.ContentOffsetX = x;
+    eventData.ContentOffsetY = y;
+    eventData.ContentSizeWidth = scrollViewerNotNull.ExtentWidth();
+    eventData.ContentSizeHeight = scrollViewerNotNull.ExtentHeight();
+    eventData.LayoutMeasurementWidth = scrollViewerNotNull.ActualWidth();
+    eventData.LayoutMeasurementHeight = scrollViewerNotNull.ActualHeight();
+    eventData.ZoomScale = zoom;
+    animatedNodeManager->DispatchAnimatedEvent(tag, eventName, eventData);
+  }
+
   JSValueObject contentOffset{{"x", x}, {"y", y}};
   JSValueObject contentInset{{"left", 0}, {"top", 0}, {"right", 0}, {"bottom", 0}};
 
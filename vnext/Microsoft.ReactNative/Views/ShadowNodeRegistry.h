@@ -4,7 +4,7 @@
 #pragma once
 #include <Views/PaperShadowNode.h>
 #include <functional/functorref.h>
-#include <map>
+#include <unordered_map>
 
 namespace Microsoft::ReactNative {
 
@@ -36,7 +36,7 @@ struct ShadowNodeRegistry {
 
  private:
   std::unordered_set<int64_t> m_roots;
-  std::map<int64_t, std::unique_ptr<ShadowNode, ShadowNodeDeleter>> m_allNodes;
+  std::unordered_map<int64_t, std::unique_ptr<ShadowNode, ShadowNodeDeleter>> m_allNodes;
 };
 
 } // namespace Microsoft::ReactNative
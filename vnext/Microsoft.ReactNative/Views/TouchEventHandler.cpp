@@ -12,6 +12,7 @@
 #include <react/renderer/components/view/TouchEventEmitter.h>
 #endif
 
+#include <Modules/Animated/NativeAnimatedModule.h>
 #include <Modules/NativeUIManager.h>
 #include <Modules/PaperUIManagerModule.h>
 #include <UI.Xaml.Controls.h>
@@ -471,6 +472,20 @@ void TouchEventHandler::DispatchTouchEvent(TouchEventType eventType, size_t poin
     if (eventName == nullptr)
       return;
 
+    // Animated events mapped from the changed pointer read it directly, rather than through the JS payload.
+    if (const auto animatedNodeManager = GetNativeAnimatedNodeManager(*m_context).lock()) {
+      const auto &pointer = m_pointers[pointerIndex];
+      PointerEventData eventData;
+      eventData.PageX = pointer.positionRoot.X;
+      eventData.PageY = pointer.positionRoot.Y;
+      eventData.LocationX = pointer.positionView.X;
+      eventData.LocationY = pointer.positionView.Y;
+      eventData.Timestamp = static_cast<double>(pointer.timestamp);
+      eventData.Force = pointer.pressure;
+      eventData.Identifier = static_cast<double>(pointer.identifier);
+      animatedNodeManager->DispatchAnimatedEvent(pointer.target, eventName, eventData);
+    }
+
     const auto paramsWriter = MakeJSValueArgWriter(eventName, std::move(touches), std::move(changedIndices));
     if (eventType == TouchEventType::Move || eventType == TouchEventType::PointerMove) {
       BatchingEmitter().EmitCoalescingJSEvent(
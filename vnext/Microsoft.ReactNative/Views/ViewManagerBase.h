@@ -19,9 +19,16 @@ struct ShadowNodeBase;
 struct ShadowNode;
 
 struct YogaContext {
-  YogaContext(const XamlView &view_) : view(view_) {}
+  YogaContext(const XamlView &view_, ShadowNodeBase *shadowNode_ = nullptr) : view(view_), shadowNode(shadowNode_) {}
 
   XamlView view;
+
+  // The shadow node owning the yoga node, so that applying layout results does not need to look up the tag.
+  ShadowNodeBase *shadowNode;
+
+  // The measure function of the view manager. Yoga calls it through NativeUIManager, which makes sure that the
+  // XAML element is measured on the UI thread.
+  YGMeasureFunc measureFunc{nullptr};
 };
 
 REACTWINDOWS_EXPORT YGSize DefaultYogaSelfMeasureFunc(
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <JSI/ByteArrayBuffer.h>
+#include <JSI/ChakraRuntimeFactory.h>
+#include <jsi/decorator.h>
+#include <jsi/jsi/test/testlib.h>
+
+// Standard Library
+#include <memory>
+
+using facebook::jsi::ArrayBuffer;
+using facebook::jsi::Runtime;
+using facebook::jsi::RuntimeFactory;
+using Microsoft::JSI::ByteArrayBuffer;
+using Microsoft::JSI::MakeExternalArrayBuffer;
+
+#if !defined(USE_V8)
+
+namespace {
+
+// A runtime that is not a ChakraRuntime, although it forwards to one.
+struct DecoratedRuntime : facebook::jsi::RuntimeDecorator<Runtime> {
+  explicit DecoratedRuntime(Runtime &plain) : RuntimeDecorator(plain) {}
+};
+
+std::unique_ptr<Runtime> MakeChakraRuntimeForTest() {
+  // Without V8 the JSI tests run against ChakraRuntime.
+  return facebook::jsi::runtimeGenerators().front()();
+}
+
+} // namespace
+
+TEST(ChakraRuntimeTest, ExternalArrayBufferSharesMemory) {
+  auto runtime = MakeChakraRuntimeForTest();
+  Runtime &rt = *runtime;
+
+  auto buffer = std::make_unique<ByteArrayBuffer>(4);
+  for (uint8_t i = 0; i < 4; ++i) {
+    buffer->data()[i] = i + 1;
+  }
+  uint8_t *data = buffer->data();
+
+  ArrayBuffer arrayBuffer = MakeExternalArrayBuffer(rt, std::move(buffer));
+  EXPECT_EQ(4u, arrayBuffer.size(rt));
+  EXPECT_EQ(data, arrayBuffer.data(rt));
+
+  rt.global().setProperty(rt, "externalBuffer", arrayBuffer);
+  auto sum = rt.evaluateJavaScript(
+      std::make_shared<facebook::jsi::StringBuffer>(
+          "var bytes = new Uint8Array(externalBuffer); bytes[0] = 10; bytes[0] + bytes[1] + bytes[2] + bytes[3];"),
+      "");
+  EXPECT_EQ(19, sum.getNumber());
+  EXPECT_EQ(10, arrayBuffer.data(rt)[0]);
+}
+
+TEST(ChakraRuntimeTest, ExternalArrayBufferCopiesForOtherRuntimes) {
+  auto runtime = MakeChakraRuntimeForTest();
+  DecoratedRuntime decoratedRuntime{*runtime};
+  Runtime &rt = decoratedRuntime;
+
+  auto buffer = std::make_unique<ByteArrayBuffer>(4);
+  for (uint8_t i = 0; i < 4; ++i) {
+    buffer->data()[i] = i + 1;
+  }
+  uint8_t *data = buffer->data();
+
+  ArrayBuffer arrayBuffer = MakeExternalArrayBuffer(rt, std::move(buffer));
+  ASSERT_EQ(4u, arrayBuffer.size(rt));
+  EXPECT_NE(data, arrayBuffer.data(rt));
+  for (uint8_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(i + 1, arrayBuffer.data(rt)[i]);
+  }
+}
+
+TEST(ChakraRuntimeTest, ExternalArrayBufferWithoutBytesIsEmpty) {
+  auto runtime = MakeChakraRuntimeForTest();
+  DecoratedRuntime decoratedRuntime{*runtime};
+
+  EXPECT_EQ(0u, MakeExternalArrayBuffer(*runtime, nullptr).size(*runtime));
+  EXPECT_EQ(0u, MakeExternalArrayBuffer(*runtime, std::make_unique<ByteArrayBuffer>(0)).size(*runtime));
+  EXPECT_EQ(0u, MakeExternalArrayBuffer(decoratedRuntime, nullptr).size(decoratedRuntime));
+  EXPECT_EQ(
+      0u, MakeExternalArrayBuffer(decoratedRuntime, std::make_unique<ByteArrayBuffer>(0)).size(decoratedRuntime));
+}
+
+#endif // !defined(USE_V8)
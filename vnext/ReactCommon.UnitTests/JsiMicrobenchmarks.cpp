@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// JSI microbenchmarks for the marshalling-heavy paths: property access, array fill and string creation.
+// They use the same runtime generators as the JSI tests, so they run against any JSI engine the tests are
+// built with. Each benchmark records its time per operation as a test property.
+//
+// Benchmarks are disabled by default. Run them with:
+//   ReactCommon.UnitTests.exe --gtest_also_run_disabled_tests --gtest_filter=*/DISABLED_JsiMicrobenchmarks.*
+
+#include <jsi/jsi/test/testlib.h>
+
+// Standard Library
+#include <chrono>
+#include <string>
+
+using facebook::jsi::Array;
+using facebook::jsi::JSITestBase;
+using facebook::jsi::Object;
+using facebook::jsi::PropNameID;
+using facebook::jsi::String;
+using facebook::jsi::Value;
+
+namespace {
+
+constexpr int IterationCount = 100000;
+
+class DISABLED_JsiMicrobenchmarks : public JSITestBase {
+ protected:
+  template <typename TBody>
+  void Measure(const char *name, int operationCount, TBody body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    RecordProperty(name, std::to_string(elapsed.count() / operationCount) + " ns/op");
+  }
+};
+
+TEST_P(DISABLED_JsiMicrobenchmarks, ObjectPropertyGetSet) {
+  Object object{rt};
+  PropNameID propName = PropNameID::forAscii(rt, "value");
+
+  Measure("setProperty", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      object.setProperty(rt, propName, i);
+    }
+  });
+
+  double sum = 0;
+  Measure("getProperty", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      sum += object.getProperty(rt, propName).getNumber();
+    }
+  });
+
+  EXPECT_EQ(static_cast<double>(IterationCount - 1) * IterationCount, sum);
+}
+
+TEST_P(DISABLED_JsiMicrobenchmarks, ObjectPropertyGetSetByName) {
+  Object object{rt};
+
+  Measure("setPropertyByName", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      object.setProperty(rt, "value", Object{rt});
+    }
+  });
+
+  Measure("getPropertyAsObject", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      EXPECT_TRUE(object.getProperty(rt, "value").isObject());
+    }
+  });
+}
+
+TEST_P(DISABLED_JsiMicrobenchmarks, ArrayFill) {
+  Array array{rt, IterationCount};
+
+  Measure("setValueAtIndex", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      array.setValueAtIndex(rt, i, Value{i});
+    }
+  });
+
+  Measure("getValueAtIndex", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      EXPECT_EQ(static_cast<double>(i), array.getValueAtIndex(rt, i).getNumber());
+    }
+  });
+}
+
+TEST_P(DISABLED_JsiMicrobenchmarks, StringCreation) {
+  const std::string ascii = "The quick brown fox jumps over the lazy dog";
+
+  Measure("createFromAscii", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      String str = String::createFromAscii(rt, ascii);
+    }
+  });
+
+  Measure("createFromUtf8AndConvert", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      EXPECT_EQ(ascii.size(), String::createFromUtf8(rt, ascii).utf8(rt).size());
+    }
+  });
+}
+
+TEST_P(DISABLED_JsiMicrobenchmarks, ValueCopy) {
+  Value value{rt, Object{rt}};
+
+  Measure("copyObjectValue", IterationCount, [&]() {
+    for (int i = 0; i < IterationCount; ++i) {
+      Value copy{rt, value};
+    }
+  });
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    DISABLED_JsiMicrobenchmarks,
+    ::testing::ValuesIn(facebook::jsi::runtimeGenerators()));
+
+} // namespace
@@ -10,10 +10,37 @@ namespace react {
 
 class Instance;
 
+// Kind of a view operation queued with BatchingMessageQueueThread::runCoalescingOnQueue.
+enum class CoalescingOperationKind {
+  CreateView,
+  UpdateView,
+  // Any other operation on the view. It is never merged, and like work queued with runOnQueue, it prevents all
+  // earlier operations from absorbing later ones.
+  Other,
+};
+
+// An operation targeting a single view that can absorb later operations on the same view queued within the same
+// batch, so that redundant work never reaches the UI thread.
+struct ICoalescingOperation {
+  virtual ~ICoalescingOperation() noexcept = default;
+
+  virtual int64_t Tag() const noexcept = 0;
+  virtual CoalescingOperationKind Kind() const noexcept = 0;
+
+  // Tries to merge the next operation queued for the same view into this one.
+  // Returns true if the next operation was merged and must not be executed on its own.
+  virtual bool TryCoalesce(ICoalescingOperation &next) noexcept = 0;
+
+  virtual void Execute() noexcept = 0;
+};
+
 class BatchingMessageQueueThread : public MessageQueueThread {
  public:
   virtual void onBatchComplete() = 0;
   virtual void decoratedNativeCallInvokerReady(std::weak_ptr<facebook::react::Instance> wkInstance) noexcept = 0;
+
+  // Queues an operation for a view. It may be merged with the previous operation for the same view in this batch.
+  virtual void runCoalescingOnQueue(std::shared_ptr<ICoalescingOperation> &&operation) noexcept = 0;
 };
 
 } // namespace react
@@ -6,6 +6,7 @@
 #include "ChakraRuntimeHolder.h"
 
 #include <JSI/ChakraRuntimeFactory.h>
+#include <StartupTimeline.h>
 
 namespace Microsoft::JSI {
 
@@ -23,8 +24,14 @@ std::shared_ptr<facebook::jsi::Runtime> ChakraRuntimeHolder::getRuntime() noexce
 }
 
 void ChakraRuntimeHolder::initRuntime() noexcept {
+  if (startupTimeline_)
+    startupTimeline_->Mark(Microsoft::React::StartupMarker::InitializeRuntimeStart);
+
   runtime_ = Microsoft::JSI::makeChakraRuntime(std::move(args_));
   own_thread_id_ = std::this_thread::get_id();
+
+  if (startupTimeline_)
+    startupTimeline_->Mark(Microsoft::React::StartupMarker::InitializeRuntimeStop);
 }
 
 Logger ChakraRuntimeHolder::ChakraRuntimeLoggerFromReactLogger(
@@ -54,6 +61,13 @@ ChakraRuntimeArgs ChakraRuntimeHolder::RuntimeArgsFromDevSettings(
 
   runtimeArgs.memoryTracker = devSettings->memoryTracker;
 
+  if (auto startupTimeline = devSettings->startupTimeline) {
+    runtimeArgs.preparedScriptCallback = [startupTimeline](const std::string &sourceURL, bool found) {
+      using Microsoft::React::StartupMarker;
+      startupTimeline->Mark(found ? StartupMarker::ByteCodeCacheHit : StartupMarker::ByteCodeCacheMiss, sourceURL);
+    };
+  }
+
   return runtimeArgs;
 }
 
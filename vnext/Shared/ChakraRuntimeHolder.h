@@ -21,7 +21,7 @@ class ChakraRuntimeHolder final : public facebook::jsi::RuntimeHolderLazyInit {
       std::shared_ptr<facebook::react::MessageQueueThread> jsQueue,
       std::unique_ptr<facebook::jsi::ScriptStore> &&scriptStore,
       std::unique_ptr<facebook::jsi::PreparedScriptStore> &&preparedScriptStore) noexcept
-      : args_(RuntimeArgsFromDevSettings(devSettings)) {
+      : args_(RuntimeArgsFromDevSettings(devSettings)), startupTimeline_(devSettings->startupTimeline) {
     args_.jsQueue = std::move(jsQueue);
     args_.scriptStore = std::move(scriptStore);
     args_.preparedScriptStore = std::move(preparedScriptStore);
@@ -37,6 +37,7 @@ class ChakraRuntimeHolder final : public facebook::jsi::RuntimeHolderLazyInit {
 
   Microsoft::JSI::ChakraRuntimeArgs args_;
   std::shared_ptr<facebook::jsi::Runtime> runtime_;
+  std::shared_ptr<Microsoft::React::StartupTimeline> startupTimeline_;
 
   std::once_flag once_flag_;
   std::thread::id own_thread_id_;
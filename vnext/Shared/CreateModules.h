@@ -34,4 +34,8 @@ namespace Microsoft::React {
 
 extern std::unique_ptr<facebook::xplat::module::CxxModule> CreateWebSocketModule() noexcept;
 
+extern std::unique_ptr<facebook::xplat::module::CxxModule> CreateBlobModule() noexcept;
+
+extern std::unique_ptr<facebook::xplat::module::CxxModule> CreateFileReaderModule() noexcept;
+
 } // namespace Microsoft::React
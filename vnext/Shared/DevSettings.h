@@ -21,6 +21,10 @@ struct RuntimeHolderLazyInit;
 }
 } // namespace facebook
 
+namespace Microsoft::React {
+class StartupTimeline;
+} // namespace Microsoft::React
+
 namespace facebook {
 namespace react {
 
@@ -83,6 +87,9 @@ struct DevSettings {
   /// Dispatcher for notifications about JS engine memory consumption.
   std::shared_ptr<MemoryTracker> memoryTracker;
 
+  /// Records the startup phases of the instance, or null to not record them.
+  std::shared_ptr<Microsoft::React::StartupTimeline> startupTimeline;
+
   /// A factory and holder of jsi::Runtime instance to be used for this react
   /// instance. This object should in general be used only from the JS engine
   /// thread, unless the specific runtime implementation explicitly guarantees
@@ -11,6 +11,7 @@
 #include <cxxreact/SystraceSection.h>
 #include <hermes/hermes.h>
 #include "HermesRuntimeHolder.h"
+#include "StartupTimeline.h"
 
 #if defined(HERMES_ENABLE_DEBUGGER)
 #include <hermes/inspector/chrome/Registration.h>
@@ -86,6 +87,9 @@ HermesRuntimeHolder::HermesRuntimeHolder(
     : m_devSettings(std::move(devSettings)), m_jsQueue(std::move(jsQueue)) {}
 
 void HermesRuntimeHolder::initRuntime() noexcept {
+  if (m_devSettings->startupTimeline)
+    m_devSettings->startupTimeline->Mark(Microsoft::React::StartupMarker::InitializeRuntimeStart);
+
   auto runtimeConfig = ::hermes::vm::RuntimeConfig();
   auto hermesRuntime = makeHermesRuntimeSystraced(runtimeConfig);
   facebook::hermes::HermesRuntime &hermesRuntimeRef = *hermesRuntime;
@@ -105,6 +109,9 @@ void HermesRuntimeHolder::initRuntime() noexcept {
   auto errorPrototype =
       m_runtime->global().getPropertyAsObject(*m_runtime, "Error").getPropertyAsObject(*m_runtime, "prototype");
   errorPrototype.setProperty(*m_runtime, "jsEngine", "hermes");
+
+  if (m_devSettings->startupTimeline)
+    m_devSettings->startupTimeline->Mark(Microsoft::React::StartupMarker::InitializeRuntimeStop);
 }
 
 } // namespace react
@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -74,6 +75,15 @@ struct IWebSocketResource {
     const ErrorType Type;
   };
 
+  /// <summary>
+  /// Range of a buffer that other owners, such as blobs, may share.
+  /// </summary>
+  struct SharedBytes {
+    std::shared_ptr<const std::vector<std::uint8_t>> Buffer;
+    std::size_t Offset{0};
+    std::size_t Size{0};
+  };
+
 #pragma endregion Inner types
 
   /// <summary>
@@ -120,6 +130,22 @@ struct IWebSocketResource {
   /// </param>
   virtual void SendBinary(std::string &&base64String) noexcept = 0;
 
+  /// <summary>
+  /// Sends a binary message to the remote endpoint without any encoding.
+  /// </summary>
+  /// <param name="message">
+  /// Raw bytes of the binary message.
+  /// </param>
+  virtual void SendBinary(std::vector<std::uint8_t> &&message) noexcept = 0;
+
+  /// <summary>
+  /// Sends a binary message read in place from a shared buffer.
+  /// </summary>
+  /// <param name="message">
+  /// Raw bytes of the binary message. The buffer is kept alive until the message is sent.
+  /// </param>
+  virtual void SendBinary(SharedBytes &&message) noexcept = 0;
+
   /// <summary>
   /// Terminates this resource's connection to the remote endpoint.
   /// This instance can't be restarted or re-connected afterwards.
@@ -166,6 +192,16 @@ struct IWebSocketResource {
   virtual void SetOnMessage(
       std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept = 0;
 
+  /// <summary>
+  /// Sets the optional custom behavior to run when there is an incoming
+  /// binary message.
+  /// If set, binary messages are passed to this handler as raw bytes instead of being
+  /// Base64-encoded and passed to the <c>SetOnMessage</c> handler.
+  /// </summary>
+  /// <param name="handler">
+  /// </param>
+  virtual void SetOnBinaryMessage(std::function<void(std::vector<std::uint8_t> &&)> &&handler) noexcept = 0;
+
   /// <summary>
   /// Sets the optional custom behavior to run when this instance is closed.
   /// </summary>
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstring>
+
+namespace Microsoft::JSI {
+
+// Creates a JS ArrayBuffer and copies the bytes into it.
+// Works with any JSI runtime. Must be called on the thread of the runtime.
+inline facebook::jsi::ArrayBuffer
+CreateArrayBufferCopy(facebook::jsi::Runtime &runtime, const uint8_t *data, size_t size) {
+  auto arrayBuffer = runtime.global()
+                         .getPropertyAsFunction(runtime, "ArrayBuffer")
+                         .callAsConstructor(runtime, static_cast<double>(size))
+                         .getObject(runtime)
+                         .getArrayBuffer(runtime);
+  if (size > 0) {
+    std::memcpy(arrayBuffer.data(runtime), data, size);
+  }
+
+  return arrayBuffer;
+}
+
+} // namespace Microsoft::JSI
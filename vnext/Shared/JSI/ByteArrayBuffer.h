@@ -5,13 +5,16 @@
 
 #include <jsi/jsi.h>
 
-#include <memory>
+#include <vector>
 
 namespace Microsoft::JSI {
 
 class ByteArrayBuffer final : public facebook::jsi::Buffer {
  public:
-  ByteArrayBuffer(size_t bufferSize) : m_size(bufferSize), m_data(std::make_unique<uint8_t[]>(bufferSize)) {}
+  ByteArrayBuffer(size_t bufferSize) : m_data(bufferSize) {}
+
+  // Takes over the bytes without copying them.
+  explicit ByteArrayBuffer(std::vector<uint8_t> &&bytes) noexcept : m_data(std::move(bytes)) {}
 
   ByteArrayBuffer(const ByteArrayBuffer &) = delete;
   ByteArrayBuffer &operator=(const ByteArrayBuffer &) = delete;
@@ -20,20 +23,19 @@ class ByteArrayBuffer final : public facebook::jsi::Buffer {
   ByteArrayBuffer &operator=(ByteArrayBuffer &&) = default;
 
   size_t size() const override {
-    return m_size;
+    return m_data.size();
   }
 
   const uint8_t *data() const {
-    return m_data.get();
+    return m_data.data();
   }
 
   uint8_t *data() {
-    return m_data.get();
+    return m_data.data();
   }
 
  private:
-  size_t m_size;
-  std::unique_ptr<uint8_t[]> m_data;
+  std::vector<uint8_t> m_data;
 };
 
 } // namespace Microsoft::JSI
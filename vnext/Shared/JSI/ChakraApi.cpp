@@ -419,6 +419,17 @@ ChakraApi::DefineProperty(JsValueRef object, JsPropertyIdRef propertyId, JsValue
   return result;
 }
 
+/*static*/ JsValueRef ChakraApi::CreateExternalArrayBuffer(
+    void *data,
+    size_t byteLength,
+    JsFinalizeCallback finalizeCallback,
+    void *callbackState) {
+  JsValueRef result{JS_INVALID_REFERENCE};
+  ChakraVerifyJsErrorElseThrow(JsCreateExternalArrayBuffer(
+      data, static_cast<unsigned int>(byteLength), finalizeCallback, callbackState, &result));
+  return result;
+}
+
 /*static*/ ChakraApi::Span<std::byte> ChakraApi::GetArrayBufferStorage(JsValueRef arrayBuffer) {
   BYTE *buffer{nullptr};
   unsigned int bufferLength{0};
@@ -408,6 +408,17 @@ struct ChakraApi {
    */
   static JsValueRef CreateArrayBuffer(size_t byteLength);
 
+  /**
+   * @brief Creates a JavaScript ArrayBuffer object that uses the external memory.
+   *
+   * The finalizeCallback is called with the callbackState when the ArrayBuffer is garbage collected.
+   */
+  static JsValueRef CreateExternalArrayBuffer(
+      void *data,
+      size_t byteLength,
+      JsFinalizeCallback finalizeCallback,
+      void *callbackState);
+
   /**
    * @brief A span of values that can be used to pass arguments to function.
    *
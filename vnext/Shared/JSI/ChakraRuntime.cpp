@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "ChakraRuntime.h"
+#include "ArrayBufferHelpers.h"
 #include "ChakraRuntimeFactory.h"
 
 #include <MemoryTracker.h>
@@ -67,6 +68,7 @@ void ChakraRuntime::Init() noexcept {
   }
 
   m_runtime = CreateRuntime(runtimeAttributes, nullptr);
+  m_pointerValuePool = std::make_unique<ChakraPointerValuePool>();
 
   setupMemoryTracker();
 
@@ -110,9 +112,15 @@ void ChakraRuntime::Init() noexcept {
 /*virtual*/ ChakraRuntime::~ChakraRuntime() noexcept {
   m_undefinedValue = {};
   m_propertyId = {};
+  m_propertyNameCache = {};
   m_proxyConstructor = {};
   m_hostObjectProxyHandler = {};
 
+  if (!m_pointerValuePool->Dispose()) {
+    // Some JSI values outlive the runtime. Their invalidate() still needs the pool.
+    m_pointerValuePool.release();
+  }
+
   m_context = {};
   SetCurrentContext(m_prevContext);
   m_prevContext = {};
@@ -124,6 +132,7 @@ void ChakraRuntime::PromiseContinuation(JsValueRef funcRef) noexcept {
   if (runtimeArgs().jsQueue) {
     JsAddRef(funcRef, nullptr);
     runtimeArgs().jsQueue->runOnQueue([this, funcRef]() {
+      JsTurnScope turnScope{*this};
       JsValueRef undefinedValue;
       JsGetUndefinedValue(&undefinedValue);
       ChakraVerifyJsErrorElseThrow(JsCallFunction(funcRef, &undefinedValue, 1, nullptr));
@@ -132,6 +141,129 @@ void ChakraRuntime::PromiseContinuation(JsValueRef funcRef) noexcept {
   }
 }
 
+//=============================================================================
+// ChakraRuntime::ChakraPointerValuePool implementation
+//=============================================================================
+
+void ChakraRuntime::ChakraPointerValue::invalidate() noexcept {
+  m_pool.Free(this);
+}
+
+ChakraRuntime::ChakraPointerValuePool::ChakraPointerValuePool() noexcept {
+  // Recycle() never grows the pending list beyond its capacity.
+  m_pendingReleases.reserve(MaxPendingReleases);
+}
+
+ChakraRuntime::ChakraPointerValue *ChakraRuntime::ChakraPointerValuePool::Make(JsRef ref) {
+  if (m_hasForeignValues.load(std::memory_order_acquire)) {
+    ReclaimForeignValues();
+  }
+
+  if (!m_freeList) {
+    auto slab = std::make_unique<Slot[]>(SlabSize);
+    for (size_t i = 0; i < SlabSize; ++i) {
+      slab[i].Next = m_freeList;
+      m_freeList = &slab[i];
+    }
+    m_slabs.push_back(std::move(slab));
+  }
+
+  Slot *slot = m_freeList;
+  m_freeList = slot->Next;
+  ++m_liveCount;
+  return new (&slot->Storage) ChakraPointerValue(ref, *this);
+}
+
+void ChakraRuntime::ChakraPointerValuePool::Free(ChakraPointerValue *value) noexcept {
+  if (std::this_thread::get_id() == m_threadId) {
+    // m_isDisposed is only written on this thread.
+    if (!m_isDisposed) {
+      Recycle(value);
+      return;
+    }
+  } else {
+    std::scoped_lock lock{m_foreignMutex};
+    if (!m_isDisposed) {
+      m_foreignValues.push_back(value);
+      m_hasForeignValues.store(true, std::memory_order_release);
+      return;
+    }
+  }
+
+  // The runtime is gone. The reference cannot be released and the memory is owned by the leaked pool.
+  value->~ChakraPointerValue();
+}
+
+void ChakraRuntime::ChakraPointerValuePool::DrainReleases() noexcept {
+  if (m_hasForeignValues.load(std::memory_order_acquire)) {
+    ReclaimForeignValues();
+  }
+
+  for (JsRef ref : m_pendingReleases) {
+    JsRelease(ref, nullptr);
+  }
+  m_pendingReleases.clear();
+}
+
+bool ChakraRuntime::ChakraPointerValuePool::Dispose() noexcept {
+  std::vector<ChakraPointerValue *> foreignValues;
+  {
+    std::scoped_lock lock{m_foreignMutex};
+    foreignValues.swap(m_foreignValues);
+    m_hasForeignValues.store(false, std::memory_order_relaxed);
+    m_isDisposed = true;
+  }
+
+  for (ChakraPointerValue *value : foreignValues) {
+    Recycle(value);
+  }
+
+  DrainReleases();
+  return m_liveCount == 0;
+}
+
+void ChakraRuntime::ChakraPointerValuePool::Recycle(ChakraPointerValue *value) noexcept {
+  if (JsRef ref = value->GetRef()) {
+    if (m_pendingReleases.size() == MaxPendingReleases) {
+      DrainReleases();
+    }
+    m_pendingReleases.push_back(ref);
+  }
+
+  value->~ChakraPointerValue();
+  Slot *slot = reinterpret_cast<Slot *>(value);
+  slot->Next = m_freeList;
+  m_freeList = slot;
+  --m_liveCount;
+}
+
+void ChakraRuntime::ChakraPointerValuePool::ReclaimForeignValues() noexcept {
+  std::vector<ChakraPointerValue *> foreignValues;
+  {
+    std::scoped_lock lock{m_foreignMutex};
+    foreignValues.swap(m_foreignValues);
+    m_hasForeignValues.store(false, std::memory_order_relaxed);
+  }
+
+  for (ChakraPointerValue *value : foreignValues) {
+    Recycle(value);
+  }
+}
+
+//=============================================================================
+// ChakraRuntime::JsTurnScope implementation
+//=============================================================================
+
+ChakraRuntime::JsTurnScope::JsTurnScope(ChakraRuntime &runtime) noexcept : m_runtime{runtime} {
+  ++m_runtime.m_jsTurnDepth;
+}
+
+ChakraRuntime::JsTurnScope::~JsTurnScope() noexcept {
+  if (--m_runtime.m_jsTurnDepth == 0) {
+    m_runtime.m_pointerValuePool->DrainReleases();
+  }
+}
+
 JsValueRef ChakraRuntime::CreatePropertyDescriptor(JsValueRef value, PropertyAttibutes attrs) {
   JsValueRef descriptor = CreateObject();
   SetProperty(descriptor, m_propertyId.value, value);
@@ -153,6 +285,8 @@ JsValueRef ChakraRuntime::CreatePropertyDescriptor(JsValueRef value, PropertyAtt
 facebook::jsi::Value ChakraRuntime::evaluateJavaScript(
     const std::shared_ptr<const facebook::jsi::Buffer> &buffer,
     const std::string &sourceURL) {
+  JsTurnScope turnScope{*this};
+
   // Simple evaluate if scriptStore not available as it's risky to utilize the
   // byte codes without checking the script version.
   if (!runtimeArgs().scriptStore) {
@@ -189,6 +323,8 @@ facebook::jsi::Value ChakraRuntime::evaluateJavaScript(
 
   auto preparedScript =
       runtimeArgs().preparedScriptStore->tryGetPreparedScript(scriptSignature, runtimeSignature, nullptr);
+  if (runtimeArgs().preparedScriptCallback)
+    runtimeArgs().preparedScriptCallback(sourceURL, preparedScript != nullptr);
 
   std::shared_ptr<const facebook::jsi::Buffer> sharedPreparedScript;
   if (preparedScript) {
@@ -256,6 +392,7 @@ std::shared_ptr<const facebook::jsi::PreparedJavaScript> ChakraRuntime::prepareJ
 
 facebook::jsi::Value ChakraRuntime::evaluatePreparedJavaScript(
     const std::shared_ptr<const facebook::jsi::PreparedJavaScript> &preparedJS) {
+  JsTurnScope turnScope{*this};
   const ChakraPreparedJavaScript &chakraPreparedJS = *static_cast<const ChakraPreparedJavaScript *>(preparedJS.get());
   JsValueRef result;
   if (evaluateSerializedScript(
@@ -268,6 +405,7 @@ facebook::jsi::Value ChakraRuntime::evaluatePreparedJavaScript(
 
 bool ChakraRuntime::drainMicrotasks(int /*maxMicrotasksHint*/) {
   // Not implemented
+  m_pointerValuePool->DrainReleases();
   return true;
 }
 
@@ -536,6 +674,23 @@ uint8_t *ChakraRuntime::data(const facebook::jsi::ArrayBuffer &arrBuf) {
   return reinterpret_cast<uint8_t *>(GetArrayBufferStorage(GetJsRef(arrBuf)).begin());
 }
 
+facebook::jsi::ArrayBuffer ChakraRuntime::createExternalArrayBuffer(std::unique_ptr<ByteArrayBuffer> buffer) {
+  ChakraVerifyElseThrow(buffer, "Cannot create an ArrayBuffer without a buffer.");
+  ChakraVerifyElseThrow(
+      buffer->size() <= (std::numeric_limits<unsigned int>::max)(), "The buffer is too large for an ArrayBuffer.");
+
+  JsValueRef arrayBuffer =
+      CreateExternalArrayBuffer(buffer->data(), buffer->size(), ExternalArrayBufferFinalize, buffer.get());
+  // The ArrayBuffer owns the buffer now.
+  buffer.release();
+
+  return MakePointer<facebook::jsi::Object>(arrayBuffer).getArrayBuffer(*this);
+}
+
+void CALLBACK ChakraRuntime::ExternalArrayBufferFinalize(void *callbackState) noexcept {
+  delete static_cast<ByteArrayBuffer *>(callbackState);
+}
+
 facebook::jsi::Value ChakraRuntime::getValueAtIndex(const facebook::jsi::Array &arr, size_t index) {
   assert(isArray(arr));
   assert(index <= static_cast<size_t>((std::numeric_limits<int>::max)()));
@@ -572,11 +727,13 @@ facebook::jsi::Value ChakraRuntime::call(
     const facebook::jsi::Value &jsThis,
     const facebook::jsi::Value *args,
     size_t count) {
+  JsTurnScope turnScope{*this};
   return ToJsiValue(CallFunction(GetJsRef(func), JsValueArgs(*this, jsThis, Span(args, count))));
 }
 
 facebook::jsi::Value
 ChakraRuntime::callAsConstructor(const facebook::jsi::Function &func, const facebook::jsi::Value *args, size_t count) {
+  JsTurnScope turnScope{*this};
   return ToJsiValue(
       ConstructObject(GetJsRef(func), JsValueArgs(*this, facebook::jsi::Value::undefined(), Span(args, count))));
 }
@@ -587,6 +744,7 @@ facebook::jsi::Runtime::ScopeState *ChakraRuntime::pushScope() {
 
 void ChakraRuntime::popScope([[maybe_unused]] Runtime::ScopeState *state) {
   assert(state == nullptr);
+  m_pointerValuePool->DrainReleases();
   ChakraVerifyJsErrorElseThrow(JsCollectGarbage(m_runtime));
 }
 
@@ -736,6 +894,19 @@ JsValueRef CALLBACK ChakraRuntime::HostFunctionCall(
   });
 }
 
+JsPropertyIdRef ChakraRuntime::GetPropertyIdFromStringCached(JsValueRef propertyName) {
+  // Chakra passes the same string instance for the same property name in most cases.
+  // The low bits of the reference are skipped because the references are aligned.
+  const uintptr_t address = reinterpret_cast<uintptr_t>(propertyName);
+  PropertyNameCacheEntry &entry = m_propertyNameCache[((address >> 4) ^ (address >> 12)) % PropertyNameCacheSize];
+  if (static_cast<JsValueRef>(entry.PropertyName) != propertyName) {
+    entry.PropertyId = JsRefHolder{GetPropertyIdFromName(StringToPointer(propertyName).data())};
+    entry.PropertyName = JsRefHolder{propertyName};
+  }
+
+  return entry.PropertyId;
+}
+
 /*static*/ JsValueRef CALLBACK ChakraRuntime::HostObjectGetTrap(
     JsValueRef /*callee*/,
     bool isConstructCall,
@@ -753,7 +924,7 @@ JsValueRef CALLBACK ChakraRuntime::HostFunctionCall(
     const JsValueRef propertyName = args[2];
     if (GetValueType(propertyName) == JsValueType::JsString) {
       auto const &hostObject = *static_cast<std::shared_ptr<facebook::jsi::HostObject> *>(GetExternalData(target));
-      const PropNameIDView propertyId{GetPropertyIdFromName(StringToPointer(propertyName).data())};
+      const PropNameIDView propertyId{chakraRuntime->GetPropertyIdFromStringCached(propertyName)};
       return RunInMethodContext("HostObject::get", [&]() {
         return chakraRuntime->ToJsValueRef(hostObject->get(*chakraRuntime, propertyId));
       });
@@ -794,7 +965,7 @@ JsValueRef CALLBACK ChakraRuntime::HostFunctionCall(
     const JsValueRef propertyName = args[2];
     if (GetValueType(propertyName) == JsValueType::JsString) {
       auto const &hostObject = *static_cast<std::shared_ptr<facebook::jsi::HostObject> *>(GetExternalData(target));
-      const PropNameIDView propertyId{GetPropertyIdFromName(StringToPointer(propertyName).data())};
+      const PropNameIDView propertyId{chakraRuntime->GetPropertyIdFromStringCached(propertyName)};
       const JsiValueView value{args[3]};
       RunInMethodContext("HostObject::set", [&]() { hostObject->set(*chakraRuntime, propertyId, value); });
     }
@@ -859,7 +1030,7 @@ JsValueRef CALLBACK ChakraRuntime::HostFunctionCall(
 
     const JsValueRef propertyName = args[2];
     if (GetValueType(propertyName) == JsValueType::JsString) {
-      const PropNameIDView propertyId{GetPropertyIdFromName(StringToPointer(propertyName).data())};
+      const PropNameIDView propertyId{chakraRuntime->GetPropertyIdFromStringCached(propertyName)};
       return RunInMethodContext("HostObject::getOwnPropertyDescriptor", [&]() {
         auto value = chakraRuntime->ToJsValueRef(hostObject->get(*chakraRuntime, propertyId));
         auto descriptor = chakraRuntime->CreatePropertyDescriptor(value, PropertyAttibutes::None);
@@ -1046,6 +1217,20 @@ ChakraRuntime::PropNameIDView::operator facebook::jsi::PropNameID const &() cons
 std::once_flag ChakraRuntime::s_runtimeVersionInitFlag;
 uint64_t ChakraRuntime::s_runtimeVersion = 0;
 
+facebook::jsi::ArrayBuffer MakeExternalArrayBuffer(
+    facebook::jsi::Runtime &runtime,
+    std::unique_ptr<ByteArrayBuffer> buffer) {
+  if (!buffer || buffer->size() == 0) {
+    return CreateArrayBufferCopy(runtime, nullptr, 0);
+  }
+
+  if (auto chakraRuntime = dynamic_cast<ChakraRuntime *>(&runtime)) {
+    return chakraRuntime->createExternalArrayBuffer(std::move(buffer));
+  }
+
+  return CreateArrayBufferCopy(runtime, buffer->data(), buffer->size());
+}
+
 std::unique_ptr<facebook::jsi::Runtime> makeChakraRuntime(ChakraRuntimeArgs &&args) noexcept {
 #ifdef CHAKRACORE
   if (React::GetRuntimeOptionBool("JSI.ForceSystemChakra")) {
@@ -5,14 +5,19 @@
 // To obtain a chakra runtime instance, include <ChakraRuntimeFactory.h>.
 #pragma once
 
+#include "ByteArrayBuffer.h"
 #include "ChakraApi.h"
 #include "ChakraRuntimeArgs.h"
 
 #include <jsi/jsi.h>
 
 #include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 namespace Microsoft::JSI {
 
@@ -47,6 +52,11 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
   // We use the default instrumentation() implementation that returns an
   // Instrumentation instance which returns no metrics.
 
+  // Creates an ArrayBuffer that uses the memory of the buffer without copying it.
+  // The ArrayBuffer takes ownership of the buffer, since JS code can write to it,
+  // and deletes it when it is garbage collected.
+  facebook::jsi::ArrayBuffer createExternalArrayBuffer(std::unique_ptr<ByteArrayBuffer> buffer);
+
  private:
   // Despite the name "clone" suggesting a deep copy, a return value of these
   // functions points to a new heap allocated ChakraPointerValue whose member
@@ -196,51 +206,110 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
     JsRef m_jsRef;
   };
 
+  class ChakraPointerValuePool;
+
   // ChakraPointerValue is needed for working with Facebook's jsi::Pointer class
   // and must only be used for this purpose. Every instance of
-  // ChakraPointerValue should be allocated on the heap and be used as an
-  // argument to the constructor of jsi::Pointer or one of its derived classes.
-  // Pointer makes sure that invalidate(), which frees the heap allocated
-  // ChakraPointerValue, is called upon destruction. Since the constructor of
-  // jsi::Pointer is protected, we usually have to invoke it through
-  // jsi::Runtime::make. The code should look something like:
+  // ChakraPointerValue should be allocated from the ChakraPointerValuePool and
+  // be used as an argument to the constructor of jsi::Pointer or one of its
+  // derived classes. Pointer makes sure that invalidate(), which returns the
+  // ChakraPointerValue to the pool, is called upon destruction. Since the
+  // constructor of jsi::Pointer is protected, we usually have to invoke it
+  // through jsi::Runtime::make. The code should look something like:
   //
-  //     make<Pointer>(new ChakraPointerValue(...));
+  //     make<Pointer>(m_pointerValuePool->Make(...));
   //
   // or you can use the helper function MakePointer(), as defined below.
   struct ChakraPointerValue final : ChakraPointerValueView {
-    ChakraPointerValue(JsRef ref) noexcept : ChakraPointerValueView{ref} {
+    ChakraPointerValue(JsRef ref, ChakraPointerValuePool &pool) noexcept : ChakraPointerValueView{ref}, m_pool{pool} {
       if (ref) {
         AddRef(ref);
       }
     }
 
-    void invalidate() noexcept override {
-      delete this;
-    }
+    void invalidate() noexcept override;
 
    private:
-    // ~ChakraPointerValue() should only be invoked by invalidate().
-    // Hence we make it private.
-    ~ChakraPointerValue() noexcept override {
-      if (JsRef ref = GetRef()) {
-        // JSI allows the destructor to be run on a random thread.
-        // To handle it correctly we must schedule a task to the thread associated
-        // with the Chakra context. For now we just leak the value.
-        // TODO: Implement proper ref count release if it is called on a wrong thread.
-        JsRelease(ref, nullptr); // We ignore the error until we fix the TODO above.
-      }
-    }
+    friend class ChakraPointerValuePool;
+
+    // ~ChakraPointerValue() should only be invoked by the ChakraPointerValuePool.
+    // Hence we make it private. The pool releases the reference.
+    ~ChakraPointerValue() noexcept override = default;
+
+    ChakraPointerValuePool &m_pool;
+  };
+
+  // ChakraPointerValuePool allocates ChakraPointerValue instances from slabs and reuses them
+  // through a free list. The JsRelease calls of invalidated values are deferred and run in batches
+  // when the pending list grows large, at the end of each JS turn (see JsTurnScope), and at the
+  // safe points drainMicrotasks() and popScope().
+  //
+  // JSI allows values to be invalidated on any thread. Such values are handed over to the runtime
+  // thread under a lock and are reclaimed there on the next allocation or drain.
+  class ChakraPointerValuePool final {
+   public:
+    ChakraPointerValuePool() noexcept;
+    ChakraPointerValuePool(ChakraPointerValuePool const &) = delete;
+    ChakraPointerValuePool &operator=(ChakraPointerValuePool const &) = delete;
+
+    ChakraPointerValue *Make(JsRef ref);
+    void Free(ChakraPointerValue *value) noexcept;
+
+    // Releases the pending references, including the ones of values invalidated on other threads.
+    // Must be called on the runtime thread.
+    void DrainReleases() noexcept;
+
+    // Releases all pending references. Values invalidated after this call, on any thread, are not
+    // recycled. Returns true if no values are alive anymore and the pool can be deleted.
+    bool Dispose() noexcept;
+
+   private:
+    union Slot {
+      Slot *Next;
+      std::aligned_storage_t<sizeof(ChakraPointerValue), alignof(ChakraPointerValue)> Storage;
+    };
+
+    constexpr static size_t SlabSize = 256;
+    constexpr static size_t MaxPendingReleases = 1024;
+
+    void Recycle(ChakraPointerValue *value) noexcept;
+    void ReclaimForeignValues() noexcept;
+
+    std::thread::id const m_threadId{std::this_thread::get_id()};
+    std::vector<std::unique_ptr<Slot[]>> m_slabs;
+    Slot *m_freeList{nullptr};
+    size_t m_liveCount{0};
+    std::vector<JsRef> m_pendingReleases;
+
+    // Guards m_foreignValues and m_isDisposed, so that a value invalidated on another thread is
+    // either reclaimed by Dispose() or sees that the pool is disposed.
+    std::mutex m_foreignMutex;
+    std::vector<ChakraPointerValue *> m_foreignValues;
+    std::atomic<bool> m_hasForeignValues{false};
+    bool m_isDisposed{false};
+  };
+
+  // Marks a call from native code into JavaScript. When the outermost one returns, the JS turn is
+  // over and the deferred JsRelease calls of the values it invalidated are drained.
+  class JsTurnScope final {
+   public:
+    explicit JsTurnScope(ChakraRuntime &runtime) noexcept;
+    ~JsTurnScope() noexcept;
+    JsTurnScope(JsTurnScope const &) = delete;
+    JsTurnScope &operator=(JsTurnScope const &) = delete;
+
+   private:
+    ChakraRuntime &m_runtime;
   };
 
   template <typename T, std::enable_if_t<std::is_base_of_v<facebook::jsi::Pointer, T>, int> = 0>
-  static T MakePointer(JsRef ref) {
-    return make<T>(new ChakraPointerValue(ref));
+  T MakePointer(JsRef ref) {
+    return make<T>(m_pointerValuePool->Make(ref));
   }
 
   // The pointer passed to this function must point to a ChakraPointerValue.
-  static ChakraPointerValue *CloneChakraPointerValue(const PointerValue *pointerValue) {
-    return new ChakraPointerValue(static_cast<const ChakraPointerValue *>(pointerValue)->GetRef());
+  ChakraPointerValue *CloneChakraPointerValue(const PointerValue *pointerValue) {
+    return m_pointerValuePool->Make(static_cast<const ChakraPointerValue *>(pointerValue)->GetRef());
   }
 
   // The jsi::Pointer passed to this function must hold a ChakraPointerValue.
@@ -254,6 +323,9 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
       JsNativeFunction nativeFunction,
       void *callbackState);
 
+  // Deletes the ByteArrayBuffer of an external ArrayBuffer.
+  static void CALLBACK ExternalArrayBufferFinalize(void *callbackState) noexcept;
+
   // Host function helper
   static JsValueRef CALLBACK HostFunctionCall(
       JsValueRef callee,
@@ -293,6 +365,9 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
 
   JsValueRef GetHostObjectProxyHandler();
 
+  // Returns the property id for the property name string passed to the host object Proxy traps.
+  JsPropertyIdRef GetPropertyIdFromStringCached(JsValueRef propertyName);
+
   // Evaluate lambda and augment exception messages with the methodName.
   template <typename TLambda>
   static auto RunInMethodContext(char const *methodName, TLambda lambda) {
@@ -463,6 +538,19 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
     JsRefHolder writable;
   } m_propertyId;
 
+  // Direct-mapped cache from the property name strings passed to the host object Proxy traps to their property IDs.
+  // It holds a reference to the strings, so that their JsValueRef cannot be reused for a different string.
+  struct PropertyNameCacheEntry final {
+    JsRefHolder PropertyName;
+    JsRefHolder PropertyId;
+  };
+  constexpr static size_t PropertyNameCacheSize = 256;
+  std::array<PropertyNameCacheEntry, PropertyNameCacheSize> m_propertyNameCache{};
+
+  // Created in Init() on the runtime thread. It is leaked if JSI values outlive the runtime.
+  std::unique_ptr<ChakraPointerValuePool> m_pointerValuePool;
+  size_t m_jsTurnDepth{0};
+
   JsRefHolder m_undefinedValue;
   JsRefHolder m_proxyConstructor;
   JsRefHolder m_hostObjectProxyHandler;
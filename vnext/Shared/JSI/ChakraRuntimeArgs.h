@@ -45,6 +45,9 @@ struct ChakraRuntimeArgs {
   // versioning.
   std::unique_ptr<facebook::jsi::ScriptStore> scriptStore;
   std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore;
+
+  // Called with whether preparedScriptStore had a prepared script for an evaluated script.
+  std::function<void(const std::string &sourceURL, bool found)> preparedScriptCallback;
 };
 
 } // namespace Microsoft::JSI
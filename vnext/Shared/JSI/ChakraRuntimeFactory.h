@@ -4,6 +4,7 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include "ByteArrayBuffer.h"
 
 namespace Microsoft::JSI {
 
@@ -14,4 +15,12 @@ std::unique_ptr<facebook::jsi::Runtime> makeChakraRuntime(ChakraRuntimeArgs &&ar
 std::unique_ptr<facebook::jsi::Runtime> MakeChakraCoreRuntime(ChakraRuntimeArgs &&args) noexcept;
 
 std::unique_ptr<facebook::jsi::Runtime> MakeSystemChakraRuntime(ChakraRuntimeArgs &&args) noexcept;
+
+// Creates an ArrayBuffer that takes ownership of the buffer and shares its memory with JS.
+// Runtimes that are not created by the functions above get a copy of the buffer.
+// A null or empty buffer gives an empty ArrayBuffer.
+// Must be called on the thread of the runtime.
+facebook::jsi::ArrayBuffer MakeExternalArrayBuffer(
+    facebook::jsi::Runtime &runtime,
+    std::unique_ptr<ByteArrayBuffer> buffer);
 } // namespace Microsoft::JSI
@@ -3,8 +3,11 @@
 
 #include "pch.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <limits>
+#include <mutex>
 #include <unordered_map>
 
 #include <MemoryTracker.h>
@@ -41,10 +44,27 @@ class MemoryTrackerImpl final : public MemoryTracker {
     std::chrono::steady_clock::time_point LastNotificationTime;
   };
 
+  void UpdatePeakMemoryUsage(size_t currentMemoryUsage) noexcept;
+  void EvaluateThresholdCallbacks(size_t currentMemoryUsage) noexcept;
+  void UpdateThresholdWatermark(size_t currentMemoryUsage, std::chrono::steady_clock::time_point currentTime) noexcept;
+
   bool m_isInitialized = false;
-  mutable std::recursive_mutex m_mutex;
-  size_t m_currentMemoryUsage = 0;
-  size_t m_peakMemoryUsage = 0;
+  std::atomic<size_t> m_currentMemoryUsage{0};
+  std::atomic<size_t> m_peakMemoryUsage{0};
+
+  // OnAllocation only evaluates the threshold callbacks when the memory usage
+  // exceeds this watermark. It is updated under m_mutex.
+  std::atomic<size_t> m_thresholdWatermark{std::numeric_limits<size_t>::max()};
+
+  // While a callback above its threshold waits out its minimal callback
+  // interval, OnAllocation also evaluates the threshold callbacks once the
+  // steady clock passes this time, whether or not the memory usage grows.
+  // It is updated under m_mutex.
+  std::atomic<std::chrono::steady_clock::rep> m_thresholdRecheckTime{
+      std::numeric_limits<std::chrono::steady_clock::rep>::max()};
+
+  // Guards the threshold callback records.
+  std::mutex m_mutex;
   CallbackRegistrationCookie m_nextCookie = 0;
   std::unordered_map<CallbackRegistrationCookie, ThresholdCallbackRecord> m_thresholdCallbackRecords;
   std::shared_ptr<MessageQueueThread> m_callbackMessageQueueThread;
@@ -54,15 +74,13 @@ MemoryTrackerImpl::MemoryTrackerImpl(std::shared_ptr<MessageQueueThread> &&callb
     : m_callbackMessageQueueThread{std::move(callbackMessageQueueThread)} {}
 
 size_t MemoryTrackerImpl::GetCurrentMemoryUsage() const noexcept {
-  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
   assert(m_isInitialized);
-  return m_currentMemoryUsage;
+  return m_currentMemoryUsage.load(std::memory_order_relaxed);
 }
 
 size_t MemoryTrackerImpl::GetPeakMemoryUsage() const noexcept {
-  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
   assert(m_isInitialized);
-  return m_peakMemoryUsage;
+  return m_peakMemoryUsage.load(std::memory_order_relaxed);
 }
 
 std::shared_ptr<MessageQueueThread> MemoryTrackerImpl::GetCallbackMessageQueueThread() const noexcept {
@@ -80,7 +98,7 @@ CallbackRegistrationCookie MemoryTrackerImpl::AddThresholdCallback(
     size_t threshold,
     std::chrono::milliseconds minCallbackInterval,
     MemoryThresholdCallback &&callback) noexcept {
-  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
+  std::lock_guard<std::mutex> lockGuard{m_mutex};
   assert(m_nextCookie < std::numeric_limits<decltype(m_nextCookie)>::max());
   CallbackRegistrationCookie cookie = m_nextCookie++;
 #if DEBUG
@@ -92,54 +110,105 @@ CallbackRegistrationCookie MemoryTrackerImpl::AddThresholdCallback(
 #if DEBUG
   assert(success);
 #endif
+  UpdateThresholdWatermark(m_currentMemoryUsage.load(std::memory_order_relaxed), std::chrono::steady_clock::now());
   return cookie;
 }
 
 bool MemoryTrackerImpl::RemoveThresholdCallback(CallbackRegistrationCookie cookie) noexcept {
-  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
-  return m_thresholdCallbackRecords.erase(cookie) == 1;
+  std::lock_guard<std::mutex> lockGuard{m_mutex};
+  if (m_thresholdCallbackRecords.erase(cookie) != 1)
+    return false;
+
+  UpdateThresholdWatermark(m_currentMemoryUsage.load(std::memory_order_relaxed), std::chrono::steady_clock::now());
+  return true;
 }
 
 void MemoryTrackerImpl::Initialize(size_t initialMemoryUsage) noexcept {
-  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
   assert(!m_isInitialized);
   m_isInitialized = true;
   OnAllocation(initialMemoryUsage);
 }
 
 void MemoryTrackerImpl::OnAllocation(size_t size) noexcept {
-  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
-  // detect overflow
-  assert(std::numeric_limits<decltype(m_currentMemoryUsage)>::max() - m_currentMemoryUsage >= size);
-
   assert(m_isInitialized);
   assert(m_callbackMessageQueueThread);
 
-  m_currentMemoryUsage += size;
+  size_t currentMemoryUsage = m_currentMemoryUsage.fetch_add(size, std::memory_order_relaxed) + size;
+  // detect overflow
+  assert(currentMemoryUsage >= size);
+
+  if (currentMemoryUsage > m_peakMemoryUsage.load(std::memory_order_relaxed)) {
+    UpdatePeakMemoryUsage(currentMemoryUsage);
+  }
+
+  if (currentMemoryUsage > m_thresholdWatermark.load(std::memory_order_relaxed)) {
+    EvaluateThresholdCallbacks(currentMemoryUsage);
+    return;
+  }
 
-  if (m_currentMemoryUsage > m_peakMemoryUsage) {
-    m_peakMemoryUsage = m_currentMemoryUsage;
+  // Only read the clock while a callback is waiting for its interval to pass.
+  auto recheckTime = m_thresholdRecheckTime.load(std::memory_order_relaxed);
+  if (recheckTime != std::numeric_limits<std::chrono::steady_clock::rep>::max() &&
+      std::chrono::steady_clock::now().time_since_epoch().count() > recheckTime) {
+    EvaluateThresholdCallbacks(currentMemoryUsage);
   }
+}
 
+void MemoryTrackerImpl::OnDeallocation(size_t size) noexcept {
+  assert(m_isInitialized);
+  [[maybe_unused]] size_t previousMemoryUsage = m_currentMemoryUsage.fetch_sub(size, std::memory_order_relaxed);
+  assert(size <= previousMemoryUsage);
+}
+
+void MemoryTrackerImpl::UpdatePeakMemoryUsage(size_t currentMemoryUsage) noexcept {
+  size_t peakMemoryUsage = m_peakMemoryUsage.load(std::memory_order_relaxed);
+  while (currentMemoryUsage > peakMemoryUsage &&
+         !m_peakMemoryUsage.compare_exchange_weak(peakMemoryUsage, currentMemoryUsage, std::memory_order_relaxed)) {
+  }
+}
+
+void MemoryTrackerImpl::EvaluateThresholdCallbacks(size_t currentMemoryUsage) noexcept {
+  std::lock_guard<std::mutex> lockGuard{m_mutex};
   std::chrono::steady_clock::time_point currentTime = std::chrono::steady_clock::now();
 
   for (auto &record : m_thresholdCallbackRecords) {
-    if (m_currentMemoryUsage >= record.second.Threshold &&
+    if (currentMemoryUsage >= record.second.Threshold &&
         currentTime > record.second.LastNotificationTime + record.second.MinCallbackInterval) {
       m_callbackMessageQueueThread->runOnQueue(
-          [callback = record.second.Callback, currentMemoryUsage = m_currentMemoryUsage] {
-            callback(currentMemoryUsage);
-          });
+          [callback = record.second.Callback, currentMemoryUsage] { callback(currentMemoryUsage); });
       record.second.LastNotificationTime = currentTime;
     }
   }
+
+  UpdateThresholdWatermark(currentMemoryUsage, currentTime);
 }
 
-void MemoryTrackerImpl::OnDeallocation(size_t size) noexcept {
-  std::lock_guard<std::recursive_mutex> lockGuard{m_mutex};
-  assert(m_isInitialized);
-  assert(size <= m_currentMemoryUsage);
-  m_currentMemoryUsage -= size;
+void MemoryTrackerImpl::UpdateThresholdWatermark(
+    size_t currentMemoryUsage,
+    std::chrono::steady_clock::time_point currentTime) noexcept {
+  size_t watermark = std::numeric_limits<size_t>::max();
+  auto recheckTime = std::chrono::steady_clock::time_point::max();
+  for (const auto &record : m_thresholdCallbackRecords) {
+    auto nextNotificationTime = record.second.LastNotificationTime + record.second.MinCallbackInterval;
+    if (currentMemoryUsage < record.second.Threshold) {
+      // Evaluate when the usage reaches the threshold.
+      watermark = std::min(watermark, record.second.Threshold - 1);
+    } else if (currentTime > nextNotificationTime) {
+      // Evaluate on the next allocation.
+      watermark = std::min(watermark, currentMemoryUsage);
+    } else {
+      // Evaluate on the first allocation after the callback interval has
+      // passed, even if the usage stays flat or declines in the meantime.
+      recheckTime = std::min(recheckTime, nextNotificationTime);
+    }
+  }
+
+  m_thresholdWatermark.store(watermark, std::memory_order_relaxed);
+  m_thresholdRecheckTime.store(
+      recheckTime == std::chrono::steady_clock::time_point::max()
+          ? std::numeric_limits<std::chrono::steady_clock::rep>::max()
+          : recheckTime.time_since_epoch().count(),
+      std::memory_order_relaxed);
 }
 
 MemoryTrackerImpl::ThresholdCallbackRecord::ThresholdCallbackRecord(
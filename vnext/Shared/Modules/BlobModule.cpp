@@ -0,0 +1,316 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <Modules/BlobModule.h>
+
+#include <cxxreact/Instance.h>
+#include <cxxreact/JsArgumentHelpers.h>
+
+// Standard Library
+#include <stdexcept>
+
+using namespace facebook::xplat;
+
+using folly::dynamic;
+using std::int64_t;
+using std::optional;
+using std::shared_ptr;
+using std::size_t;
+using std::string;
+using std::uint8_t;
+using std::vector;
+using std::weak_ptr;
+
+namespace {
+
+// Keyed by ownership rather than by address, so that a new instance allocated at the address of a destroyed one never
+// finds the registry of the latter.
+std::mutex g_registriesMutex;
+std::map<
+    weak_ptr<facebook::react::Instance>,
+    weak_ptr<Microsoft::React::BlobRegistry>,
+    std::owner_less<weak_ptr<facebook::react::Instance>>>
+    g_registries;
+
+} // namespace
+
+namespace Microsoft::React {
+
+#pragma region BlobRegistry
+
+std::atomic_uint64_t BlobRegistry::s_lastBlobId{0};
+
+const uint8_t *BlobRegistry::Slice::Data() const noexcept {
+  return Buffer->data() + Offset;
+}
+
+BlobRegistry::~BlobRegistry() noexcept {
+  std::scoped_lock lock{g_registriesMutex};
+
+  // The instance may already have created a replacement registry.
+  auto itr = g_registries.find(m_instance);
+  if (itr != g_registries.end() && itr->second.expired())
+    g_registries.erase(itr);
+}
+
+/*static*/ shared_ptr<BlobRegistry> BlobRegistry::Get(const shared_ptr<facebook::react::Instance> &instance) {
+  std::scoped_lock lock{g_registriesMutex};
+
+  auto &entry = g_registries[instance];
+  if (auto registry = entry.lock())
+    return registry;
+
+  auto registry = std::make_shared<BlobRegistry>();
+  registry->m_instance = instance;
+  entry = registry;
+
+  return registry;
+}
+
+/*static*/ shared_ptr<BlobRegistry> BlobRegistry::Find(const shared_ptr<facebook::react::Instance> &instance) noexcept {
+  std::scoped_lock lock{g_registriesMutex};
+
+  auto itr = g_registries.find(instance);
+  if (itr == g_registries.end())
+    return nullptr;
+
+  return itr->second.lock();
+}
+
+string BlobRegistry::Store(vector<uint8_t> &&data) {
+  // JavaScript generates UUIDs for the blobs it creates, which never take this form.
+  auto blobId = "native-" + std::to_string(++s_lastBlobId);
+  auto size = data.size();
+
+  Store(blobId, Slice{std::make_shared<const vector<uint8_t>>(std::move(data)), 0, size});
+
+  return blobId;
+}
+
+void BlobRegistry::Store(const string &blobId, Slice &&slice) {
+  std::scoped_lock lock{m_mutex};
+  m_blobs[blobId] = std::move(slice);
+}
+
+optional<BlobRegistry::Slice> BlobRegistry::Resolve(const string &blobId, size_t offset, size_t size) const {
+  std::scoped_lock lock{m_mutex};
+
+  auto itr = m_blobs.find(blobId);
+  if (itr == m_blobs.end())
+    return std::nullopt;
+
+  const auto &blob = itr->second;
+  if (offset > blob.Size || size > blob.Size - offset)
+    return std::nullopt;
+
+  return Slice{blob.Buffer, blob.Offset + offset, size};
+}
+
+optional<BlobRegistry::Slice> BlobRegistry::Resolve(const dynamic &blob) const {
+  if (!blob.isObject() || blob.count("blobId") == 0 || blob.count("size") == 0)
+    return std::nullopt;
+
+  auto offset = blob.getDefault("offset", 0).asInt();
+  auto size = blob["size"].asInt();
+  if (offset < 0 || size < 0)
+    return std::nullopt;
+
+  return Resolve(blob["blobId"].asString(), static_cast<size_t>(offset), static_cast<size_t>(size));
+}
+
+void BlobRegistry::Release(const string &blobId) {
+  Slice released;
+  {
+    std::scoped_lock lock{m_mutex};
+
+    auto itr = m_blobs.find(blobId);
+    if (itr == m_blobs.end())
+      return;
+
+    // Free the buffer, if this was its last reference, outside of the lock.
+    released = std::move(itr->second);
+    m_blobs.erase(itr);
+  }
+}
+
+size_t BlobRegistry::Size() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_blobs.size();
+}
+
+void BlobRegistry::AddWebSocketHandler(int64_t socketId) {
+  std::scoped_lock lock{m_mutex};
+  m_webSocketHandlers.insert(socketId);
+}
+
+void BlobRegistry::RemoveWebSocketHandler(int64_t socketId) {
+  std::scoped_lock lock{m_mutex};
+  m_webSocketHandlers.erase(socketId);
+}
+
+bool BlobRegistry::HandlesWebSocket(int64_t socketId) const {
+  std::scoped_lock lock{m_mutex};
+  return m_webSocketHandlers.count(socketId) > 0;
+}
+
+void BlobRegistry::AddWebSocket(int64_t socketId, weak_ptr<IWebSocketResource> webSocket) {
+  std::scoped_lock lock{m_mutex};
+  m_webSockets[socketId] = std::move(webSocket);
+}
+
+void BlobRegistry::RemoveWebSocket(int64_t socketId) {
+  std::scoped_lock lock{m_mutex};
+  m_webSockets.erase(socketId);
+}
+
+shared_ptr<IWebSocketResource> BlobRegistry::GetWebSocket(int64_t socketId) const {
+  std::scoped_lock lock{m_mutex};
+
+  auto itr = m_webSockets.find(socketId);
+  if (itr == m_webSockets.end())
+    return nullptr;
+
+  return itr->second.lock();
+}
+
+/*static*/ dynamic BlobRegistry::CreateDescriptor(const string &blobId, size_t size) {
+  return dynamic::object("blobId", blobId)("offset", 0)("size", static_cast<int64_t>(size));
+}
+
+#pragma endregion BlobRegistry
+
+#pragma region BlobModule
+
+string BlobModule::getName() {
+  return Name;
+}
+
+std::map<string, dynamic> BlobModule::getConstants() {
+  return {{"BLOB_URI_SCHEME", "blob"}, {"BLOB_URI_HOST", nullptr}};
+}
+
+// clang-format off
+std::vector<module::CxxModule::Method> BlobModule::getMethods()
+{
+  return
+  {
+    Method(
+      "addNetworkingHandler",
+      [this](dynamic args)
+      {
+        // Networking resolves blob request bodies and creates blob responses through the registry.
+        this->GetRegistry();
+      }),
+    Method(
+      "addWebSocketHandler",
+      [this](dynamic args) // int64_t id
+      {
+        if (auto registry = this->GetRegistry())
+          registry->AddWebSocketHandler(jsArgAsInt(args, 0));
+      }),
+    Method(
+      "removeWebSocketHandler",
+      [this](dynamic args) // int64_t id
+      {
+        if (auto registry = this->GetRegistry())
+          registry->RemoveWebSocketHandler(jsArgAsInt(args, 0));
+      }),
+    Method(
+      "sendOverSocket",
+      [this](dynamic args) // dynamic blob, int64_t id
+      {
+        auto registry = this->GetRegistry();
+        if (!registry)
+          return;
+
+        auto slice = registry->Resolve(jsArgAsObject(args, 0));
+        if (!slice)
+          throw std::invalid_argument("Unknown blob");
+
+        if (auto webSocket = registry->GetWebSocket(jsArgAsInt(args, 1)))
+          webSocket->SendBinary(IWebSocketResource::SharedBytes{std::move(slice->Buffer), slice->Offset, slice->Size});
+      }),
+    Method(
+      "createFromParts",
+      [this](dynamic args) // dynamic parts, string withId
+      {
+        auto registry = this->GetRegistry();
+        if (!registry)
+          return;
+
+        auto parts = jsArgAsArray(args, 0);
+        vector<BlobRegistry::Slice> slices;
+        slices.reserve(parts.size());
+        size_t size = 0;
+
+        for (const auto &part : parts)
+        {
+          const auto &type = part["type"].getString();
+          if (type == "blob")
+          {
+            auto slice = registry->Resolve(part["data"]);
+            if (!slice)
+              throw std::invalid_argument("Unknown blob");
+
+            slices.push_back(std::move(*slice));
+          }
+          else if (type == "string")
+          {
+            const auto &text = part["data"].getString();
+            auto buffer = std::make_shared<const vector<uint8_t>>(text.begin(), text.end());
+            slices.push_back(BlobRegistry::Slice{buffer, 0, buffer->size()});
+          }
+          else
+          {
+            throw std::invalid_argument("Invalid type for blob: " + type);
+          }
+
+          size += slices.back().Size;
+        }
+
+        // A blob made of a single part shares that part's buffer.
+        if (slices.size() == 1)
+        {
+          registry->Store(jsArgAsString(args, 1), std::move(slices.front()));
+          return;
+        }
+
+        auto buffer = std::make_shared<vector<uint8_t>>();
+        buffer->reserve(size);
+        for (const auto &slice : slices)
+          buffer->insert(buffer->end(), slice.Data(), slice.Data() + slice.Size);
+
+        registry->Store(jsArgAsString(args, 1), BlobRegistry::Slice{std::move(buffer), 0, size});
+      }),
+    Method(
+      "release",
+      [this](dynamic args) // string blobId
+      {
+        if (auto registry = this->GetRegistry())
+          registry->Release(jsArgAsString(args, 0));
+      })
+  };
+} // getMethods
+// clang-format on
+
+shared_ptr<BlobRegistry> BlobModule::GetRegistry() {
+  if (!m_registry) {
+    auto instance = getInstance().lock();
+    if (!instance)
+      return nullptr;
+
+    m_registry = BlobRegistry::Get(instance);
+  }
+
+  return m_registry;
+}
+
+#pragma endregion BlobModule
+
+/*extern*/ std::unique_ptr<module::CxxModule> CreateBlobModule() noexcept {
+  return std::make_unique<BlobModule>();
+}
+
+} // namespace Microsoft::React
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <IWebSocketResource.h>
+#include <cxxreact/CxxModule.h>
+#include <folly/dynamic.h>
+
+// Standard Library
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+class Instance;
+}
+
+namespace Microsoft::React {
+
+/// <summary>
+/// Native storage for the binary data behind JavaScript <c>Blob</c> objects.
+/// JavaScript only holds blob identifiers; the bytes stay on the native side.
+/// </summary>
+/// <remarks>
+/// There is one registry per React instance, shared by the BlobModule, FileReaderModule,
+/// WebSocketModule and Networking modules of that instance.
+/// Entries are immutable slices of reference-counted buffers, so slicing a blob never copies it.
+/// </remarks>
+class BlobRegistry {
+ public:
+  struct Slice {
+    std::shared_ptr<const std::vector<std::uint8_t>> Buffer;
+    std::size_t Offset{0};
+    std::size_t Size{0};
+
+    const std::uint8_t *Data() const noexcept;
+  };
+
+  BlobRegistry() = default;
+  ~BlobRegistry() noexcept;
+
+  BlobRegistry(const BlobRegistry &) = delete;
+  BlobRegistry &operator=(const BlobRegistry &) = delete;
+
+  /// <summary>
+  /// Returns the registry of the given instance, creating it if needed.
+  /// </summary>
+  static std::shared_ptr<BlobRegistry> Get(const std::shared_ptr<facebook::react::Instance> &instance);
+
+  /// <summary>
+  /// Returns the registry of the given instance, if any module has created it.
+  /// </summary>
+  static std::shared_ptr<BlobRegistry> Find(const std::shared_ptr<facebook::react::Instance> &instance) noexcept;
+
+  /// <summary>
+  /// Stores the data under a new, native-generated identifier.
+  /// </summary>
+  std::string Store(std::vector<std::uint8_t> &&data);
+
+  void Store(const std::string &blobId, Slice &&slice);
+
+  /// <summary>
+  /// Returns the given range of a stored blob, sharing its buffer.
+  /// </summary>
+  /// <returns>
+  /// <c>std::nullopt</c> if the blob is unknown or the range exceeds it.
+  /// </returns>
+  std::optional<Slice> Resolve(const std::string &blobId, std::size_t offset, std::size_t size) const;
+
+  /// <summary>
+  /// Resolves a JavaScript blob descriptor, <c>{ blobId, offset, size }</c>.
+  /// </summary>
+  std::optional<Slice> Resolve(const folly::dynamic &blob) const;
+
+  /// <summary>
+  /// Drops the registry's reference to the blob.
+  /// The bytes are freed once no other slice of the same buffer remains.
+  /// </summary>
+  void Release(const std::string &blobId);
+
+  std::size_t Size() const noexcept;
+
+  void AddWebSocketHandler(std::int64_t socketId);
+  void RemoveWebSocketHandler(std::int64_t socketId);
+
+  /// <summary>
+  /// Whether binary messages received on the socket are delivered to JavaScript as blobs.
+  /// </summary>
+  bool HandlesWebSocket(std::int64_t socketId) const;
+
+  /// <summary>
+  /// Makes a socket reachable by <c>BlobModule.sendOverSocket</c>.
+  /// </summary>
+  void AddWebSocket(std::int64_t socketId, std::weak_ptr<IWebSocketResource> webSocket);
+
+  /// <summary>
+  /// Forgets a socket that has closed or failed.
+  /// </summary>
+  void RemoveWebSocket(std::int64_t socketId);
+
+  std::shared_ptr<IWebSocketResource> GetWebSocket(std::int64_t socketId) const;
+
+  /// <summary>
+  /// Creates the JavaScript descriptor of a whole blob.
+  /// </summary>
+  static folly::dynamic CreateDescriptor(const std::string &blobId, std::size_t size);
+
+ private:
+  std::weak_ptr<facebook::react::Instance> m_instance;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, Slice> m_blobs;
+  std::set<std::int64_t> m_webSocketHandlers;
+  std::map<std::int64_t, std::weak_ptr<IWebSocketResource>> m_webSockets;
+
+  static std::atomic_uint64_t s_lastBlobId;
+};
+
+///
+/// Realizes <c>NativeModules</c> projection.
+/// <remarks>See react-native/Libraries/Blob/NativeBlobModule.js</remarks>
+///
+class BlobModule : public facebook::xplat::module::CxxModule {
+ public:
+  enum MethodId {
+    AddNetworkingHandler = 0,
+    AddWebSocketHandler = 1,
+    RemoveWebSocketHandler = 2,
+    SendOverSocket = 3,
+    CreateFromParts = 4,
+    Release = 5,
+    SIZE = 6
+  };
+
+  static constexpr char const *Name = "BlobModule";
+
+#pragma region CxxModule overrides
+
+  /// <summary>
+  /// <see cref="facebook::xplat::module::CxxModule::getName" />
+  /// </summary>
+  std::string getName() override;
+
+  /// <summary>
+  /// <see cref="facebook::xplat::module::CxxModule::getConstants" />
+  /// </summary>
+  std::map<std::string, folly::dynamic> getConstants() override;
+
+  /// <summary>
+  /// <see cref="facebook::xplat::module::CxxModule::getMethods" />
+  /// </summary>
+  /// <remarks>See react-native/Libraries/Blob/BlobManager.js</remarks>
+  std::vector<Method> getMethods() override;
+
+#pragma endregion CxxModule overrides
+
+ private:
+  /// <summary>
+  /// Returns the registry of the current instance, or <c>nullptr</c> if the instance is gone.
+  /// </summary>
+  std::shared_ptr<BlobRegistry> GetRegistry();
+
+  std::shared_ptr<BlobRegistry> m_registry;
+};
+
+} // namespace Microsoft::React
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <Modules/FileReaderModule.h>
+
+#include <Modules/BlobModule.h>
+#include <cxxreact/Instance.h>
+#include <cxxreact/JsArgumentHelpers.h>
+#include <winrt/Windows.Security.Cryptography.h>
+
+using namespace facebook::xplat;
+
+using folly::dynamic;
+using std::shared_ptr;
+using std::string;
+
+using winrt::Windows::Security::Cryptography::CryptographicBuffer;
+
+namespace Microsoft::React {
+
+string FileReaderModule::getName() {
+  return Name;
+}
+
+std::map<string, dynamic> FileReaderModule::getConstants() {
+  return {};
+}
+
+// clang-format off
+std::vector<module::CxxModule::Method> FileReaderModule::getMethods()
+{
+  return
+  {
+    Method(
+      "readAsDataURL",
+      [this](dynamic args, Callback resolve, Callback reject) // dynamic blob
+      {
+        auto registry = this->GetRegistry();
+        auto blob = jsArgAsObject(args, 0);
+        auto slice = registry ? registry->Resolve(blob) : std::nullopt;
+        if (!slice)
+        {
+          reject({dynamic::object("message", "Unable to resolve data for blob")});
+          return;
+        }
+
+        auto buffer = CryptographicBuffer::CreateFromByteArray({slice->Data(), slice->Data() + slice->Size});
+        auto base64 = winrt::to_string(CryptographicBuffer::EncodeToBase64String(buffer));
+
+        string type = blob.getDefault("type", "").asString();
+        resolve({"data:" + (type.empty() ? "application/octet-stream" : type) + ";base64," + base64});
+      }),
+    Method(
+      "readAsText",
+      [this](dynamic args, Callback resolve, Callback reject) // dynamic blob, string encoding
+      {
+        auto registry = this->GetRegistry();
+        auto slice = registry ? registry->Resolve(jsArgAsObject(args, 0)) : std::nullopt;
+        if (!slice)
+        {
+          reject({dynamic::object("message", "Unable to resolve data for blob")});
+          return;
+        }
+
+        // Blob text is stored as UTF-8, which is also what folly::dynamic strings hold.
+        auto encoding = jsArgAsString(args, 1);
+        if (!encoding.empty() && _stricmp(encoding.c_str(), "UTF-8") != 0 && _stricmp(encoding.c_str(), "UTF8") != 0)
+        {
+          reject({dynamic::object("message", "Unsupported encoding: " + encoding)});
+          return;
+        }
+
+        resolve({string(reinterpret_cast<const char*>(slice->Data()), slice->Size)});
+      })
+  };
+} // getMethods
+// clang-format on
+
+shared_ptr<BlobRegistry> FileReaderModule::GetRegistry() {
+  if (!m_registry) {
+    auto instance = getInstance().lock();
+    if (!instance)
+      return nullptr;
+
+    m_registry = BlobRegistry::Get(instance);
+  }
+
+  return m_registry;
+}
+
+/*extern*/ std::unique_ptr<module::CxxModule> CreateFileReaderModule() noexcept {
+  return std::make_unique<FileReaderModule>();
+}
+
+} // namespace Microsoft::React
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cxxreact/CxxModule.h>
+#include <folly/dynamic.h>
+
+// Standard Library
+#include <memory>
+
+namespace Microsoft::React {
+
+class BlobRegistry;
+
+///
+/// Realizes <c>NativeModules</c> projection.
+/// Reads blobs out of the <see cref="BlobRegistry" /> of the current instance.
+/// <remarks>See react-native/Libraries/Blob/FileReader.js</remarks>
+///
+class FileReaderModule : public facebook::xplat::module::CxxModule {
+ public:
+  enum MethodId { ReadAsDataURL = 0, ReadAsText = 1, SIZE = 2 };
+
+  static constexpr char const *Name = "FileReaderModule";
+
+#pragma region CxxModule overrides
+
+  /// <summary>
+  /// <see cref="facebook::xplat::module::CxxModule::getName" />
+  /// </summary>
+  std::string getName() override;
+
+  /// <summary>
+  /// <see cref="facebook::xplat::module::CxxModule::getConstants" />
+  /// </summary>
+  std::map<std::string, folly::dynamic> getConstants() override;
+
+  /// <summary>
+  /// <see cref="facebook::xplat::module::CxxModule::getMethods" />
+  /// </summary>
+  std::vector<Method> getMethods() override;
+
+#pragma endregion CxxModule overrides
+
+ private:
+  std::shared_ptr<BlobRegistry> GetRegistry();
+
+  std::shared_ptr<BlobRegistry> m_registry;
+};
+
+} // namespace Microsoft::React
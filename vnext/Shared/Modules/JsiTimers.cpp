@@ -0,0 +1,328 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "JsiTimers.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace jsi = facebook::jsi;
+
+namespace Microsoft::React {
+
+namespace {
+
+// The global Map from timer id to callback.
+constexpr const char *CallbacksName = "__nativeTimerCallbacks";
+
+// The global object holding the timer functions, which setUpTimers restores after its JS polyfills.
+constexpr const char *FunctionsName = "__nativeTimers";
+
+// Timers due within this long after the first one share its wakeup.
+constexpr std::chrono::milliseconds TimerSlack{1};
+
+constexpr std::chrono::duration<double, std::milli> FrameInterval{1000.0 / 60.0};
+
+// Keeps a setInterval without a delay from waking the JS thread up continuously.
+constexpr std::chrono::milliseconds MinimumInterval{1};
+
+// Reports an exception thrown by a timer callback the way JSTimers does, as a fatal error. Returns false when the
+// runtime has no ErrorUtils to report it to.
+bool ReportFatalError(jsi::Runtime &runtime, const jsi::Value &error) {
+  const auto errorUtils = runtime.global().getProperty(runtime, "ErrorUtils");
+  if (!errorUtils.isObject()) {
+    return false;
+  }
+
+  const auto reportFatalError = errorUtils.getObject(runtime).getProperty(runtime, "reportFatalError");
+  if (!reportFatalError.isObject() || !reportFatalError.getObject(runtime).isFunction(runtime)) {
+    return false;
+  }
+
+  reportFatalError.getObject(runtime).getFunction(runtime).call(runtime, error);
+  return true;
+}
+
+} // namespace
+
+/*static*/ void JsiTimers::Install(
+    jsi::Runtime &runtime,
+    const std::shared_ptr<facebook::react::MessageQueueThread> &jsQueue,
+    std::function<void()> &&flushNativeCalls) {
+  auto timers = std::make_shared<JsiTimers>(runtime, jsQueue, std::move(flushNativeCalls));
+  auto global = runtime.global();
+  global.setProperty(runtime, CallbacksName, global.getPropertyAsFunction(runtime, "Map").callAsConstructor(runtime));
+  jsi::Object functions{runtime};
+
+  // The host functions own the timers, so that they live as long as the runtime.
+  const auto install = [&runtime, &global, &functions](const char *name, jsi::Function &&function) {
+    global.setProperty(runtime, name, jsi::Value{runtime, function});
+    functions.setProperty(runtime, name, std::move(function));
+  };
+  const auto installCreate = [&runtime, &timers, &install](const char *name, TimerKind kind) {
+    install(
+        name,
+        jsi::Function::createFromHostFunction(
+            runtime,
+            jsi::PropNameID::forAscii(runtime, name),
+            2,
+            [timers, kind](jsi::Runtime &, const jsi::Value &, const jsi::Value *args, size_t count) {
+              return timers->CreateTimer(kind, args, count);
+            }));
+  };
+  const auto installDelete = [&runtime, &timers, &install](const char *name) {
+    install(
+        name,
+        jsi::Function::createFromHostFunction(
+            runtime,
+            jsi::PropNameID::forAscii(runtime, name),
+            1,
+            [timers](jsi::Runtime &, const jsi::Value &, const jsi::Value *args, size_t count) {
+              if (count > 0) {
+                timers->DeleteTimer(args[0]);
+              }
+              return jsi::Value::undefined();
+            }));
+  };
+
+  installCreate("setTimeout", TimerKind::Timeout);
+  installCreate("setInterval", TimerKind::Interval);
+  installCreate("requestAnimationFrame", TimerKind::AnimationFrame);
+  installCreate("setImmediate", TimerKind::Immediate);
+  installDelete("clearTimeout");
+  installDelete("clearInterval");
+  installDelete("cancelAnimationFrame");
+  installDelete("clearImmediate");
+  global.setProperty(runtime, FunctionsName, std::move(functions));
+}
+
+JsiTimers::JsiTimers(
+    jsi::Runtime &runtime,
+    const std::shared_ptr<facebook::react::MessageQueueThread> &jsQueue,
+    std::function<void()> &&flushNativeCalls)
+    : m_runtime(runtime),
+      m_jsQueue(jsQueue),
+      m_flushNativeCalls(std::move(flushNativeCalls)),
+      m_timers(TimerSlack) {}
+
+JsiTimers::~JsiTimers() {
+  if (m_threadpoolTimer) {
+    SetThreadpoolTimer(m_threadpoolTimer, nullptr, 0, 0);
+    WaitForThreadpoolTimerCallbacks(m_threadpoolTimer, true);
+    CloseThreadpoolTimer(m_threadpoolTimer);
+  }
+}
+
+/*static*/ VOID CALLBACK
+JsiTimers::ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE, PVOID parameter, PTP_TIMER) noexcept {
+  // Timers are only touched on the JS thread, so the wakeup itself is posted there.
+  const auto self = static_cast<JsiTimers *>(parameter);
+  if (const auto jsQueue = self->m_jsQueue.lock()) {
+    jsQueue->runOnQueue([weakThis = self->weak_from_this()]() {
+      if (const auto strongThis = weakThis.lock()) {
+        strongThis->OnWakeup();
+      }
+    });
+  }
+}
+
+jsi::Value JsiTimers::CreateTimer(TimerKind kind, const jsi::Value *args, size_t count) {
+  if (count == 0 || !args[0].isObject() || !args[0].getObject(m_runtime).isFunction(m_runtime)) {
+    throw jsi::JSError(m_runtime, "The callback of a timer must be a function.");
+  }
+
+  // Arguments after the delay, or after the callback of setImmediate, are bound to the callback.
+  const size_t firstArg = kind == TimerKind::Immediate ? 1 : 2;
+  jsi::Value callback{m_runtime, args[0]};
+  if (count > firstArg && kind != TimerKind::AnimationFrame) {
+    std::vector<jsi::Value> boundArgs;
+    boundArgs.reserve(count - firstArg + 1);
+    boundArgs.emplace_back(jsi::Value::undefined());
+    for (auto i = firstArg; i < count; i++) {
+      boundArgs.emplace_back(m_runtime, args[i]);
+    }
+
+    auto function = args[0].getObject(m_runtime);
+    const auto bind = function.getPropertyAsFunction(m_runtime, "bind");
+    callback = bind.callWithThis(
+        m_runtime, function, static_cast<const jsi::Value *>(boundArgs.data()), boundArgs.size());
+  }
+
+  const auto id = m_nextId++;
+  const jsi::Value idValue{static_cast<double>(id)};
+  auto callbacks = Callbacks();
+  const jsi::Value setArgs[] = {jsi::Value{m_runtime, idValue}, std::move(callback)};
+  callbacks.getPropertyAsFunction(m_runtime, "set").callWithThis(m_runtime, callbacks, setArgs, 2);
+
+  const auto now = Clock::now();
+  switch (kind) {
+    case TimerKind::Immediate:
+      if (const auto jsQueue = m_jsQueue.lock()) {
+        jsQueue->runOnQueue([weakThis = weak_from_this(), id]() {
+          if (const auto strongThis = weakThis.lock()) {
+            strongThis->OnImmediate(id);
+          }
+        });
+      }
+      return idValue;
+    case TimerKind::AnimationFrame:
+      m_animationFrames.insert(id);
+      m_timers.Push(id, now + std::chrono::duration_cast<Clock::duration>(FrameInterval), {}, false);
+      break;
+    case TimerKind::Timeout:
+    case TimerKind::Interval: {
+      const auto delay = count > 1 && args[1].isNumber() ? std::max(args[1].getNumber(), 0.0) : 0.0;
+      auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>{delay});
+      if (kind == TimerKind::Interval) {
+        period = std::max<Clock::duration>(period, MinimumInterval);
+      }
+      m_timers.Push(id, now + period, period, kind == TimerKind::Interval);
+      break;
+    }
+  }
+
+  ScheduleWakeup();
+  return idValue;
+}
+
+void JsiTimers::DeleteTimer(const jsi::Value &id) {
+  if (!id.isNumber()) {
+    return;
+  }
+
+  // The pending wakeup is kept: when nothing is due by then, it only schedules the next one.
+  const auto timerId = static_cast<int64_t>(id.getNumber());
+  m_timers.Remove(timerId);
+  m_animationFrames.erase(timerId);
+  auto callbacks = Callbacks();
+  callbacks.getPropertyAsFunction(m_runtime, "delete").callWithThis(m_runtime, callbacks, &id, 1);
+}
+
+jsi::Object JsiTimers::Callbacks() {
+  return m_runtime.global().getPropertyAsObject(m_runtime, CallbacksName);
+}
+
+void JsiTimers::OnWakeup() {
+  m_wakeupTime = Clock::time_point::max();
+  const auto now = Clock::now();
+  m_dueTimers.clear();
+  m_timers.PopDue(now, [this](const auto &timer) { m_dueTimers.push_back(timer.Id); });
+  ScheduleWakeup();
+  if (m_dueTimers.empty()) {
+    return;
+  }
+
+  // Every popped timer runs and the native calls are flushed even when a timer throws. Otherwise the callbacks of the
+  // remaining timers would stay in the map forever. The first error that could not be reported is rethrown last.
+  std::exception_ptr unreportedError;
+  const jsi::Value frameTime{std::chrono::duration<double, std::milli>{now.time_since_epoch()}.count()};
+  for (const auto id : m_dueTimers) {
+    try {
+      if (m_animationFrames.find(id) != m_animationFrames.end()) {
+        InvokeTimer(id, &frameTime, 1);
+      } else {
+        InvokeTimer(id, nullptr, 0);
+      }
+    } catch (...) {
+      if (!unreportedError) {
+        unreportedError = std::current_exception();
+      }
+    }
+  }
+
+  FlushNativeCalls();
+  if (unreportedError) {
+    std::rethrow_exception(unreportedError);
+  }
+}
+
+void JsiTimers::OnImmediate(int64_t id) {
+  std::exception_ptr unreportedError;
+  try {
+    InvokeTimer(id, nullptr, 0);
+  } catch (...) {
+    unreportedError = std::current_exception();
+  }
+
+  FlushNativeCalls();
+  if (unreportedError) {
+    std::rethrow_exception(unreportedError);
+  }
+}
+
+void JsiTimers::InvokeTimer(int64_t id, const jsi::Value *args, size_t count) {
+  // Timers cleared by the callbacks that ran before this one are no longer in the map.
+  auto callbacks = Callbacks();
+  const jsi::Value idValue{static_cast<double>(id)};
+  const auto callback =
+      callbacks.getPropertyAsFunction(m_runtime, "get").callWithThis(m_runtime, callbacks, &idValue, 1);
+  if (!callback.isObject()) {
+    return;
+  }
+
+  // Intervals stay scheduled until they are cleared, everything else fires once.
+  if (!m_timers.Contains(id)) {
+    m_animationFrames.erase(id);
+    callbacks.getPropertyAsFunction(m_runtime, "delete").callWithThis(m_runtime, callbacks, &idValue, 1);
+  }
+
+  try {
+    callback.getObject(m_runtime).getFunction(m_runtime).call(m_runtime, args, count);
+  } catch (const jsi::JSError &error) {
+    if (!ReportFatalError(m_runtime, error.value())) {
+      throw;
+    }
+  } catch (const std::exception &e) {
+    if (!ReportFatalError(m_runtime, jsi::JSError{m_runtime, e.what()}.value())) {
+      throw;
+    }
+  } catch (...) {
+    if (!ReportFatalError(m_runtime, jsi::JSError{m_runtime, "Unknown exception in a timer callback"}.value())) {
+      throw;
+    }
+  }
+}
+
+void JsiTimers::FlushNativeCalls() {
+  // The callbacks queue their native module calls in the batched bridge, which only sends them when its queue is
+  // flushed at the end of a call from native.
+  if (m_flushNativeCalls) {
+    m_flushNativeCalls();
+  }
+}
+
+void JsiTimers::ScheduleWakeup() noexcept {
+  if (m_timers.IsEmpty()) {
+    if (m_threadpoolTimer) {
+      SetThreadpoolTimer(m_threadpoolTimer, nullptr, 0, 0);
+    }
+    m_wakeupTime = Clock::time_point::max();
+    return;
+  }
+
+  const auto wakeupTime = m_timers.WakeupTime();
+  if (wakeupTime == m_wakeupTime) {
+    return;
+  }
+
+  if (!m_threadpoolTimer) {
+    m_threadpoolTimer = CreateThreadpoolTimer(&JsiTimers::ThreadpoolTimerCallback, static_cast<PVOID>(this), nullptr);
+    if (!m_threadpoolTimer) {
+      return;
+    }
+  }
+
+  // Relative due times are negative, in 100 nanosecond units.
+  using FileTimeDuration = std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>;
+  const auto delay = std::max(wakeupTime - Clock::now(), Clock::duration::zero());
+  ULARGE_INTEGER dueTime;
+  dueTime.QuadPart = static_cast<ULONGLONG>(-std::chrono::duration_cast<FileTimeDuration>(delay).count());
+  FILETIME fileDueTime;
+  fileDueTime.dwHighDateTime = dueTime.HighPart;
+  fileDueTime.dwLowDateTime = dueTime.LowPart;
+
+  m_wakeupTime = wakeupTime;
+  SetThreadpoolTimer(m_threadpoolTimer, &fileDueTime, 0, 0);
+}
+
+} // namespace Microsoft::React
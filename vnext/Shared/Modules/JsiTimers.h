@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Modules/TimerHeap.h>
+#include <cxxreact/MessageQueueThread.h>
+#include <jsi/jsi.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <windows.h>
+
+namespace Microsoft::React {
+
+/// <summary>
+/// Timers installed in the runtime as JSI host functions: setTimeout, setInterval, requestAnimationFrame and
+/// setImmediate, with their clear and cancel functions.
+/// </summary>
+/// <remarks>
+/// Timers are scheduled in a TimerHeap on the JS thread, and a thread pool timer wakes the JS queue up when the next
+/// one is due. Their callbacks are then invoked directly in the runtime, without going through the Timing module,
+/// folly::dynamic arguments or a JSTimers.callTimers call.
+///
+/// The callbacks are kept in a Map in the runtime rather than as jsi values, so that this object can outlive the
+/// runtime, which owns it through the host functions.
+///
+/// The functions are also published as the __nativeTimers global. Outside bridgeless mode, the setUpTimers polyfill
+/// replaces the timer globals with JSTimers, and the Windows setUpTimers restores them from that object.
+/// </remarks>
+class JsiTimers final : public std::enable_shared_from_this<JsiTimers> {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // Installs the timer functions on the global object of the runtime. Must be called on the JS thread.
+  // flushNativeCalls is called after the callbacks that fired together, to send the native module calls they made.
+  static void Install(
+      facebook::jsi::Runtime &runtime,
+      const std::shared_ptr<facebook::react::MessageQueueThread> &jsQueue,
+      std::function<void()> &&flushNativeCalls);
+
+  JsiTimers(
+      facebook::jsi::Runtime &runtime,
+      const std::shared_ptr<facebook::react::MessageQueueThread> &jsQueue,
+      std::function<void()> &&flushNativeCalls);
+  ~JsiTimers();
+
+ private:
+  enum class TimerKind { Timeout, Interval, AnimationFrame, Immediate };
+
+  static VOID CALLBACK
+  ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE instance, PVOID parameter, PTP_TIMER timer) noexcept;
+
+  facebook::jsi::Value CreateTimer(TimerKind kind, const facebook::jsi::Value *args, size_t count);
+  void DeleteTimer(const facebook::jsi::Value &id);
+  facebook::jsi::Object Callbacks();
+  void OnWakeup();
+  void OnImmediate(int64_t id);
+  void InvokeTimer(int64_t id, const facebook::jsi::Value *args, size_t count);
+  void FlushNativeCalls();
+  void ScheduleWakeup() noexcept;
+
+  facebook::jsi::Runtime &m_runtime;
+  std::weak_ptr<facebook::react::MessageQueueThread> m_jsQueue;
+  std::function<void()> m_flushNativeCalls;
+  TimerHeap<Clock::time_point> m_timers;
+  std::unordered_set<int64_t> m_animationFrames;
+  std::vector<int64_t> m_dueTimers;
+  int64_t m_nextId{1};
+  PTP_TIMER m_threadpoolTimer{nullptr};
+  Clock::time_point m_wakeupTime{Clock::time_point::max()};
+};
+
+} // namespace Microsoft::React
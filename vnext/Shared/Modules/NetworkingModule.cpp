@@ -11,10 +11,13 @@
 #include <winrt/Windows.Web.Http.h>
 #include "NetworkingModule.h"
 
+#include <Modules/BlobModule.h>
+
 #include <future>
 #include "Unicode.h"
 #include "Utilities.h"
 
+#include <ReactCommon/CallInvoker.h>
 #include <cxxreact/Instance.h>
 #include <cxxreact/JsArgumentHelpers.h>
 
@@ -25,6 +28,33 @@
 
 namespace Microsoft::React {
 
+namespace {
+
+// Size of the body segments read from the response stream.
+constexpr uint32_t ResponseChunkSize = 64 * 1024;
+
+// Incremental data sent to JS but not yet processed by the JS thread, past which reading the response pauses.
+constexpr size_t MaxPendingResponseBytes = 1024 * 1024;
+
+// Returns the length of the longest prefix of text that does not end in the middle of a UTF-8 sequence.
+size_t Utf8CompletePrefixLength(const std::string &text) {
+  size_t length = text.size();
+
+  // Look back at most three bytes for the lead byte of the last sequence.
+  for (size_t i = 1; i <= 3 && i <= length; ++i) {
+    auto byte = static_cast<uint8_t>(text[length - i]);
+    if ((byte & 0xC0) == 0x80)
+      continue; // Continuation byte
+
+    size_t sequenceLength = byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : byte >= 0xC0 ? 2 : 1;
+    return sequenceLength > i ? length - i : length;
+  }
+
+  return length;
+}
+
+} // namespace
+
 //
 // NetworkingModule::NetworkingHelper
 //
@@ -32,10 +62,21 @@ class NetworkingModule::NetworkingHelper : public std::enable_shared_from_this<N
  public:
   NetworkingHelper(NetworkingModule *parent) : m_parent(parent) {}
 
+  // Bounds the incremental data queued on the JS thread for a single response.
+  struct ResponseFlowControl {
+    std::atomic_size_t PendingBytes{0};
+    winrt::handle Drained{
+        CreateEvent(/*attributes*/ nullptr, /*manual reset*/ false, /*state*/ false, /*name*/ nullptr)};
+  };
+
   void Disconnect() {
     m_parent = nullptr;
   }
 
+  bool IsConnected() const noexcept {
+    return m_parent != nullptr;
+  }
+
   void SendRequest(
       const std::string &method,
       const std::string &url,
@@ -50,8 +91,21 @@ class NetworkingModule::NetworkingHelper : public std::enable_shared_from_this<N
 
   // Event helpers
   void sendEvent(std::string &&eventName, folly::dynamic &&parameters);
+  void sendEvent(
+      std::string &&eventName,
+      folly::dynamic &&parameters,
+      const std::shared_ptr<ResponseFlowControl> &flowControl,
+      size_t byteCount);
   void OnResponseReceived(int64_t requestId, winrt::Windows::Web::Http::HttpResponseMessage response);
   void OnDataReceived(int64_t requestId, std::string &&response);
+  void OnBlobReceived(int64_t requestId, const std::string &blobId, size_t size);
+  void OnIncrementalDataReceived(
+      int64_t requestId,
+      std::string &&data,
+      int64_t progress,
+      int64_t total,
+      const std::shared_ptr<ResponseFlowControl> &flowControl);
+  void OnDataProgress(int64_t requestId, int64_t progress, int64_t total);
   void OnRequestSuccess(int64_t requestId);
   void OnRequestError(int64_t requestId, std::string &&error, bool isTimeout);
 
@@ -71,6 +125,22 @@ class NetworkingModule::NetworkingHelper : public std::enable_shared_from_this<N
     std::scoped_lock lock(m_mutex);
     m_requests.erase(requestId);
   }
+  bool HasRequest(int64_t requestId) {
+    std::scoped_lock lock(m_mutex);
+    return m_requests.count(requestId) > 0;
+  }
+
+  // Returns the blob registry of the current instance, if it has one.
+  std::shared_ptr<BlobRegistry> GetBlobRegistry() {
+    if (!m_parent)
+      return nullptr;
+
+    auto instance = m_parent->getInstance().lock();
+    if (!instance)
+      return nullptr;
+
+    return BlobRegistry::Find(instance);
+  }
 
  private:
   static void FillHeadersMap(
@@ -98,6 +168,8 @@ winrt::fire_and_forget SendRequestAsync(
     winrt::Windows::Web::Http::HttpClient httpClient,
     winrt::Windows::Web::Http::HttpRequestMessage request,
     bool textResponse,
+    std::shared_ptr<BlobRegistry> blobRegistry,
+    bool useIncrementalUpdates,
     int64_t requestId) {
   // NotYetImplemented: set timeout
 
@@ -123,28 +195,86 @@ winrt::fire_and_forget SendRequestAsync(
     if (response != nullptr)
       networking->OnResponseReceived(requestId, response);
 
-    // NotYetImplemented: useIncrementalUpdates
-
     if (response != nullptr && response.Content() != nullptr) {
       winrt::Windows::Storage::Streams::IInputStream inputStream = co_await response.Content().ReadAsInputStreamAsync();
-      auto reader = winrt::Windows::Storage::Streams::DataReader(inputStream);
 
-      if (textResponse)
-        reader.UnicodeEncoding(winrt::Windows::Storage::Streams::UnicodeEncoding::Utf8);
+      int64_t total = -1;
+      if (auto contentLength = response.Content().Headers().ContentLength())
+        total = static_cast<int64_t>(contentLength.Value());
+
+      // Incremental text is handed to JS chunk by chunk. Anything else is kept as the segments read from the
+      // stream, and joined once the whole body has arrived.
+      bool streamText = useIncrementalUpdates && textResponse;
+      std::vector<winrt::Windows::Storage::Streams::IBuffer> segments;
+      std::string pendingText; // Carries an incomplete UTF-8 sequence over to the next chunk.
+      auto flowControl = std::make_shared<NetworkingModule::NetworkingHelper::ResponseFlowControl>();
+      int64_t loaded = 0;
+
+      for (;;) {
+        // Aborted, or the module is gone.
+        if (!networking->HasRequest(requestId) || !networking->IsConnected()) {
+          networking->RemoveRequest(requestId);
+          co_return;
+        }
+
+        // Let a slow JS thread catch up before reading more.
+        while (flowControl->PendingBytes > MaxPendingResponseBytes && networking->IsConnected())
+          co_await winrt::resume_on_signal(flowControl->Drained.get(), std::chrono::seconds{1});
+
+        winrt::Windows::Storage::Streams::IBuffer segment = co_await inputStream.ReadAsync(
+            winrt::Windows::Storage::Streams::Buffer{ResponseChunkSize},
+            ResponseChunkSize,
+            winrt::Windows::Storage::Streams::InputStreamOptions::Partial);
+        if (segment.Length() == 0)
+          break;
+
+        loaded += segment.Length();
+
+        if (streamText) {
+          pendingText.append(reinterpret_cast<const char *>(segment.data()), segment.Length());
+          auto complete = Utf8CompletePrefixLength(pendingText);
+          std::string tail = pendingText.substr(complete);
+          pendingText.resize(complete);
+
+          networking->OnIncrementalDataReceived(requestId, std::move(pendingText), loaded, total, flowControl);
+          pendingText = std::move(tail);
+        } else {
+          segments.push_back(std::move(segment));
 
-      // Only support up to 10MB response sizes
-      co_await reader.LoadAsync(10000000);
-      uint32_t len = reader.UnconsumedBufferLength();
+          if (useIncrementalUpdates)
+            networking->OnDataProgress(requestId, loaded, total);
+        }
+      }
 
-      if (textResponse) {
-        std::vector<uint8_t> data(len);
-        reader.ReadBytes(data);
-        std::string responseData =
-            std::string(Microsoft::Common::Utilities::CheckedReinterpretCast<char *>(data.data()), data.size());
+      if (streamText) {
+        if (!pendingText.empty())
+          networking->OnIncrementalDataReceived(requestId, std::move(pendingText), loaded, total, flowControl);
+      } else if (textResponse) {
+        std::string responseData;
+        responseData.reserve(static_cast<size_t>(loaded));
+        for (const auto &segment : segments)
+          responseData.append(reinterpret_cast<const char *>(segment.data()), segment.Length());
 
         networking->OnDataReceived(requestId, std::move(responseData));
+      } else if (blobRegistry) {
+        // Blob responses stay on the native side; JS only receives their descriptor.
+        std::vector<uint8_t> responseData;
+        responseData.reserve(static_cast<size_t>(loaded));
+        for (const auto &segment : segments)
+          responseData.insert(responseData.end(), segment.data(), segment.data() + segment.Length());
+        segments.clear();
+
+        auto blobId = blobRegistry->Store(std::move(responseData));
+        networking->OnBlobReceived(requestId, blobId, static_cast<size_t>(loaded));
       } else {
-        auto buffer = reader.ReadBuffer(len);
+        winrt::Windows::Storage::Streams::Buffer buffer{static_cast<uint32_t>(loaded)};
+        uint8_t *position = buffer.data();
+        for (const auto &segment : segments) {
+          position = std::copy(segment.data(), segment.data() + segment.Length(), position);
+        }
+        buffer.Length(static_cast<uint32_t>(loaded));
+        segments.clear();
+
         winrt::hstring data = winrt::Windows::Security::Cryptography::CryptographicBuffer::EncodeToBase64String(buffer);
         std::string responseData = Microsoft::Common::Unicode::Utf16ToUtf8(std::wstring_view(data));
 
@@ -173,6 +303,28 @@ void NetworkingModule::NetworkingHelper::sendEvent(std::string &&eventName, foll
     instance->callJSFunction("RCTDeviceEventEmitter", "emit", folly::dynamic::array(eventName, std::move(parameters)));
 }
 
+void NetworkingModule::NetworkingHelper::sendEvent(
+    std::string &&eventName,
+    folly::dynamic &&parameters,
+    const std::shared_ptr<ResponseFlowControl> &flowControl,
+    size_t byteCount) {
+  if (!m_parent)
+    return;
+
+  auto instance = m_parent->getInstance().lock();
+  if (!instance)
+    return;
+
+  flowControl->PendingBytes += byteCount;
+  instance->callJSFunction("RCTDeviceEventEmitter", "emit", folly::dynamic::array(eventName, std::move(parameters)));
+
+  // The JS call invoker shares the JS queue with callJSFunction, so this runs once the event has been dispatched.
+  instance->getJSCallInvoker()->invokeAsync([flowControl, byteCount]() {
+    if ((flowControl->PendingBytes -= byteCount) <= MaxPendingResponseBytes)
+      SetEvent(flowControl->Drained.get());
+  });
+}
+
 void NetworkingModule::NetworkingHelper::FillHeadersMap(
     folly::dynamic &headersMap,
     winrt::Windows::Foundation::Collections::IMap<winrt::hstring, winrt::hstring> headers) {
@@ -210,6 +362,30 @@ void NetworkingModule::NetworkingHelper::OnDataReceived(int64_t requestId, std::
   sendEvent("didReceiveNetworkData", std::move(receiveArgs));
 }
 
+void NetworkingModule::NetworkingHelper::OnBlobReceived(int64_t requestId, const std::string &blobId, size_t size) {
+  folly::dynamic receiveArgs = folly::dynamic::array(requestId, BlobRegistry::CreateDescriptor(blobId, size));
+
+  sendEvent("didReceiveNetworkData", std::move(receiveArgs));
+}
+
+void NetworkingModule::NetworkingHelper::OnIncrementalDataReceived(
+    int64_t requestId,
+    std::string &&data,
+    int64_t progress,
+    int64_t total,
+    const std::shared_ptr<ResponseFlowControl> &flowControl) {
+  auto byteCount = data.size();
+  folly::dynamic receiveArgs = folly::dynamic::array(requestId, std::move(data), progress, total);
+
+  sendEvent("didReceiveNetworkIncrementalData", std::move(receiveArgs), flowControl, byteCount);
+}
+
+void NetworkingModule::NetworkingHelper::OnDataProgress(int64_t requestId, int64_t progress, int64_t total) {
+  folly::dynamic progressArgs = folly::dynamic::array(requestId, progress, total);
+
+  sendEvent("didReceiveNetworkDataProgress", std::move(progressArgs));
+}
+
 void NetworkingModule::NetworkingHelper::OnRequestSuccess(int64_t requestId) {
   folly::dynamic completeArgs = folly::dynamic::array(requestId);
 
@@ -255,18 +431,27 @@ void NetworkingModule::NetworkingHelper::SendRequest(
     const folly::dynamic &headers,
     folly::dynamic bodyData,
     const std::string &responseType,
-    [[maybe_unused]] bool useIncrementalUpdates,
+    bool useIncrementalUpdates,
     int64_t /*timeout*/,
     Callback cb) noexcept {
   int64_t requestId = ++s_lastRequestId;
 
   // Enforce supported args
-  assert(responseType == "text" || responseType == "base64");
+  assert(responseType == "text" || responseType == "base64" || responseType == "blob");
 
   // Callback with the requestId
   cb({requestId});
 
   try {
+    std::shared_ptr<BlobRegistry> blobRegistry;
+    if (responseType == "blob" || (!bodyData.empty() && !bodyData["blob"].empty())) {
+      blobRegistry = GetBlobRegistry();
+      if (!blobRegistry) {
+        OnRequestError(requestId, "Blob module is not available", false /*isTimeout*/);
+        return;
+      }
+    }
+
     winrt::Windows::Web::Http::HttpMethod httpMethod(Microsoft::Common::Unicode::Utf8ToUtf16(method));
     winrt::Windows::Foundation::Uri uri(Microsoft::Common::Unicode::Utf8ToUtf16(url));
 
@@ -309,6 +494,18 @@ void NetworkingModule::NetworkingHelper::SendRequest(
             Microsoft::Common::Unicode::Utf8ToUtf16(bodyData["base64"].asString()));
         winrt::Windows::Web::Http::HttpBufferContent contentBase64(buffer);
         content = contentBase64;
+      } else if (!bodyData["blob"].empty()) {
+        // blob request, read straight from the native blob store
+        auto slice = blobRegistry->Resolve(bodyData["blob"]);
+        if (!slice) {
+          OnRequestError(requestId, "Unknown blob", false /*isTimeout*/);
+          return;
+        }
+
+        auto buffer = winrt::Windows::Security::Cryptography::CryptographicBuffer::CreateFromByteArray(
+            {slice->Data(), slice->Data() + slice->Size});
+        winrt::Windows::Web::Http::HttpBufferContent contentBlob(buffer);
+        content = contentBlob;
       } else if (!bodyData["uri"].empty()) {
         // file content request
         winrt::Windows::Foundation::Uri uri2(Microsoft::Common::Unicode::Utf8ToUtf16(bodyData["uri"].asString()));
@@ -352,7 +549,14 @@ void NetworkingModule::NetworkingHelper::SendRequest(
       }
     }
 
-    SendRequestAsync(getSelf(), m_httpClient, request, responseType == "text", requestId);
+    SendRequestAsync(
+        getSelf(),
+        m_httpClient,
+        request,
+        responseType == "text",
+        responseType == "blob" ? blobRegistry : nullptr,
+        useIncrementalUpdates,
+        requestId);
   } catch (...) {
     OnRequestError(requestId, "Unhandled exception during request", false /*isTimeout*/);
   }
@@ -376,6 +580,9 @@ void NetworkingModule::NetworkingHelper::AbortRequest(int64_t requestId) noexcep
   } catch (...) {
     // Error canceling request
   }
+
+  // Stops reading the response body, if it is being streamed.
+  RemoveRequest(requestId);
 }
 
 void NetworkingModule::NetworkingHelper::ClearCookies() noexcept {
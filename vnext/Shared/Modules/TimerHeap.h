@@ -0,0 +1,211 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::React {
+
+/// <summary>
+/// The pending timers of a Timing module, ordered by due time and indexed by timer id.
+/// </summary>
+/// <remarks>
+/// Timers are kept in a 4-ary heap, with the position of each timer in a map, so that a timer is added or removed in
+/// O(log n). Timers with the same due time fire in the order they were scheduled.
+///
+/// Repeating timers are rescheduled from their previous due time rather than from the time they fired, so that they
+/// do not drift. Periods that were missed entirely are skipped instead of being fired in a burst.
+///
+/// The slack lets a wakeup also serve the timers due shortly after the first one: a module wakes up at WakeupTime, when
+/// the first timer is due, and PopDue also fires the timers due within the slack after that time, slightly early.
+/// </remarks>
+template <typename TTimePoint>
+class TimerHeap {
+ public:
+  using Duration = typename TTimePoint::duration;
+
+  struct Timer {
+    int64_t Id;
+    TTimePoint DueTime;
+    Duration Period;
+    bool Repeat;
+  };
+
+  explicit TimerHeap(Duration slack = Duration::zero()) noexcept : m_slack(slack) {}
+
+  Duration Slack() const noexcept {
+    return m_slack;
+  }
+
+  void SetSlack(Duration slack) noexcept {
+    m_slack = slack;
+  }
+
+  // Schedules the timer, replacing any pending timer with the same id.
+  void Push(int64_t id, TTimePoint dueTime, Duration period, bool repeat) {
+    const auto position = m_positions.find(id);
+    if (position != m_positions.end()) {
+      auto &entry = m_entries[position->second];
+      entry.Value = Timer{id, dueTime, period, repeat};
+      entry.Sequence = m_nextSequence++;
+      Restore(position->second);
+      return;
+    }
+
+    m_entries.push_back(Entry{Timer{id, dueTime, period, repeat}, m_nextSequence++});
+    m_positions.emplace(id, m_entries.size() - 1);
+    SiftUp(m_entries.size() - 1);
+  }
+
+  bool Remove(int64_t id) {
+    const auto position = m_positions.find(id);
+    if (position == m_positions.end()) {
+      return false;
+    }
+
+    const auto index = position->second;
+    m_positions.erase(position);
+    if (index + 1 != m_entries.size()) {
+      Move(std::move(m_entries.back()), index);
+      m_entries.pop_back();
+      Restore(index);
+    } else {
+      m_entries.pop_back();
+    }
+    return true;
+  }
+
+  bool Contains(int64_t id) const noexcept {
+    return m_positions.find(id) != m_positions.end();
+  }
+
+  bool IsEmpty() const noexcept {
+    return m_entries.empty();
+  }
+
+  size_t Size() const noexcept {
+    return m_entries.size();
+  }
+
+  // The timer due first.
+  const Timer &Front() const noexcept {
+    assert(!IsEmpty());
+    return m_entries.front().Value;
+  }
+
+  // The time to wake up at to fire the front timer.
+  TTimePoint WakeupTime() const noexcept {
+    return Front().DueTime;
+  }
+
+  // Removes the timers due at or before the given time plus the slack, in firing order, calling onDue with each of
+  // them. Repeating timers are rescheduled for their first due time after the given time, and fire at most once per
+  // call even when their next due time is still within the slack.
+  template <typename TOnDue>
+  void PopDue(TTimePoint time, TOnDue &&onDue) {
+    // Repeating timers are only pushed back once every due timer fired.
+    m_rescheduled.clear();
+    while (!IsEmpty() && Front().DueTime <= time + m_slack) {
+      auto timer = Front();
+      Remove(timer.Id);
+      onDue(static_cast<const Timer &>(timer));
+      if (timer.Repeat) {
+        timer.DueTime = NextDueTime(timer, std::max(time, timer.DueTime));
+        m_rescheduled.push_back(timer);
+      }
+    }
+
+    for (const auto &timer : m_rescheduled) {
+      Push(timer.Id, timer.DueTime, timer.Period, timer.Repeat);
+    }
+  }
+
+ private:
+  static constexpr size_t Arity = 4;
+
+  struct Entry {
+    Timer Value;
+    uint64_t Sequence;
+  };
+
+  static TTimePoint NextDueTime(const Timer &timer, TTimePoint time) noexcept {
+    // A zero period would never get past the time, so such timers are due again at the next tick of the clock.
+    if (timer.Period <= Duration::zero()) {
+      return time + Duration{1};
+    }
+
+    const auto missedPeriods = (time - timer.DueTime) / timer.Period;
+    return timer.DueTime + timer.Period * (missedPeriods + 1);
+  }
+
+  static bool Precedes(const Entry &left, const Entry &right) noexcept {
+    return left.Value.DueTime < right.Value.DueTime ||
+        (left.Value.DueTime == right.Value.DueTime && left.Sequence < right.Sequence);
+  }
+
+  void Move(Entry &&entry, size_t index) noexcept {
+    m_positions.find(entry.Value.Id)->second = index;
+    m_entries[index] = std::move(entry);
+  }
+
+  void Restore(size_t index) noexcept {
+    if (index > 0 && Precedes(m_entries[index], m_entries[(index - 1) / Arity])) {
+      SiftUp(index);
+    } else {
+      SiftDown(index);
+    }
+  }
+
+  void SiftUp(size_t index) noexcept {
+    auto entry = std::move(m_entries[index]);
+    while (index > 0) {
+      const auto parent = (index - 1) / Arity;
+      if (!Precedes(entry, m_entries[parent])) {
+        break;
+      }
+      Move(std::move(m_entries[parent]), index);
+      index = parent;
+    }
+    Move(std::move(entry), index);
+  }
+
+  void SiftDown(size_t index) noexcept {
+    auto entry = std::move(m_entries[index]);
+    const auto size = m_entries.size();
+    while (true) {
+      const auto firstChild = index * Arity + 1;
+      if (firstChild >= size) {
+        break;
+      }
+
+      auto child = firstChild;
+      const auto lastChild = std::min(firstChild + Arity, size);
+      for (auto sibling = firstChild + 1; sibling < lastChild; sibling++) {
+        if (Precedes(m_entries[sibling], m_entries[child])) {
+          child = sibling;
+        }
+      }
+
+      if (!Precedes(m_entries[child], entry)) {
+        break;
+      }
+      Move(std::move(m_entries[child]), index);
+      index = child;
+    }
+    Move(std::move(entry), index);
+  }
+
+  std::vector<Entry> m_entries;
+  std::unordered_map<int64_t, size_t> m_positions;
+  uint64_t m_nextSequence{0};
+  Duration m_slack;
+  std::vector<Timer> m_rescheduled;
+};
+
+} // namespace Microsoft::React
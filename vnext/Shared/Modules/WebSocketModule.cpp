@@ -5,9 +5,15 @@
 
 #include <Modules/WebSocketModule.h>
 
+#include <JSI/ByteArrayBuffer.h>
+#include <JSI/ChakraRuntimeFactory.h>
+#include <Modules/BlobModule.h>
+#include <ReactCommon/CallInvoker.h>
 #include <Utils.h>
 #include <cxxreact/Instance.h>
 #include <cxxreact/JsArgumentHelpers.h>
+#include <jsi/jsi.h>
+#include <winrt/Windows.Security.Cryptography.h>
 #include "Unicode.h"
 
 // Standard Libriary
@@ -21,10 +27,47 @@ using Microsoft::Common::Unicode::Utf8ToUtf16;
 
 using std::shared_ptr;
 using std::string;
+using std::vector;
 using std::weak_ptr;
 
+using winrt::Windows::Security::Cryptography::CryptographicBuffer;
+
 namespace {
 constexpr char moduleName[] = "WebSocketModule";
+
+// Emits a websocketMessage event whose data is an ArrayBuffer over the message bytes. folly::dynamic cannot hold an
+// ArrayBuffer, so this calls RCTDeviceEventEmitter.emit on the callable module of the batched bridge. The native calls
+// that the listeners queue stay in the bridge queue; the JS call invoker flushes them as the end of a batch after the
+// work item returns, as it does for the other work it runs.
+void EmitArrayBufferMessage(
+    facebook::react::Instance &instance,
+    facebook::jsi::Runtime &rt,
+    int64_t id,
+    vector<uint8_t> &&message) {
+  try {
+    facebook::jsi::Object event{rt};
+    event.setProperty(rt, "id", static_cast<double>(id));
+    // WebSocket.js passes the data of unknown message types through as is.
+    event.setProperty(rt, "type", "arraybuffer");
+    event.setProperty(
+        rt,
+        "data",
+        Microsoft::JSI::MakeExternalArrayBuffer(
+            rt, std::make_unique<Microsoft::JSI::ByteArrayBuffer>(std::move(message))));
+
+    auto bridge = rt.global().getPropertyAsObject(rt, "__fbBatchedBridge");
+    auto emitter = bridge.getPropertyAsFunction(rt, "getCallableModule")
+                       .callWithThis(rt, bridge, "RCTDeviceEventEmitter")
+                       .asObject(rt);
+    emitter.getPropertyAsFunction(rt, "emit").callWithThis(rt, emitter, "websocketMessage", std::move(event));
+  } catch (const facebook::jsi::JSIException &e) {
+    instance.callJSFunction(
+        "RCTDeviceEventEmitter",
+        "emit",
+        dynamic::array("websocketFailed", dynamic::object("id", id)("message", e.what())));
+  }
+}
+
 } // anonymous namespace
 
 namespace Microsoft::React {
@@ -151,6 +194,48 @@ void WebSocketModule::SendEvent(string &&eventName, dynamic &&args) {
   }
 }
 
+bool WebSocketModule::TrySendBlobMessageEvent(int64_t id, vector<uint8_t> &&message) {
+  // Assigned before the socket connects, so no message can arrive ahead of it.
+  if (!m_blobRegistry || !m_blobRegistry->HandlesWebSocket(id))
+    return false;
+
+  auto size = message.size();
+  auto blobId = m_blobRegistry->Store(std::move(message));
+  auto data = BlobRegistry::CreateDescriptor(blobId, size);
+  SendEvent("websocketMessage", dynamic::object("id", id)("type", "blob")("data", std::move(data)));
+
+  return true;
+}
+
+void WebSocketModule::SendBinaryMessageEvent(int64_t id, vector<uint8_t> &&message) {
+  auto weakInstance = this->getInstance();
+  auto instance = weakInstance.lock();
+  if (!instance)
+    return;
+
+  // Only JSI executors expose their JavaScript context.
+  if (!instance->getJavaScriptContext()) {
+    auto buffer = CryptographicBuffer::CreateFromByteArray(message);
+    auto data = winrt::to_string(CryptographicBuffer::EncodeToBase64String(buffer));
+    SendEvent("websocketMessage", dynamic::object("id", id)("data", std::move(data))("type", "binary"));
+    return;
+  }
+
+  // The JS call invoker shares the JS queue with callJSFunction, so messages stay in order.
+  // The callback only holds weak references, since it may outlive this module and the instance.
+  instance->getJSCallInvoker()->invokeAsync([id, weakInstance, message = std::move(message)]() mutable {
+    auto instance = weakInstance.lock();
+    if (!instance)
+      return;
+
+    auto runtime = static_cast<facebook::jsi::Runtime *>(instance->getJavaScriptContext());
+    if (!runtime)
+      return;
+
+    EmitArrayBufferMessage(*instance, *runtime, id, std::move(message));
+  });
+}
+
 // clang-format off
 shared_ptr<IWebSocketResource> WebSocketModule::GetOrCreateWebSocket(int64_t id, string&& url)
 {
@@ -192,6 +277,9 @@ shared_ptr<IWebSocketResource> WebSocketModule::GetOrCreateWebSocket(int64_t id,
       if (!strongInstance)
         return;
 
+      if (this->m_blobRegistry)
+        this->m_blobRegistry->RemoveWebSocket(id);
+
       auto errorObj = dynamic::object("id", id)("message", err.Message);
       this->SendEvent("websocketFailed", std::move(errorObj));
     });
@@ -210,19 +298,52 @@ shared_ptr<IWebSocketResource> WebSocketModule::GetOrCreateWebSocket(int64_t id,
       if (!strongInstance)
         return;
 
+      if (isBinary && this->m_blobRegistry && this->m_blobRegistry->HandlesWebSocket(id))
+      {
+        auto buffer = CryptographicBuffer::DecodeFromBase64String(Utf8ToUtf16(message));
+        vector<uint8_t> bytes(buffer.data(), buffer.data() + buffer.Length());
+        if (this->TrySendBlobMessageEvent(id, std::move(bytes)))
+          return;
+      }
+
       auto args = dynamic::object("id", id)("data", message)("type", isBinary ? "binary" : "text");
       this->SendEvent("websocketMessage", std::move(args));
     });
+    ws->SetOnBinaryMessage([this, id, weakInstance](vector<uint8_t>&& message)
+    {
+      auto strongInstance = weakInstance.lock();
+      if (!strongInstance)
+        return;
+
+      if (this->TrySendBlobMessageEvent(id, std::move(message)))
+        return;
+
+      this->SendBinaryMessageEvent(id, std::move(message));
+    });
     ws->SetOnClose([this, id, weakInstance](IWebSocketResource::CloseCode code, const string& reason)
     {
       auto strongInstance = weakInstance.lock();
       if (!strongInstance)
         return;
 
+      if (this->m_blobRegistry)
+        this->m_blobRegistry->RemoveWebSocket(id);
+
       auto args = dynamic::object("id", id)("code", static_cast<uint16_t>(code))("reason", reason);
       this->SendEvent("websocketClosed", std::move(args));
     });
 
+    // Only register with a registry that BlobModule has created, which it does when the networking setup runs.
+    // Without the BlobModule, nothing can send blobs over the socket.
+    if (auto instance = weakInstance.lock())
+    {
+      if (!m_blobRegistry)
+        m_blobRegistry = BlobRegistry::Find(instance);
+
+      if (m_blobRegistry)
+        m_blobRegistry->AddWebSocket(id, ws);
+    }
+
     m_webSockets.emplace(id, ws);
     return ws;
   }
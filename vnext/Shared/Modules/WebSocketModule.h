@@ -6,6 +6,10 @@
 #include <cxxreact/CxxModule.h>
 #include "IWebSocketResource.h"
 
+namespace Microsoft::React {
+class BlobRegistry;
+}
+
 namespace Microsoft::React {
 
 ///
@@ -46,6 +50,22 @@ class WebSocketModule : public facebook::xplat::module::CxxModule {
   /// </summary>
   void SendEvent(std::string &&eventName, folly::dynamic &&parameters);
 
+  /// <summary>
+  /// Notifies an incoming binary message to the current React Instance.
+  /// With a JSI runtime, the message is passed to JS as an <c>ArrayBuffer</c>.
+  /// Otherwise it is passed as a Base64 string.
+  /// </summary>
+  void SendBinaryMessageEvent(std::int64_t id, std::vector<std::uint8_t> &&message);
+
+  /// <summary>
+  /// Stores an incoming binary message in the instance's <see cref="BlobRegistry" />
+  /// and notifies its blob descriptor, if the socket has a blob handler.
+  /// </summary>
+  /// <returns>
+  /// <c>false</c> if the message must be delivered as an array buffer or Base64 string instead.
+  /// </returns>
+  bool TrySendBlobMessageEvent(std::int64_t id, std::vector<std::uint8_t> &&message);
+
   /// <summary>
   /// Creates or retrieves a raw <c>IWebSocketResource</c> pointer.
   /// </summary>
@@ -61,6 +81,11 @@ class WebSocketModule : public facebook::xplat::module::CxxModule {
   /// Generates IWebSocketResource instances, defaulting to IWebSocketResource::Make.
   /// </summary>
   std::function<std::shared_ptr<IWebSocketResource>(std::string &&)> m_resourceFactory;
+
+  /// <summary>
+  /// Lets <c>BlobModule</c> send blobs over the sockets created by this module.
+  /// </summary>
+  std::shared_ptr<BlobRegistry> m_blobRegistry;
 };
 
 } // namespace Microsoft::React
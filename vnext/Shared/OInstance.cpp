@@ -23,7 +23,10 @@
 #include <cxxreact/MessageQueueThread.h>
 #include <cxxreact/ModuleRegistry.h>
 
+#include <Modules/BlobModule.h>
 #include <Modules/ExceptionsManagerModule.h>
+#include <Modules/FileReaderModule.h>
+#include <Modules/JsiTimers.h>
 #include <Modules/PlatformConstantsModule.h>
 #include <Modules/SourceCodeModule.h>
 #include <Modules/StatusBarManagerModule.h>
@@ -41,6 +44,8 @@
 #include <Shlwapi.h>
 #include <WebSocketJSExecutorFactory.h>
 #include "PackagerConnection.h"
+#include "RAMBundle.h"
+#include "StartupTimeline.h"
 
 #if defined(INCLUDE_HERMES)
 #include "HermesRuntimeHolder.h"
@@ -137,6 +142,7 @@ std::string GetJSBundleFilePath(const std::string &jsBundleBasePath, const std::
 } // namespace
 
 using namespace facebook;
+using Microsoft::React::StartupMarker;
 
 namespace facebook {
 namespace react {
@@ -173,7 +179,7 @@ class OJSIExecutorFactory : public JSExecutorFactory {
       turboModuleManager->getModule(moduleName);
     }
 
-    return std::make_unique<JSIExecutor>(
+    auto executor = std::make_unique<JSIExecutor>(
         runtimeHolder_->getRuntime(),
         std::move(delegate),
         JSIExecutor::defaultTimeoutInvoker,
@@ -182,6 +188,15 @@ class OJSIExecutorFactory : public JSExecutorFactory {
           facebook::react::tracing::initializeJSHooks(runtime, isProfiling);
 #endif
         });
+
+    // The timers only flush from work items on the JS queue. NativeToJsBridge destroys the executor in a work item on
+    // that queue, after quitting it, so no timer can flush through the executor once it is gone.
+    if (Microsoft::React::GetRuntimeOptionBool("JSI.NativeTimers")) {
+      Microsoft::React::JsiTimers::Install(
+          *runtimeHolder_->getRuntime(), jsQueue, [executor = executor.get()]() { executor->flush(); });
+    }
+
+    return executor;
   }
 
   OJSIExecutorFactory(
@@ -466,26 +481,79 @@ void InstanceImpl::loadBundleInternal(std::string &&jsBundleRelativePath, bool s
           bundleUrl,
           synchronously);
     } else {
+      auto startupTimeline = m_devSettings->startupTimeline;
+      auto markStartup = [&startupTimeline](StartupMarker marker, const std::string &tag) {
+        if (startupTimeline)
+          startupTimeline->Mark(marker, tag);
+      };
+
+      // Asynchronous loads evaluate the bundle on the JS queue, so the evaluation is bracketed by queued markers.
+      auto markEvaluation = [this, &startupTimeline, synchronously](StartupMarker marker, const std::string &tag) {
+        if (!startupTimeline)
+          return;
+
+        if (synchronously)
+          startupTimeline->Mark(marker, tag);
+        else
+          m_jsThread->runOnQueue([startupTimeline, marker, tag]() { startupTimeline->Mark(marker, tag); });
+      };
+
 #if (defined(_MSC_VER) && !defined(WINRT))
       auto fullBundleFilePath = GetJSBundleFilePath(m_jsBundleBasePath, jsBundleRelativePath);
 
       // If fullBundleFilePath exists, load User bundle.
       // Otherwise all bundles (User and Platform) are loaded through
       // platformBundles.
-      if (PathFileExistsA(fullBundleFilePath.c_str())) {
+      if (PathFileExistsA(fullBundleFilePath.c_str()) && Microsoft::ReactNative::IsRAMBundle(fullBundleFilePath)) {
+        // Modules are evaluated on first require. Only the startup code runs now.
+        markStartup(StartupMarker::ReadBundleStart, fullBundleFilePath);
+        std::unique_ptr<const JSBigString> startupCode;
+        auto registry = Microsoft::ReactNative::MakeRAMBundleRegistry(fullBundleFilePath, startupCode);
+        markStartup(StartupMarker::ReadBundleStop, fullBundleFilePath);
+
+        markEvaluation(StartupMarker::EvaluateBundleStart, fullBundleFilePath);
+        m_innerInstance->loadRAMBundle(std::move(registry), std::move(startupCode), fullBundleFilePath, synchronously);
+        markEvaluation(StartupMarker::EvaluateBundleStop, fullBundleFilePath);
+      } else if (PathFileExistsA(fullBundleFilePath.c_str())) {
+        markStartup(StartupMarker::ReadBundleStart, fullBundleFilePath);
 #if defined(_CHAKRACORE_H_)
         auto bundleString = FileMappingBigString::fromPath(fullBundleFilePath);
 #else
         auto bundleString = JSBigFileString::fromPath(fullBundleFilePath);
 #endif
-        m_innerInstance->loadScriptFromString(std::move(bundleString), std::move(fullBundleFilePath), synchronously);
+        markStartup(StartupMarker::ReadBundleStop, fullBundleFilePath);
+
+        markEvaluation(StartupMarker::EvaluateBundleStart, fullBundleFilePath);
+        m_innerInstance->loadScriptFromString(std::move(bundleString), fullBundleFilePath, synchronously);
+        markEvaluation(StartupMarker::EvaluateBundleStop, fullBundleFilePath);
       }
 
 #else
       std::string bundlePath = (fs::path(m_devSettings->bundleRootPath) / (jsBundleRelativePath + ".bundle")).string();
 
+      // Application URIs can not be memory-mapped, so RAM bundles are only detected on file system paths.
+      markStartup(StartupMarker::ReadBundleStart, bundlePath);
+      if (!bundlePath._Starts_with("ms-app") && Microsoft::ReactNative::IsRAMBundle(bundlePath)) {
+        std::unique_ptr<const JSBigString> startupCode;
+        auto registry = Microsoft::ReactNative::MakeRAMBundleRegistry(bundlePath, startupCode);
+        markStartup(StartupMarker::ReadBundleStop, bundlePath);
+
+        markEvaluation(StartupMarker::EvaluateBundleStart, bundlePath);
+        m_innerInstance->loadRAMBundle(std::move(registry), std::move(startupCode), bundlePath, synchronously);
+        markEvaluation(StartupMarker::EvaluateBundleStop, bundlePath);
+        return;
+      }
+
+      // The file is read in the background. Asynchronous loads wait for it when the bundle is evaluated.
       auto bundleString = std::make_unique<::Microsoft::ReactNative::StorageFileBigString>(bundlePath);
+      if (synchronously) {
+        bundleString->ensure();
+        markStartup(StartupMarker::ReadBundleStop, bundlePath);
+      }
+
+      markEvaluation(StartupMarker::EvaluateBundleStart, bundlePath);
       m_innerInstance->loadScriptFromString(std::move(bundleString), jsBundleRelativePath, synchronously);
+      markEvaluation(StartupMarker::EvaluateBundleStop, bundlePath);
 #endif
     }
 #if defined(_CHAKRACORE_H_)
@@ -520,6 +588,22 @@ std::vector<std::unique_ptr<NativeModule>> InstanceImpl::GetDefaultNativeModules
       },
       nativeQueue));
 
+  // Opt-in, because once JavaScript finds NativeBlobModule, WebSocket and fetch deliver binary data as blobs instead of
+  // base64 strings. FileReaderModule reads the blobs of BlobModule, so the two are registered together.
+  if (Microsoft::React::GetRuntimeOptionBool("Blob.EnableModule")) {
+    modules.push_back(std::make_unique<CxxNativeModule>(
+        m_innerInstance,
+        Microsoft::React::BlobModule::Name,
+        []() -> std::unique_ptr<xplat::module::CxxModule> { return Microsoft::React::CreateBlobModule(); },
+        nativeQueue));
+
+    modules.push_back(std::make_unique<CxxNativeModule>(
+        m_innerInstance,
+        Microsoft::React::FileReaderModule::Name,
+        []() -> std::unique_ptr<xplat::module::CxxModule> { return Microsoft::React::CreateFileReaderModule(); },
+        nativeQueue));
+  }
+
 // TODO: This is not included for UWP because we have a different module which
 // is added later. However, this one is designed
 //  so that we can base a UWP version on it. We need to do that but is not high
@@ -0,0 +1,193 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "RAMBundle.h"
+
+#include "MemoryMappedBuffer.h"
+#include "Unicode.h"
+
+// Standard Library
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+using facebook::react::JSBigStdString;
+using facebook::react::JSBigString;
+using facebook::react::JSModulesUnbundle;
+using std::string;
+using std::uint32_t;
+using std::uint64_t;
+using std::unique_ptr;
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// Shared by indexed RAM bundles and the UNBUNDLE marker of file RAM bundles.
+// Bundles are little-endian, like every platform this code runs on.
+constexpr uint32_t RAMBundleMagicNumber = 0xFB0BD1E5;
+
+bool StartsWithMagicNumber(const fs::path &path) noexcept {
+  std::ifstream file(path, std::ios::binary);
+  uint32_t magic = 0;
+  if (!file.read(reinterpret_cast<char *>(&magic), sizeof(magic)))
+    return false;
+
+  return magic == RAMBundleMagicNumber;
+}
+
+// JSBigString over a range of a buffer, such as a file mapping. The range must be followed by a null character.
+class BufferBigString final : public JSBigString {
+ public:
+  BufferBigString(std::shared_ptr<const facebook::jsi::Buffer> buffer, size_t offset, size_t size) noexcept
+      : m_buffer{std::move(buffer)}, m_offset{offset}, m_size{size} {}
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char *c_str() const override {
+    return reinterpret_cast<const char *>(m_buffer->data() + m_offset);
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  std::shared_ptr<const facebook::jsi::Buffer> m_buffer;
+  size_t m_offset;
+  size_t m_size;
+};
+
+string ModuleName(uint32_t moduleId) {
+  return std::to_string(moduleId) + ".js";
+}
+
+} // namespace
+
+#pragma region IndexedRAMBundle
+
+/*static*/ bool IndexedRAMBundle::IsIndexedRAMBundle(const string &bundlePath) noexcept {
+  return StartsWithMagicNumber(fs::u8path(bundlePath));
+}
+
+IndexedRAMBundle::IndexedRAMBundle(const string &bundlePath)
+    : m_buffer{Microsoft::JSI::MakeMemoryMappedBuffer(Microsoft::Common::Unicode::Utf8ToUtf16(bundlePath).c_str())} {
+  // Header: magic number, module count and startup code length, followed by the module table.
+  uint32_t header[3];
+  if (m_buffer->size() < sizeof(header))
+    throw std::runtime_error("Invalid indexed RAM bundle: " + bundlePath);
+
+  std::memcpy(header, m_buffer->data(), sizeof(header));
+  m_moduleCount = header[1];
+  m_startupCodeLength = header[2];
+
+  // Computed in 64 bits, so that no module count wraps around the size of 32-bit builds.
+  auto baseOffset = sizeof(header) + static_cast<uint64_t>(m_moduleCount) * sizeof(ModuleEntry);
+
+  // Lengths include a trailing null character.
+  if (header[0] != RAMBundleMagicNumber || m_startupCodeLength == 0 ||
+      baseOffset + m_startupCodeLength > m_buffer->size())
+    throw std::runtime_error("Invalid indexed RAM bundle: " + bundlePath);
+
+  m_baseOffset = static_cast<size_t>(baseOffset);
+  if (m_buffer->data()[m_baseOffset + m_startupCodeLength - 1] != '\0')
+    throw std::runtime_error("Invalid indexed RAM bundle: " + bundlePath);
+
+  // File mappings are page aligned, so the table is suitably aligned for direct access.
+  m_table = reinterpret_cast<const ModuleEntry *>(m_buffer->data() + sizeof(header));
+}
+
+unique_ptr<const JSBigString> IndexedRAMBundle::GetStartupCode() const {
+  return std::make_unique<BufferBigString>(m_buffer, m_baseOffset, m_startupCodeLength - 1);
+}
+
+JSModulesUnbundle::Module IndexedRAMBundle::getModule(uint32_t moduleId) const {
+  // Modules without code have a zero length.
+  if (moduleId >= m_moduleCount || m_table[moduleId].Length == 0)
+    throw ModuleNotFound(moduleId);
+
+  const auto &entry = m_table[moduleId];
+  if (static_cast<uint64_t>(m_baseOffset) + entry.Offset + entry.Length > m_buffer->size())
+    throw ModuleNotFound(moduleId);
+
+  auto code = reinterpret_cast<const char *>(m_buffer->data() + m_baseOffset + entry.Offset);
+  return {ModuleName(moduleId), string(code, entry.Length - 1)};
+}
+
+#pragma endregion IndexedRAMBundle
+
+#pragma region FileRAMBundle
+
+/*static*/ bool FileRAMBundle::IsFileRAMBundle(const string &bundlePath) noexcept {
+  return StartsWithMagicNumber(fs::u8path(bundlePath).parent_path() / "js-modules" / "UNBUNDLE");
+}
+
+FileRAMBundle::FileRAMBundle(const string &bundlePath)
+    : m_bundlePath{bundlePath}, m_modulesPath{(fs::u8path(bundlePath).parent_path() / "js-modules").u8string()} {}
+
+unique_ptr<const JSBigString> FileRAMBundle::GetStartupCode() const {
+  // Unlike indexed bundles, the startup file has no trailing null character, so it is copied rather than mapped.
+  std::ifstream file(fs::u8path(m_bundlePath), std::ios::binary | std::ios::ate);
+  if (!file)
+    throw std::runtime_error("Could not open RAM bundle: " + m_bundlePath);
+
+  string code(static_cast<size_t>(file.tellg()), '\0');
+  file.seekg(0, std::ios::beg);
+  if (!file.read(code.data(), code.size()))
+    throw std::runtime_error("Could not read RAM bundle: " + m_bundlePath);
+
+  return std::make_unique<JSBigStdString>(std::move(code));
+}
+
+JSModulesUnbundle::Module FileRAMBundle::getModule(uint32_t moduleId) const {
+  auto name = ModuleName(moduleId);
+  std::ifstream file(fs::u8path(m_modulesPath) / name, std::ios::binary | std::ios::ate);
+  if (!file)
+    throw ModuleNotFound(moduleId);
+
+  string code(static_cast<size_t>(file.tellg()), '\0');
+  file.seekg(0, std::ios::beg);
+  if (!file.read(code.data(), code.size()))
+    throw ModuleNotFound(moduleId);
+
+  return {std::move(name), std::move(code)};
+}
+
+#pragma endregion FileRAMBundle
+
+bool IsRAMBundle(const string &bundlePath) noexcept {
+  return IndexedRAMBundle::IsIndexedRAMBundle(bundlePath) || FileRAMBundle::IsFileRAMBundle(bundlePath);
+}
+
+unique_ptr<facebook::react::RAMBundleRegistry> MakeRAMBundleRegistry(
+    const string &bundlePath,
+    unique_ptr<const JSBigString> &startupCode) {
+  unique_ptr<JSModulesUnbundle> mainBundle;
+  if (IndexedRAMBundle::IsIndexedRAMBundle(bundlePath)) {
+    auto bundle = std::make_unique<IndexedRAMBundle>(bundlePath);
+    startupCode = bundle->GetStartupCode();
+    mainBundle = std::move(bundle);
+  } else {
+    auto bundle = std::make_unique<FileRAMBundle>(bundlePath);
+    startupCode = bundle->GetStartupCode();
+    mainBundle = std::move(bundle);
+  }
+
+  // Segments only contribute modules; their startup code is never evaluated.
+  return facebook::react::RAMBundleRegistry::multipleBundlesRegistry(
+      std::move(mainBundle), [](string segmentPath) -> unique_ptr<JSModulesUnbundle> {
+        if (IndexedRAMBundle::IsIndexedRAMBundle(segmentPath))
+          return std::make_unique<IndexedRAMBundle>(segmentPath);
+
+        return std::make_unique<FileRAMBundle>(segmentPath);
+      });
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSModulesUnbundle.h>
+#include <cxxreact/RAMBundleRegistry.h>
+#include <jsi/jsi.h>
+
+// Standard Library
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Microsoft::ReactNative {
+
+/// <summary>
+/// Indexed RAM bundle, as produced by <c>react-native ram-bundle --indexed-ram-bundle</c>.
+/// </summary>
+/// <remarks>
+/// The bundle file is memory-mapped. Its module table and startup code are used in place,
+/// and a module's code is only copied out of the file when JavaScript first requires it.
+/// </remarks>
+class IndexedRAMBundle final : public facebook::react::JSModulesUnbundle {
+ public:
+  static bool IsIndexedRAMBundle(const std::string &bundlePath) noexcept;
+
+  explicit IndexedRAMBundle(const std::string &bundlePath);
+
+  /// <summary>
+  /// Returns the code to evaluate when the bundle is loaded. It shares the file mapping.
+  /// </summary>
+  std::unique_ptr<const facebook::react::JSBigString> GetStartupCode() const;
+
+  Module getModule(std::uint32_t moduleId) const override;
+
+ private:
+  struct ModuleEntry {
+    std::uint32_t Offset;
+    std::uint32_t Length;
+  };
+
+  std::shared_ptr<const facebook::jsi::Buffer> m_buffer;
+  const ModuleEntry *m_table{nullptr};
+  std::uint32_t m_moduleCount{0};
+  std::uint32_t m_startupCodeLength{0};
+  std::size_t m_baseOffset{0};
+};
+
+/// <summary>
+/// File RAM bundle: the startup code is the bundle file itself, and every module is stored
+/// in its own file under the <c>js-modules</c> directory next to it.
+/// </summary>
+class FileRAMBundle final : public facebook::react::JSModulesUnbundle {
+ public:
+  static bool IsFileRAMBundle(const std::string &bundlePath) noexcept;
+
+  explicit FileRAMBundle(const std::string &bundlePath);
+
+  std::unique_ptr<const facebook::react::JSBigString> GetStartupCode() const;
+
+  Module getModule(std::uint32_t moduleId) const override;
+
+ private:
+  std::string m_bundlePath;
+  std::string m_modulesPath;
+};
+
+/// <summary>
+/// Whether the file is an indexed or file RAM bundle, rather than a plain bundle.
+/// </summary>
+bool IsRAMBundle(const std::string &bundlePath) noexcept;
+
+/// <summary>
+/// Opens a RAM bundle and creates a registry that also accepts further segments
+/// through <c>Instance::registerBundle</c>.
+/// </summary>
+/// <param name="startupCode">
+/// Receives the startup code of the bundle.
+/// </param>
+std::unique_ptr<facebook::react::RAMBundleRegistry> MakeRAMBundleRegistry(
+    const std::string &bundlePath,
+    std::unique_ptr<const facebook::react::JSBigString> &startupCode);
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "StartupTimeline.h"
+
+// Standard Library
+#include <utility>
+
+namespace Microsoft::React {
+
+/*static*/ const char *StartupTimeline::GetMarkerName(StartupMarker marker) noexcept {
+  switch (marker) {
+    case StartupMarker::CreateQueuesStart:
+      return "CreateQueuesStart";
+    case StartupMarker::CreateQueuesStop:
+      return "CreateQueuesStop";
+    case StartupMarker::RegisterModulesStart:
+      return "RegisterModulesStart";
+    case StartupMarker::RegisterModulesStop:
+      return "RegisterModulesStop";
+    case StartupMarker::InitializeRuntimeStart:
+      return "InitializeRuntimeStart";
+    case StartupMarker::InitializeRuntimeStop:
+      return "InitializeRuntimeStop";
+    case StartupMarker::ReadBundleStart:
+      return "ReadBundleStart";
+    case StartupMarker::ReadBundleStop:
+      return "ReadBundleStop";
+    case StartupMarker::ByteCodeCacheHit:
+      return "ByteCodeCacheHit";
+    case StartupMarker::ByteCodeCacheMiss:
+      return "ByteCodeCacheMiss";
+    case StartupMarker::EvaluateBundleStart:
+      return "EvaluateBundleStart";
+    case StartupMarker::EvaluateBundleStop:
+      return "EvaluateBundleStop";
+    case StartupMarker::FirstCreateView:
+      return "FirstCreateView";
+    case StartupMarker::FirstLayout:
+      return "FirstLayout";
+  }
+
+  return "Unknown";
+}
+
+StartupTimeline::StartupTimeline() noexcept : m_origin{std::chrono::steady_clock::now()} {}
+
+void StartupTimeline::Mark(StartupMarker marker, std::string tag) noexcept {
+  auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_origin).count();
+
+  StartupMarkerEntry entry{marker, std::move(tag), elapsed};
+  Listener listener;
+  {
+    std::scoped_lock lock{m_mutex};
+    if (marker == StartupMarker::FirstCreateView) {
+      if (std::exchange(m_createdView, true))
+        return;
+    } else if (marker == StartupMarker::FirstLayout) {
+      if (std::exchange(m_laidOut, true))
+        return;
+    }
+
+    m_entries.push_back(entry);
+    listener = m_listener;
+  }
+
+  if (listener)
+    listener(entry);
+}
+
+std::vector<StartupMarkerEntry> StartupTimeline::GetEntries() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_entries;
+}
+
+void StartupTimeline::SetListener(Listener listener) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_listener = std::move(listener);
+}
+
+} // namespace Microsoft::React
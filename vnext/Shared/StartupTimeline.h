@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Standard Library
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Microsoft::React {
+
+/// <summary>
+/// Phases of a React instance startup, in the order they are normally reached.
+/// </summary>
+enum class StartupMarker {
+  CreateQueuesStart,
+  CreateQueuesStop,
+  RegisterModulesStart,
+  RegisterModulesStop,
+  InitializeRuntimeStart,
+  InitializeRuntimeStop,
+  ReadBundleStart,
+  ReadBundleStop,
+  ByteCodeCacheHit,
+  ByteCodeCacheMiss,
+  EvaluateBundleStart,
+  EvaluateBundleStop,
+  FirstCreateView,
+  FirstLayout,
+};
+
+struct StartupMarkerEntry {
+  StartupMarker Marker;
+
+  // Additional information, such as the bundle a marker refers to. May be empty.
+  std::string Tag;
+
+  // Time since the timeline was created.
+  double ElapsedMilliseconds;
+};
+
+/// <summary>
+/// Records when the phases of an instance startup are reached, relative to the creation of the timeline.
+/// </summary>
+/// <remarks>
+/// Markers are recorded from the native, JavaScript and UI queues, so the timeline is thread safe.
+/// The listener is called on the thread that records the marker, outside of the timeline lock.
+/// </remarks>
+class StartupTimeline final {
+ public:
+  using Listener = std::function<void(const StartupMarkerEntry &entry)>;
+
+  static const char *GetMarkerName(StartupMarker marker) noexcept;
+
+  StartupTimeline() noexcept;
+
+  /// <summary>
+  /// Records a marker. <c>FirstCreateView</c> and <c>FirstLayout</c> are only recorded once.
+  /// </summary>
+  void Mark(StartupMarker marker, std::string tag = {}) noexcept;
+
+  std::vector<StartupMarkerEntry> GetEntries() const noexcept;
+
+  void SetListener(Listener listener) noexcept;
+
+ private:
+  const std::chrono::steady_clock::time_point m_origin;
+
+  mutable std::mutex m_mutex;
+  std::vector<StartupMarkerEntry> m_entries;
+  Listener m_listener;
+  bool m_createdView{false};
+  bool m_laidOut{false};
+};
+
+} // namespace Microsoft::React
@@ -9,9 +9,65 @@
 
 namespace Microsoft::ReactNative {
 
+BatchingQueueCallInvoker::BatchRunner::BatchRunner(
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::chrono::milliseconds frameBudget) noexcept
+    : m_queueThread(queueThread), m_frameBudget(frameBudget) {}
+
+void BatchingQueueCallInvoker::BatchRunner::Post(std::shared_ptr<WorkItemQueue> &&batch) noexcept {
+  {
+    std::scoped_lock lck(m_mutex);
+    m_batches.push_back(std::move(batch));
+    if (m_isRunScheduled) {
+      return;
+    }
+    m_isRunScheduled = true;
+  }
+
+  m_queueThread->runOnQueue([strongThis = shared_from_this()]() noexcept { strongThis->Run(); });
+}
+
+void BatchingQueueCallInvoker::BatchRunner::Run() noexcept {
+  auto start = std::chrono::steady_clock::now();
+  for (;;) {
+    std::shared_ptr<WorkItemQueue> batch;
+    {
+      std::scoped_lock lck(m_mutex);
+      if (m_batches.empty()) {
+        m_isRunScheduled = false;
+        return;
+      }
+      batch = std::move(m_batches.front());
+      m_batches.pop_front();
+    }
+
+    // A batch always runs to completion, so that a frame never renders a partially applied batch.
+    for (auto &task : *batch) {
+      task();
+      task = nullptr;
+    }
+
+    // Batches must run in the order they were posted, so the remaining batches are continued by a new work item
+    // instead of being re-posted behind work queued in the meantime.
+    if (m_frameBudget.count() > 0 && std::chrono::steady_clock::now() - start >= m_frameBudget) {
+      {
+        std::scoped_lock lck(m_mutex);
+        if (m_batches.empty()) {
+          m_isRunScheduled = false;
+          return;
+        }
+      }
+
+      m_queueThread->runOnQueue([strongThis = shared_from_this()]() noexcept { strongThis->Run(); });
+      return;
+    }
+  }
+}
+
 BatchingQueueCallInvoker::BatchingQueueCallInvoker(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread)
-    : m_queueThread(queueThread) {}
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::chrono::milliseconds frameBudget)
+    : m_queueThread(queueThread), m_batchRunner(std::make_shared<BatchRunner>(queueThread, frameBudget)) {}
 
 void BatchingQueueCallInvoker::invokeAsync(std::function<void()> &&func) noexcept {
   EnsureQueue();
@@ -34,16 +90,26 @@ void BatchingQueueCallInvoker::EnsureQueue() noexcept {
 }
 
 void BatchingQueueCallInvoker::PostBatch() noexcept {
+  m_lastOperationForTag.clear();
   if (m_taskQueue) {
-    m_queueThread->runOnQueue([taskQueue{std::move(m_taskQueue)}]() noexcept {
-      for (auto &task : *taskQueue) {
-        task();
-        task = nullptr;
-      }
-    });
+    m_batchRunner->Post(std::move(m_taskQueue));
   }
 }
 
+bool BatchingQueueCallInvoker::TryCoalesce(facebook::react::ICoalescingOperation &operation) noexcept {
+  auto it = m_lastOperationForTag.find(operation.Tag());
+  return it != m_lastOperationForTag.end() && it->second->TryCoalesce(operation);
+}
+
+void BatchingQueueCallInvoker::EndCoalescing() noexcept {
+  m_lastOperationForTag.clear();
+}
+
+void BatchingQueueCallInvoker::TrackOperation(
+    std::shared_ptr<facebook::react::ICoalescingOperation> const &operation) noexcept {
+  m_lastOperationForTag[operation->Tag()] = operation;
+}
+
 void BatchingQueueCallInvoker::onBatchComplete() noexcept {
   PostBatch();
 }
@@ -59,8 +125,9 @@ void BatchingQueueCallInvoker::invokeSync(std::function<void()> &&func) noexcept
 }
 
 BatchingQueueThread::BatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept {
-  m_batchingQueueCallInvoker = std::make_shared<BatchingQueueCallInvoker>(queueThread);
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::chrono::milliseconds frameBudget) noexcept {
+  m_batchingQueueCallInvoker = std::make_shared<BatchingQueueCallInvoker>(queueThread, frameBudget);
   m_callInvoker = m_batchingQueueCallInvoker;
 }
 
@@ -88,9 +155,34 @@ BatchingQueueThread::~BatchingQueueThread() noexcept {}
 
 void BatchingQueueThread::runOnQueue(std::function<void()> &&func) noexcept {
   std::scoped_lock lck(m_mutex);
+
+  // The function may observe or change any view, so later updates must not be merged into operations queued
+  // before it.
+  m_batchingQueueCallInvoker->EndCoalescing();
   m_callInvoker->invokeAsync(std::move(func));
 }
 
+void BatchingQueueThread::runCoalescingOnQueue(
+    std::shared_ptr<facebook::react::ICoalescingOperation> &&operation) noexcept {
+  std::scoped_lock lck(m_mutex);
+  if (m_batchingQueueCallInvoker->TryCoalesce(*operation)) {
+    return;
+  }
+
+  // Operations other than createView and updateView are barriers for all views, like plain runOnQueue work.
+  const bool isBarrier = operation->Kind() == facebook::react::CoalescingOperationKind::Other;
+  if (isBarrier) {
+    m_batchingQueueCallInvoker->EndCoalescing();
+  }
+
+  // The decorated call invoker forwards synchronously to m_batchingQueueCallInvoker, so the operation is
+  // tracked in the same batch it was queued in.
+  m_callInvoker->invokeAsync([operation]() noexcept { operation->Execute(); });
+  if (!isBarrier) {
+    m_batchingQueueCallInvoker->TrackOperation(operation);
+  }
+}
+
 void BatchingQueueThread::onBatchComplete() noexcept {
   std::scoped_lock lck(m_mutex);
   m_batchingQueueCallInvoker->onBatchComplete();
@@ -5,7 +5,10 @@
 
 #include <ReactCommon/CallInvoker.h>
 #include <Shared/BatchingMessageQueueThread.h>
+#include <chrono>
+#include <deque>
 #include <thread>
+#include <unordered_map>
 
 namespace facebook::react {
 class Instance;
@@ -14,7 +17,11 @@ class Instance;
 namespace Microsoft::ReactNative {
 
 struct BatchingQueueCallInvoker : facebook::react::CallInvoker {
-  BatchingQueueCallInvoker(std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread);
+  // A non-zero frameBudget makes the UI queue yield after running batches for that long, so that input and
+  // rendering can be processed before the following batches run. Batches are never split.
+  BatchingQueueCallInvoker(
+      std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+      std::chrono::milliseconds frameBudget = std::chrono::milliseconds{0});
 
   void invokeAsync(std::function<void()> &&func) noexcept override;
   void EnsureQueue() noexcept;
@@ -23,16 +30,48 @@ struct BatchingQueueCallInvoker : facebook::react::CallInvoker {
   void PostBatch() noexcept;
   void invokeSync(std::function<void()> &&func) noexcept override;
 
+  // Merges the operation into the previous operation queued for the same view in the current batch.
+  // Returns false if the operation must be queued on its own.
+  bool TryCoalesce(facebook::react::ICoalescingOperation &operation) noexcept;
+  // Records an operation that was just queued so that later operations for the same view can be merged into it.
+  void TrackOperation(std::shared_ptr<facebook::react::ICoalescingOperation> const &operation) noexcept;
+  // Stops later operations from being merged into any operation queued so far.
+  void EndCoalescing() noexcept;
+
  private:
+  using WorkItemQueue = std::vector<std::function<void()>>;
+
+  // Runs the posted batches in order on the UI queue, yielding to the queue between batches when the frame budget
+  // is exhausted.
+  struct BatchRunner : std::enable_shared_from_this<BatchRunner> {
+    BatchRunner(
+        std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+        std::chrono::milliseconds frameBudget) noexcept;
+
+    void Post(std::shared_ptr<WorkItemQueue> &&batch) noexcept;
+
+   private:
+    void Run() noexcept;
+
+    const std::shared_ptr<facebook::react::MessageQueueThread> m_queueThread;
+    const std::chrono::milliseconds m_frameBudget;
+    std::mutex m_mutex;
+    std::deque<std::shared_ptr<WorkItemQueue>> m_batches;
+    bool m_isRunScheduled{false};
+  };
+
   std::shared_ptr<facebook::react::MessageQueueThread> m_queueThread;
+  std::shared_ptr<BatchRunner> m_batchRunner;
 
-  using WorkItemQueue = std::vector<std::function<void()>>;
   std::shared_ptr<WorkItemQueue> m_taskQueue;
+  std::unordered_map<int64_t, std::shared_ptr<facebook::react::ICoalescingOperation>> m_lastOperationForTag;
 };
 
 // Executes the function on the provided UI Dispatcher
 struct BatchingQueueThread final : facebook::react::BatchingMessageQueueThread {
-  BatchingQueueThread(std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept;
+  BatchingQueueThread(
+      std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+      std::chrono::milliseconds frameBudget = std::chrono::milliseconds{0}) noexcept;
   ~BatchingQueueThread() noexcept override;
 
   BatchingQueueThread() = delete;
@@ -47,6 +86,7 @@ struct BatchingQueueThread final : facebook::react::BatchingMessageQueueThread {
 
  public: // facebook::react::BatchingMessageQueueThread
   void onBatchComplete() noexcept override;
+  void runCoalescingOnQueue(std::shared_ptr<facebook::react::ICoalescingOperation> &&operation) noexcept override;
 
  private:
   std::mutex m_mutex;
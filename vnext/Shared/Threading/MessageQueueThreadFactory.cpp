@@ -19,8 +19,9 @@ std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread() noexcep
 }
 
 std::shared_ptr<facebook::react::BatchingMessageQueueThread> MakeBatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept {
-  return std::make_shared<BatchingQueueThread>(queueThread);
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::chrono::milliseconds frameBudget) noexcept {
+  return std::make_shared<BatchingQueueThread>(queueThread, frameBudget);
 }
 
 } // namespace Microsoft::ReactNative
@@ -5,6 +5,7 @@
 
 #include <BatchingMessageQueueThread.h>
 #include <cxxreact/MessageQueueThread.h>
+#include <chrono>
 
 namespace Microsoft::ReactNative {
 
@@ -13,6 +14,7 @@ std::shared_ptr<facebook::react::MessageQueueThread> MakeJSQueueThread() noexcep
 std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread() noexcept;
 
 std::shared_ptr<facebook::react::BatchingMessageQueueThread> MakeBatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept;
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::chrono::milliseconds frameBudget = std::chrono::milliseconds{0}) noexcept;
 
 } // namespace Microsoft::ReactNative
@@ -6,6 +6,8 @@
 #include <V8JsiRuntime.h>
 #include "V8JSIRuntimeHolder.h"
 
+#include <StartupTimeline.h>
+
 #include <atomic>
 #include <queue>
 
@@ -45,6 +47,9 @@ std::shared_ptr<facebook::jsi::Runtime> V8JSIRuntimeHolder::getRuntime() noexcep
 }
 
 void V8JSIRuntimeHolder::initRuntime() noexcept {
+  if (startupTimeline_)
+    startupTimeline_->Mark(Microsoft::React::StartupMarker::InitializeRuntimeStart);
+
   v8runtime::V8RuntimeArgs args{};
 
   if (debuggerPort_ > 0)
@@ -60,6 +65,9 @@ void V8JSIRuntimeHolder::initRuntime() noexcept {
   runtime_ = v8runtime::makeV8Runtime(std::move(args));
 
   own_thread_id_ = std::this_thread::get_id();
+
+  if (startupTimeline_)
+    startupTimeline_->Mark(Microsoft::React::StartupMarker::InitializeRuntimeStop);
 }
 
 } // namespace react
@@ -27,6 +27,7 @@ class V8JSIRuntimeHolder : public facebook::jsi::RuntimeHolderLazyInit {
         debuggerPort_(devSettings->debuggerPort),
         debuggerRuntimeName_(devSettings->debuggerRuntimeName),
         jsQueue_(std::move(jsQueue)),
+        startupTimeline_(devSettings->startupTimeline),
         scriptStore_(std::move(scriptStore)),
         preparedScriptStore_(std::move(preparedScriptStore)) {}
 
@@ -35,6 +36,7 @@ class V8JSIRuntimeHolder : public facebook::jsi::RuntimeHolderLazyInit {
 
   std::shared_ptr<facebook::jsi::Runtime> runtime_;
   std::shared_ptr<facebook::react::MessageQueueThread> jsQueue_;
+  std::shared_ptr<Microsoft::React::StartupTimeline> startupTimeline_;
 
   std::unique_ptr<facebook::jsi::ScriptStore> scriptStore_;
   std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore_;
@@ -197,11 +197,11 @@ fire_and_forget WinRTWebSocketResource::PerformPing() noexcept {
   }
 }
 
-fire_and_forget WinRTWebSocketResource::PerformWrite(string &&message, bool isBinary) noexcept {
+fire_and_forget WinRTWebSocketResource::PerformWrite(WriteRequest &&message) noexcept {
   auto self = shared_from_this();
   {
     auto guard = lock_guard<mutex>{m_writeQueueMutex};
-    m_writeQueue.emplace(std::move(message), isBinary);
+    m_writeQueue.push(std::move(message));
   }
 
   co_await resume_background();
@@ -216,32 +216,33 @@ fire_and_forget WinRTWebSocketResource::PerformWrite(string &&message, bool isBi
   }
 
   try {
-    size_t length;
-    string messageLocal;
-    bool isBinaryLocal;
+    WriteRequest messageLocal;
     {
       auto guard = lock_guard<mutex>{m_writeQueueMutex};
-      std::tie(messageLocal, isBinaryLocal) = m_writeQueue.front();
+      messageLocal = std::move(m_writeQueue.front());
       m_writeQueue.pop();
     }
 
-    if (isBinaryLocal) {
-      self->m_socket.Control().MessageType(SocketMessageType::Binary);
+    bool isBinaryLocal = !std::holds_alternative<string>(messageLocal);
+    self->m_socket.Control().MessageType(isBinaryLocal ? SocketMessageType::Binary : SocketMessageType::Utf8);
 
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(messageLocal));
-      length = buffer.Length();
-      self->m_writer.WriteBuffer(buffer);
+    winrt::array_view<const uint8_t> view;
+    if (auto bytes = std::get_if<vector<uint8_t>>(&messageLocal)) {
+      view = winrt::array_view<const uint8_t>(bytes->data(), bytes->data() + bytes->size());
+    } else if (auto shared = std::get_if<SharedBytes>(&messageLocal)) {
+      auto data = shared->Buffer->data() + shared->Offset;
+      view = winrt::array_view<const uint8_t>(data, data + shared->Size);
     } else {
-      self->m_socket.Control().MessageType(SocketMessageType::Utf8);
-
       // TODO: Use char_t instead of uint8_t?
-      length = messageLocal.size();
-      winrt::array_view<const uint8_t> view(
-          CheckedReinterpretCast<const uint8_t *>(messageLocal.c_str()),
-          CheckedReinterpretCast<const uint8_t *>(messageLocal.c_str()) + messageLocal.length());
-      self->m_writer.WriteBytes(view);
+      const auto &text = std::get<string>(messageLocal);
+      view = winrt::array_view<const uint8_t>(
+          CheckedReinterpretCast<const uint8_t *>(text.c_str()),
+          CheckedReinterpretCast<const uint8_t *>(text.c_str()) + text.length());
     }
 
+    size_t length = view.size();
+    self->m_writer.WriteBytes(view);
+
     auto async = self->m_writer.StoreAsync();
 
     co_await lessthrow_await_adapter<DataWriterStoreOperation>{async};
@@ -300,6 +301,14 @@ void WinRTWebSocketResource::OnMessageReceived(
     string response;
     IDataReader reader = args.GetDataReader();
     auto len = reader.UnconsumedBufferLength();
+    if (args.MessageType() == SocketMessageType::Binary && m_binaryReadHandler) {
+      vector<uint8_t> data(len);
+      reader.ReadBytes(data);
+
+      m_binaryReadHandler(std::move(data));
+      return;
+    }
+
     if (args.MessageType() == SocketMessageType::Utf8) {
       reader.UnicodeEncoding(UnicodeEncoding::Utf8);
       vector<uint8_t> data(len);
@@ -356,11 +365,33 @@ void WinRTWebSocketResource::Ping() noexcept {
 }
 
 void WinRTWebSocketResource::Send(string &&message) noexcept {
-  PerformWrite(std::move(message), false);
+  PerformWrite(std::move(message));
 }
 
 void WinRTWebSocketResource::SendBinary(string &&base64String) noexcept {
-  PerformWrite(std::move(base64String), true);
+  vector<uint8_t> message;
+  try {
+    auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(base64String));
+    winrt::com_array<uint8_t> bytes;
+    CryptographicBuffer::CopyToByteArray(buffer, bytes);
+    message.assign(bytes.begin(), bytes.end());
+  } catch (hresult_error const &e) {
+    if (m_errorHandler) {
+      m_errorHandler({HResultToString(e), ErrorType::Send});
+    }
+
+    return;
+  }
+
+  SendBinary(std::move(message));
+}
+
+void WinRTWebSocketResource::SendBinary(vector<uint8_t> &&message) noexcept {
+  PerformWrite(std::move(message));
+}
+
+void WinRTWebSocketResource::SendBinary(SharedBytes &&message) noexcept {
+  PerformWrite(std::move(message));
 }
 
 void WinRTWebSocketResource::Close(CloseCode code, const string &reason) noexcept {
@@ -395,6 +426,10 @@ void WinRTWebSocketResource::SetOnMessage(function<void(size_t, const string &,
   m_readHandler = std::move(handler);
 }
 
+void WinRTWebSocketResource::SetOnBinaryMessage(function<void(vector<uint8_t> &&)> &&handler) noexcept {
+  m_binaryReadHandler = std::move(handler);
+}
+
 void WinRTWebSocketResource::SetOnClose(function<void(CloseCode, const string &)> &&handler) noexcept {
   m_closeHandler = std::move(handler);
 }
@@ -13,6 +13,7 @@
 #include <future>
 #include <mutex>
 #include <queue>
+#include <variant>
 
 namespace Microsoft::React {
 
@@ -33,13 +34,16 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
 
   CloseCode m_closeCode{CloseCode::Normal};
   std::string m_closeReason;
-  std::queue<std::pair<std::string, bool>> m_writeQueue;
+  // Text messages are queued as strings, binary messages as raw bytes.
+  using WriteRequest = std::variant<std::string, std::vector<std::uint8_t>, SharedBytes>;
+  std::queue<WriteRequest> m_writeQueue;
   std::mutex m_writeQueueMutex;
 
   std::function<void()> m_connectHandler;
   std::function<void()> m_pingHandler;
   std::function<void(std::size_t)> m_writeHandler;
   std::function<void(std::size_t, const std::string &, bool)> m_readHandler;
+  std::function<void(std::vector<std::uint8_t> &&)> m_binaryReadHandler;
   std::function<void(CloseCode, const std::string &)> m_closeHandler;
   std::function<void(Error &&)> m_errorHandler;
 
@@ -50,7 +54,7 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
 
   winrt::Windows::Foundation::IAsyncAction PerformConnect() noexcept;
   winrt::fire_and_forget PerformPing() noexcept;
-  winrt::fire_and_forget PerformWrite(std::string &&message, bool isBinary) noexcept;
+  winrt::fire_and_forget PerformWrite(WriteRequest &&message) noexcept;
   winrt::fire_and_forget PerformClose() noexcept;
 
   void OnMessageReceived(
@@ -93,6 +97,16 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   /// </summary>
   void SendBinary(std::string &&base64String) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SendBinary" />
+  /// </summary>
+  void SendBinary(std::vector<std::uint8_t> &&message) noexcept override;
+
+  /// <summary>
+  /// <see cref="IWebSocketResource::SendBinary" />
+  /// </summary>
+  void SendBinary(SharedBytes &&message) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::Close" />
   /// </summary>
@@ -120,6 +134,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   /// </summary>
   void SetOnMessage(std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SetOnBinaryMessage" />
+  /// </summary>
+  void SetOnBinaryMessage(std::function<void(std::vector<std::uint8_t> &&)> &&handler) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnClose" />
   /// </summary>
@@ -0,0 +1,587 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "tracing/TraceRecorder.h"
+#include "tracing/fbsystrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+namespace {
+
+// A ring buffer slot. The owning thread writes the slot while a snapshot may copy it, so the record is stored as
+// atomic words behind a sequence number: odd while the record at index i is written, and 2 * i + 2 once it is complete.
+struct RecordSlot {
+  static constexpr size_t WordCount = sizeof(TraceRecord) / sizeof(uint64_t);
+
+  void Store(uint64_t index, const TraceRecord &record) noexcept {
+    uint64_t words[WordCount];
+    std::memcpy(words, &record, sizeof(record));
+
+    Sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WordCount; ++i) {
+      Words[i].store(words[i], std::memory_order_relaxed);
+    }
+    Sequence.store(2 * index + 2, std::memory_order_release);
+  }
+
+  // Returns false if the slot does not hold the complete record at the index.
+  bool TryLoad(uint64_t index, TraceRecord &record) const noexcept {
+    const uint64_t sequence = 2 * index + 2;
+    if (Sequence.load(std::memory_order_acquire) != sequence)
+      return false;
+
+    uint64_t words[WordCount];
+    for (size_t i = 0; i < WordCount; ++i) {
+      words[i] = Words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (Sequence.load(std::memory_order_relaxed) != sequence)
+      return false;
+
+    std::memcpy(&record, words, sizeof(record));
+    return true;
+  }
+
+  std::atomic<uint64_t> Sequence{0};
+  std::atomic<uint64_t> Words[WordCount];
+};
+
+static_assert(sizeof(TraceRecord) % sizeof(uint64_t) == 0, "Trace records are copied as whole words.");
+
+struct ThreadBuffer {
+  uint32_t ThreadId{0};
+  uint64_t Session{0};
+  std::unique_ptr<RecordSlot[]> Slots;
+  size_t Capacity{0};
+  std::atomic<uint64_t> WriteIndex{0};
+};
+
+struct RecorderState {
+  std::atomic<bool> IsEnabled{false};
+  std::atomic<uint64_t> Session{0};
+
+  // Guards the members below.
+  std::mutex Mutex;
+  size_t RecordsPerThread{TraceRecorder::DefaultRecordsPerThread};
+  uint32_t NextThreadId{1};
+  std::vector<std::shared_ptr<ThreadBuffer>> Buffers;
+};
+
+RecorderState &GetState() noexcept {
+  static RecorderState state;
+  return state;
+}
+
+ThreadBuffer &GetThreadBuffer() noexcept {
+  thread_local std::shared_ptr<ThreadBuffer> tls_buffer;
+
+  auto &state = GetState();
+  uint64_t session = state.Session.load(std::memory_order_acquire);
+  if (!tls_buffer || tls_buffer->Session != session) {
+    std::scoped_lock lock{state.Mutex};
+    if (!tls_buffer) {
+      tls_buffer = std::make_shared<ThreadBuffer>();
+      tls_buffer->ThreadId = state.NextThreadId++;
+      state.Buffers.push_back(tls_buffer);
+    }
+
+    if (tls_buffer->Capacity != state.RecordsPerThread) {
+      tls_buffer->Slots = std::make_unique<RecordSlot[]>(state.RecordsPerThread);
+      tls_buffer->Capacity = state.RecordsPerThread;
+    }
+
+    tls_buffer->WriteIndex.store(0, std::memory_order_relaxed);
+    tls_buffer->Session = session;
+  }
+
+  return *tls_buffer;
+}
+
+int64_t GetTimestamp() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct ThreadSnapshot {
+  uint32_t ThreadId;
+  std::vector<TraceRecord> Records;
+};
+
+struct TraceSnapshot {
+  std::vector<ThreadSnapshot> Threads;
+};
+
+// Returns the length of the longest prefix of the value that fits in maxLength bytes and does not split a UTF-8
+// character.
+size_t GetTruncatedLength(std::string_view value, size_t maxLength) noexcept {
+  if (value.size() <= maxLength)
+    return value.size();
+
+  size_t length = maxLength;
+  while (length > 0 && (static_cast<uint8_t>(value[length]) & 0xC0) == 0x80) {
+    --length;
+  }
+  return length;
+}
+
+TraceSnapshot TakeSnapshot() {
+  auto &state = GetState();
+  std::scoped_lock lock{state.Mutex};
+  uint64_t session = state.Session.load(std::memory_order_relaxed);
+
+  TraceSnapshot snapshot;
+  for (const auto &buffer : state.Buffers) {
+    if (buffer->Session != session)
+      continue;
+
+    uint64_t end = buffer->WriteIndex.load(std::memory_order_acquire);
+    uint64_t begin = end > buffer->Capacity ? end - buffer->Capacity : 0;
+
+    ThreadSnapshot thread{buffer->ThreadId, {}};
+    thread.Records.reserve(static_cast<size_t>(end - begin));
+    for (uint64_t i = begin; i < end; ++i) {
+      // The owning thread keeps writing while we copy, and may be overwriting the oldest record already before it
+      // publishes the next write index. Skip the records that are no longer in their slot.
+      TraceRecord record;
+      if (buffer->Slots[static_cast<size_t>(i & (buffer->Capacity - 1))].TryLoad(i, record)) {
+        thread.Records.push_back(record);
+      }
+    }
+
+    snapshot.Threads.push_back(std::move(thread));
+  }
+
+  return snapshot;
+}
+
+std::string GetCategory(uint32_t tag) {
+  switch (tag) {
+    case TRACE_TAG_REACT_CXX_BRIDGE:
+      return "react_cxx_bridge";
+    case TRACE_TAG_REACT_APPS:
+      return "react_apps";
+    default:
+      return std::to_string(tag);
+  }
+}
+
+//
+// Chrome trace event JSON
+//
+
+void WriteJsonString(std::ostream &stream, std::string_view value) {
+  static constexpr char hexDigits[] = "0123456789abcdef";
+
+  stream << '"';
+  for (char ch : value) {
+    switch (ch) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\r':
+        stream << "\\r";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      default:
+        if (static_cast<uint8_t>(ch) < 0x20) {
+          stream << "\\u00" << hexDigits[(ch >> 4) & 0xF] << hexDigits[ch & 0xF];
+        } else {
+          stream << ch;
+        }
+    }
+  }
+  stream << '"';
+}
+
+void WriteChromeJsonEvent(std::ostream &stream, uint32_t threadId, const TraceRecord &record) {
+  const char *phase = "";
+  switch (record.type) {
+    case TraceRecordType::SectionBegin:
+      phase = "B";
+      break;
+    case TraceRecordType::SectionEnd:
+      phase = "E";
+      break;
+    case TraceRecordType::AsyncSectionBegin:
+      phase = "b";
+      break;
+    case TraceRecordType::AsyncSectionEnd:
+      phase = "e";
+      break;
+    case TraceRecordType::AsyncFlowBegin:
+      phase = "s";
+      break;
+    case TraceRecordType::AsyncFlowEnd:
+      phase = "f";
+      break;
+    case TraceRecordType::Counter:
+      phase = "C";
+      break;
+  }
+
+  // Chrome trace event timestamps are in microseconds.
+  stream << "{\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << threadId << ",\"ts\":" << record.timestamp / 1000
+         << '.' << std::setw(3) << std::setfill('0') << record.timestamp % 1000 << ",\"cat\":";
+  WriteJsonString(stream, GetCategory(record.tag));
+  stream << ",\"name\":";
+  WriteJsonString(stream, record.Name());
+
+  switch (record.type) {
+    case TraceRecordType::AsyncSectionBegin:
+    case TraceRecordType::AsyncSectionEnd:
+    case TraceRecordType::AsyncFlowBegin:
+      stream << ",\"id\":" << record.value;
+      break;
+    case TraceRecordType::AsyncFlowEnd:
+      // Bind the flow end to the enclosing section.
+      stream << ",\"id\":" << record.value << ",\"bp\":\"e\"";
+      break;
+    case TraceRecordType::Counter:
+      stream << ",\"args\":{\"value\":" << record.value << '}';
+      break;
+    default:
+      if (record.argsLength != 0) {
+        stream << ",\"args\":{\"args\":";
+        WriteJsonString(stream, record.Args());
+        stream << '}';
+      }
+      break;
+  }
+
+  stream << '}';
+}
+
+void WriteChromeJson(std::ostream &stream, const TraceSnapshot &snapshot) {
+  stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool isFirst = true;
+  for (const auto &thread : snapshot.Threads) {
+    stream << (isFirst ? "\n" : ",\n") << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.ThreadId
+           << ",\"name\":\"thread_name\",\"args\":{\"name\":\"Thread " << thread.ThreadId << "\"}}";
+    isFirst = false;
+
+    for (const auto &record : thread.Records) {
+      stream << ",\n";
+      WriteChromeJsonEvent(stream, thread.ThreadId, record);
+    }
+  }
+  stream << "\n]}\n";
+}
+
+//
+// Perfetto protobuf
+// See https://perfetto.dev/docs/reference/trace-packet-proto for the field numbers.
+//
+
+class ProtoWriter {
+ public:
+  void WriteVarint(uint32_t field, uint64_t value) {
+    WriteTag(field, 0);
+    WriteRawVarint(value);
+  }
+
+  void WriteBytes(uint32_t field, std::string_view value) {
+    WriteTag(field, 2);
+    WriteRawVarint(value.size());
+    m_buffer.append(value.data(), value.size());
+  }
+
+  void WriteMessage(uint32_t field, const ProtoWriter &message) {
+    WriteBytes(field, message.m_buffer);
+  }
+
+  const std::string &Buffer() const noexcept {
+    return m_buffer;
+  }
+
+ private:
+  void WriteTag(uint32_t field, uint32_t wireType) {
+    WriteRawVarint((static_cast<uint64_t>(field) << 3) | wireType);
+  }
+
+  void WriteRawVarint(uint64_t value) {
+    while (value >= 0x80) {
+      m_buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    m_buffer.push_back(static_cast<char>(value));
+  }
+
+  std::string m_buffer;
+};
+
+enum PerfettoField : uint32_t {
+  Trace_Packet = 1,
+  TracePacket_Timestamp = 8,
+  TracePacket_TrustedPacketSequenceId = 10,
+  TracePacket_TrackEvent = 11,
+  TracePacket_TrackDescriptor = 60,
+  TrackDescriptor_Uuid = 1,
+  TrackDescriptor_Name = 2,
+  TrackDescriptor_Thread = 4,
+  TrackDescriptor_Counter = 8,
+  ThreadDescriptor_Pid = 1,
+  ThreadDescriptor_Tid = 2,
+  ThreadDescriptor_ThreadName = 5,
+  TrackEvent_DebugAnnotations = 4,
+  TrackEvent_Type = 9,
+  TrackEvent_TrackUuid = 11,
+  TrackEvent_Categories = 22,
+  TrackEvent_Name = 23,
+  TrackEvent_CounterValue = 30,
+  TrackEvent_FlowIds = 47,
+  TrackEvent_TerminatingFlowIds = 48,
+  DebugAnnotation_StringValue = 6,
+  DebugAnnotation_Name = 10,
+};
+
+enum PerfettoTrackEventType : uint64_t {
+  TrackEventType_SliceBegin = 1,
+  TrackEventType_SliceEnd = 2,
+  TrackEventType_Instant = 3,
+  TrackEventType_Counter = 4,
+};
+
+constexpr uint64_t PerfettoSequenceId = 1;
+constexpr uint64_t ThreadTrackUuidBase = 1ull << 60;
+constexpr uint64_t AsyncTrackUuidBase = 2ull << 60;
+constexpr uint64_t CounterTrackUuidBase = 3ull << 60;
+
+uint32_t GetNameId(std::string_view name) noexcept {
+  return static_cast<uint32_t>(std::hash<std::string_view>{}(name));
+}
+
+uint64_t GetNameCookieId(std::string_view name, int64_t cookie) noexcept {
+  return (static_cast<uint64_t>(GetNameId(name)) << 32) | static_cast<uint32_t>(cookie);
+}
+
+void WritePerfettoPacket(std::ostream &stream, ProtoWriter &packet) {
+  packet.WriteVarint(TracePacket_TrustedPacketSequenceId, PerfettoSequenceId);
+  ProtoWriter trace;
+  trace.WriteMessage(Trace_Packet, packet);
+  stream.write(trace.Buffer().data(), trace.Buffer().size());
+}
+
+void WritePerfettoTrackDescriptor(
+    std::ostream &stream,
+    uint64_t uuid,
+    std::string_view name,
+    bool isCounter,
+    uint32_t threadId = 0) {
+  ProtoWriter descriptor;
+  descriptor.WriteVarint(TrackDescriptor_Uuid, uuid);
+  descriptor.WriteBytes(TrackDescriptor_Name, name);
+  if (threadId != 0) {
+    ProtoWriter thread;
+    thread.WriteVarint(ThreadDescriptor_Pid, 1);
+    thread.WriteVarint(ThreadDescriptor_Tid, threadId);
+    thread.WriteBytes(ThreadDescriptor_ThreadName, name);
+    descriptor.WriteMessage(TrackDescriptor_Thread, thread);
+  }
+  if (isCounter) {
+    descriptor.WriteMessage(TrackDescriptor_Counter, ProtoWriter{});
+  }
+
+  ProtoWriter packet;
+  packet.WriteMessage(TracePacket_TrackDescriptor, descriptor);
+  WritePerfettoPacket(stream, packet);
+}
+
+void WritePerfetto(std::ostream &stream, const TraceSnapshot &snapshot) {
+  std::unordered_set<uint64_t> describedTracks;
+
+  for (const auto &thread : snapshot.Threads) {
+    uint64_t threadTrackUuid = ThreadTrackUuidBase | thread.ThreadId;
+    WritePerfettoTrackDescriptor(
+        stream, threadTrackUuid, "Thread " + std::to_string(thread.ThreadId), false /*isCounter*/, thread.ThreadId);
+
+    for (const auto &record : thread.Records) {
+      const std::string_view name = record.Name();
+      ProtoWriter event;
+      uint64_t trackUuid = threadTrackUuid;
+
+      switch (record.type) {
+        case TraceRecordType::SectionBegin:
+          event.WriteVarint(TrackEvent_Type, TrackEventType_SliceBegin);
+          if (record.argsLength != 0) {
+            ProtoWriter annotation;
+            annotation.WriteBytes(DebugAnnotation_Name, "args");
+            annotation.WriteBytes(DebugAnnotation_StringValue, record.Args());
+            event.WriteMessage(TrackEvent_DebugAnnotations, annotation);
+          }
+          break;
+        case TraceRecordType::SectionEnd:
+          event.WriteVarint(TrackEvent_Type, TrackEventType_SliceEnd);
+          break;
+        case TraceRecordType::AsyncSectionBegin:
+        case TraceRecordType::AsyncSectionEnd:
+          // Async sections get their own track, so they may overlap with other sections.
+          trackUuid = AsyncTrackUuidBase | GetNameCookieId(name, record.value);
+          if (describedTracks.insert(trackUuid).second) {
+            WritePerfettoTrackDescriptor(stream, trackUuid, name, false /*isCounter*/);
+          }
+          event.WriteVarint(
+              TrackEvent_Type,
+              record.type == TraceRecordType::AsyncSectionBegin ? TrackEventType_SliceBegin : TrackEventType_SliceEnd);
+          break;
+        case TraceRecordType::AsyncFlowBegin:
+          event.WriteVarint(TrackEvent_Type, TrackEventType_Instant);
+          event.WriteVarint(TrackEvent_FlowIds, GetNameCookieId(name, record.value));
+          break;
+        case TraceRecordType::AsyncFlowEnd:
+          event.WriteVarint(TrackEvent_Type, TrackEventType_Instant);
+          event.WriteVarint(TrackEvent_TerminatingFlowIds, GetNameCookieId(name, record.value));
+          break;
+        case TraceRecordType::Counter:
+          trackUuid = CounterTrackUuidBase | GetNameId(name);
+          if (describedTracks.insert(trackUuid).second) {
+            WritePerfettoTrackDescriptor(stream, trackUuid, name, true /*isCounter*/);
+          }
+          event.WriteVarint(TrackEvent_Type, TrackEventType_Counter);
+          event.WriteVarint(TrackEvent_CounterValue, static_cast<uint64_t>(record.value));
+          break;
+      }
+
+      event.WriteVarint(TrackEvent_TrackUuid, trackUuid);
+      if (record.type != TraceRecordType::Counter) {
+        event.WriteBytes(TrackEvent_Categories, GetCategory(record.tag));
+        if (record.type != TraceRecordType::SectionEnd && record.type != TraceRecordType::AsyncSectionEnd) {
+          event.WriteBytes(TrackEvent_Name, name);
+        }
+      }
+
+      ProtoWriter packet;
+      packet.WriteVarint(TracePacket_Timestamp, static_cast<uint64_t>(record.timestamp));
+      packet.WriteMessage(TracePacket_TrackEvent, event);
+      WritePerfettoPacket(stream, packet);
+    }
+  }
+}
+
+bool WriteSnapshot(std::ostream &stream, const TraceSnapshot &snapshot, TraceFormat format) {
+  switch (format) {
+    case TraceFormat::ChromeJson:
+      WriteChromeJson(stream, snapshot);
+      break;
+    case TraceFormat::Perfetto:
+      WritePerfetto(stream, snapshot);
+      break;
+  }
+
+  stream.flush();
+  return static_cast<bool>(stream);
+}
+
+} // namespace
+
+/*static*/ void TraceRecorder::Start(size_t recordsPerThread) noexcept {
+  size_t capacity = 1;
+  while (capacity < recordsPerThread) {
+    capacity <<= 1;
+  }
+
+  auto &state = GetState();
+  std::scoped_lock lock{state.Mutex};
+
+  // Forget the buffers of threads that have exited.
+  state.Buffers.erase(
+      std::remove_if(
+          state.Buffers.begin(),
+          state.Buffers.end(),
+          [](const std::shared_ptr<ThreadBuffer> &buffer) { return buffer.use_count() == 1; }),
+      state.Buffers.end());
+
+  state.RecordsPerThread = capacity;
+  state.Session.fetch_add(1, std::memory_order_release);
+  state.IsEnabled.store(true, std::memory_order_release);
+}
+
+/*static*/ void TraceRecorder::Stop() noexcept {
+  GetState().IsEnabled.store(false, std::memory_order_release);
+}
+
+/*static*/ bool TraceRecorder::IsEnabled() noexcept {
+  return GetState().IsEnabled.load(std::memory_order_relaxed);
+}
+
+/*static*/ void TraceRecorder::Record(
+    TraceRecordType type,
+    uint64_t tag,
+    std::string_view name,
+    std::string_view args,
+    int64_t value) noexcept {
+  if (!IsEnabled())
+    return;
+
+  TraceRecord record;
+  record.timestamp = GetTimestamp();
+  record.value = value;
+  record.tag = static_cast<uint32_t>(tag);
+  record.type = type;
+  record.nameLength = static_cast<uint8_t>(GetTruncatedLength(name, TraceRecord::MaxTextLength));
+  record.argsLength = static_cast<uint8_t>(GetTruncatedLength(args, TraceRecord::MaxTextLength - record.nameLength));
+  std::memcpy(record.text, name.data(), record.nameLength);
+  std::memcpy(record.text + record.nameLength, args.data(), record.argsLength);
+  std::memset(
+      record.text + record.nameLength + record.argsLength,
+      0,
+      TraceRecord::MaxTextLength - record.nameLength - record.argsLength);
+
+  ThreadBuffer &buffer = GetThreadBuffer();
+  uint64_t index = buffer.WriteIndex.load(std::memory_order_relaxed);
+  buffer.Slots[static_cast<size_t>(index & (buffer.Capacity - 1))].Store(index, record);
+  buffer.WriteIndex.store(index + 1, std::memory_order_release);
+}
+
+/*static*/ bool TraceRecorder::Write(std::ostream &stream, TraceFormat format) noexcept {
+  try {
+    return WriteSnapshot(stream, TakeSnapshot(), format);
+  } catch (const std::exception &) {
+    return false;
+  }
+}
+
+/*static*/ std::future<bool> TraceRecorder::DumpAsync(std::string filePath, TraceFormat format) noexcept {
+  try {
+    return std::async(
+        std::launch::async, [snapshot = TakeSnapshot(), filePath = std::move(filePath), format]() noexcept {
+          try {
+            std::ofstream file{filePath, std::ios::binary | std::ios::trunc};
+            return file && WriteSnapshot(file, snapshot, format);
+          } catch (const std::exception &) {
+            return false;
+          }
+        });
+  } catch (const std::exception &) {
+    std::promise<bool> failed;
+    failed.set_value(false);
+    return failed.get_future();
+  }
+}
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <stdint.h>
+#include <future>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+enum class TraceRecordType : uint8_t {
+  SectionBegin,
+  SectionEnd,
+  AsyncSectionBegin,
+  AsyncSectionEnd,
+  AsyncFlowBegin,
+  AsyncFlowEnd,
+  Counter,
+};
+
+enum class TraceFormat {
+  // Chrome trace event JSON, readable by chrome://tracing and ui.perfetto.dev.
+  ChromeJson,
+  // Perfetto protobuf trace, readable by ui.perfetto.dev and trace_processor.
+  Perfetto,
+};
+
+// Fixed size record written to the per-thread ring buffers.
+// The name and the arguments are stored inline, and are truncated to MaxTextLength bytes together.
+struct TraceRecord {
+  static constexpr size_t MaxTextLength = 96;
+
+  // Nanoseconds of std::chrono::steady_clock.
+  int64_t timestamp;
+  // The cookie of async sections and flows, or the counter value.
+  int64_t value;
+  uint32_t tag;
+  TraceRecordType type;
+  uint8_t nameLength;
+  uint8_t argsLength;
+  // The name followed by the arguments, not null terminated.
+  char text[MaxTextLength];
+
+  std::string_view Name() const noexcept {
+    return {text, nameLength};
+  }
+
+  std::string_view Args() const noexcept {
+    return {text + nameLength, argsLength};
+  }
+};
+
+static_assert(sizeof(TraceRecord) == 120, "Keep trace records and their sequence number within 128 bytes.");
+
+// Portable in-process trace recorder.
+//
+// While the recorder is started, the fbsystrace entry points and the JS trace hooks
+// write fixed size records into lock-free per-thread ring buffers in addition to ETW.
+// The newest records of each thread can then be written as a Chrome trace event JSON
+// or a Perfetto protobuf trace. Only the writing thread touches its ring buffer
+// besides the dump, which skips the records that are overwritten while it copies them.
+class TraceRecorder {
+ public:
+  static constexpr size_t DefaultRecordsPerThread = 4 * 1024;
+
+  // Starts a new recording and discards the records of the previous recording.
+  // recordsPerThread is rounded up to a power of two.
+  static void Start(size_t recordsPerThread = DefaultRecordsPerThread) noexcept;
+  static void Stop() noexcept;
+
+  static bool IsEnabled() noexcept;
+
+  // Names and arguments longer than TraceRecord::MaxTextLength bytes together are
+  // truncated at a UTF-8 character boundary.
+  static void Record(
+      TraceRecordType type,
+      uint64_t tag,
+      std::string_view name,
+      std::string_view args = {},
+      int64_t value = 0) noexcept;
+
+  // Writes the records of the current recording to the stream.
+  static bool Write(std::ostream &stream, TraceFormat format) noexcept;
+
+  // Takes a snapshot of the ring buffers on the calling thread, and writes it to the
+  // file on a background thread. The future is true if the file has been written.
+  static std::future<bool> DumpAsync(std::string filePath, TraceFormat format) noexcept;
+};
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
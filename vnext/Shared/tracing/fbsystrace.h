@@ -24,6 +24,9 @@ namespace facebook {
 namespace react {
 namespace tracing {
 
+// True if an ETW session listens to the provider or the TraceRecorder is started.
+bool trace_is_enabled() noexcept;
+
 void trace_begin_section(
     uint64_t id,
     uint64_t tag,
@@ -47,6 +50,9 @@ class FbSystraceSection {
   }
 
   void end_section() {
+    if (!enabled_)
+      return;
+
     facebook::react::tracing::trace_end_section(
         id_,
         tag_,
@@ -59,7 +65,12 @@ class FbSystraceSection {
   FbSystraceSection(uint64_t tag, std::string &&profileName, RestArg &&... rest)
       : tag_(tag), profile_name_(std::move(profileName)) {
     id_ = s_id_counter++;
-    init(std::forward<RestArg>(rest)...);
+
+    // Do not format the arguments when nobody is tracing.
+    enabled_ = facebook::react::tracing::trace_is_enabled();
+    if (enabled_) {
+      init(std::forward<RestArg>(rest)...);
+    }
   }
 
   ~FbSystraceSection() {
@@ -90,6 +101,7 @@ class FbSystraceSection {
 
   std::string profile_name_;
   uint8_t index_{0};
+  bool enabled_{false};
 
   std::chrono::high_resolution_clock::time_point start_{std::chrono::high_resolution_clock::now()};
 };
@@ -6,6 +6,7 @@
 #include <TraceLoggingProvider.h>
 #include <jsi/jsi.h>
 #include <winmeta.h>
+#include "tracing/TraceRecorder.h"
 #include "tracing/fbsystrace.h"
 
 #include <array>
@@ -19,6 +20,8 @@ TRACELOGGING_DEFINE_PROVIDER(
     (0x910fb9a1, 0x75dd, 0x4cf4, 0xbe, 0xec, 0xda, 0x21, 0x34, 0x1f, 0x20, 0xc8));
 
 using namespace facebook;
+using facebook::react::tracing::TraceRecorder;
+using facebook::react::tracing::TraceRecordType;
 
 namespace fbsystrace {
 
@@ -34,6 +37,10 @@ std::mutex g_pages_mutex;
     s_tracker_[cookie] = std::chrono::high_resolution_clock::now();
   }
 
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::AsyncFlowBegin, tag, name, {} /*args*/, cookie);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeAsyncFlow",
@@ -59,6 +66,10 @@ std::mutex g_pages_mutex;
     }
   }
 
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::AsyncFlowEnd, tag, name, {} /*args*/, cookie);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeAsyncFlow",
@@ -78,12 +89,33 @@ namespace facebook {
 namespace react {
 namespace tracing {
 
+bool trace_is_enabled() noexcept {
+  return TraceLoggingProviderEnabled(g_hTraceLoggingProvider, 0, 0) || TraceRecorder::IsEnabled();
+}
+
+static std::string JoinSectionArgs(const std::array<std::string, SYSTRACE_SECTION_MAX_ARGS> &args, uint8_t size) {
+  if (size == 0)
+    return {};
+
+  std::string joinedArgs = args[0];
+  for (uint8_t i = 1; i < size; ++i) {
+    joinedArgs += ", ";
+    joinedArgs += args[i];
+  }
+
+  return joinedArgs;
+}
+
 void trace_begin_section(
     uint64_t id,
     uint64_t tag,
     const std::string &profile_name,
     std::array<std::string, SYSTRACE_SECTION_MAX_ARGS> &&args,
     uint8_t size) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::SectionBegin, tag, profile_name, JoinSectionArgs(args, size));
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeSection",
@@ -101,6 +133,10 @@ void trace_begin_section(
 }
 
 void trace_end_section(uint64_t id, uint64_t tag, const std::string &profile_name, double duration) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::SectionEnd, tag, profile_name);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeSection",
@@ -111,6 +147,10 @@ void trace_end_section(uint64_t id, uint64_t tag, const std::string &profile_nam
 }
 
 void syncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, const std::string &args) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::SectionBegin, tag, profile_name, args);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSSection",
@@ -121,11 +161,19 @@ void syncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, const
 }
 
 void syncSectionEndJSHook(uint64_t tag) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::SectionEnd, tag, {} /*name*/);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider, "SystraceJSSection", TraceLoggingString("end", "op"), TraceLoggingUInt64(tag, "tag"));
 }
 
 void asyncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::AsyncSectionBegin, tag, profile_name, {} /*args*/, cookie);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncSection",
@@ -136,6 +184,10 @@ void asyncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, int
 }
 
 void asyncSectionEndJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::AsyncSectionEnd, tag, profile_name, {} /*args*/, cookie);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncSection",
@@ -146,6 +198,10 @@ void asyncSectionEndJSHook(uint64_t tag, const std::string &profile_name, int co
 }
 
 void asyncFlowBeginJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::AsyncFlowBegin, tag, profile_name, {} /*args*/, cookie);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncFlow",
@@ -156,6 +212,10 @@ void asyncFlowBeginJSHook(uint64_t tag, const std::string &profile_name, int coo
 }
 
 void asyncFlowEndJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::AsyncFlowEnd, tag, profile_name, {} /*args*/, cookie);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncFlow",
@@ -166,6 +226,10 @@ void asyncFlowEndJSHook(uint64_t tag, const std::string &profile_name, int cooki
 }
 
 void counterJSHook(uint64_t tag, const std::string &profile_name, int value) {
+  if (TraceRecorder::IsEnabled()) {
+    TraceRecorder::Record(TraceRecordType::Counter, tag, profile_name, {} /*args*/, value);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceCounter",
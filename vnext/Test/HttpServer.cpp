@@ -129,7 +129,7 @@ void HttpSession::Respond()
   }
 }
 
-void HttpSession::OnWrite(bool /*close*/, error_code ec, size_t /*transferred*/)
+void HttpSession::OnWrite(bool close, error_code ec, size_t /*transferred*/)
 {
   if (ec)
   {
@@ -137,18 +137,18 @@ void HttpSession::OnWrite(bool /*close*/, error_code ec, size_t /*transferred*/)
     return;
   }
 
-  m_callbacks.OnResponseSent();
-
-  // TODO: Re-enable when concurrent sessions are implemented.
-  // If response indicates "Connection: close"
-  // if (close)
-  //  return Close();
+  if (m_callbacks.OnResponseSent)
+    m_callbacks.OnResponseSent();
 
   // Clear response
   m_response = nullptr;
 
-  // ISS:2735328: Re-enable for subsequent dispatching.
-  // Read();
+  // If response indicates "Connection: close"
+  if (close)
+    return Close();
+
+  // Keep the connection alive for subsequent requests.
+  Read();
 }
 
 void HttpSession::Close()
@@ -224,14 +224,16 @@ void HttpServer::OnAccept(error_code ec, tcp::socket socket)
   }
   else
   {
+    if (m_callbacks.OnAccept)
+      m_callbacks.OnAccept();
+
     auto session = make_shared<HttpSession>(std::move(socket), m_callbacks);
     m_sessions.push_back(session);
     session->Start();
   }
 
   // Accept next connection.
-  // Accept(); //ISS:2735328: Uncomment after implementing multiple context
-  // threading.
+  Accept();
 }
 
 void HttpServer::Start()
@@ -250,12 +252,21 @@ void HttpServer::Start()
 
 void HttpServer::Stop()
 {
-  m_contextThread.join();
+  // The acceptor keeps the context busy, so it has to be stopped explicitly.
+  m_context.stop();
+
+  if (m_contextThread.joinable())
+    m_contextThread.join();
 
   if (m_acceptor.is_open())
     m_acceptor.close();
 }
 
+void HttpServer::SetOnAccept(function<void()> &&handler) noexcept
+{
+  m_callbacks.OnAccept = std::move(handler);
+}
+
 void HttpServer::SetOnResponseSent(function<void()> &&handler) noexcept
 {
   m_callbacks.OnResponseSent = std::move(handler);
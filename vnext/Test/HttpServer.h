@@ -19,6 +19,7 @@ boost::beast::multi_buffer CreateStringResponseBody(std::string&& content);
 
 struct HttpCallbacks
 {
+  std::function<void()> OnAccept;
   std::function<void()> OnResponseSent;
   std::function<boost::beast::http::response<boost::beast::http::dynamic_body>(
       const boost::beast::http::request<boost::beast::http::string_body> &)>
@@ -80,6 +81,11 @@ class HttpServer : public std::enable_shared_from_this<HttpServer>
   void Start();
   void Stop();
 
+  ///
+  // Callback to invoke after a client connection is accepted.
+  ///
+  void SetOnAccept(std::function<void()> &&handler) noexcept;
+
   ///
   // Callback to invoke after a successful response is sent.
   ///
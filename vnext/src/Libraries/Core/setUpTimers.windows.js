@@ -0,0 +1,23 @@
+/**
+ * Copyright (c) Microsoft Corporation.
+ * Licensed under the MIT License.
+ *
+ * @flow strict-local
+ * @format
+ */
+
+'use strict';
+
+require('./setUpTimers.js'); // Get base impl
+
+// With the JSI.NativeTimers runtime option, the native runtime installs the
+// timers as host functions before the bundle runs, and publishes them as
+// __nativeTimers. The base impl replaces them with lazy JSTimers polyfills, so
+// they are restored before anything can create a timer through JSTimers, whose
+// ids the native timers do not share.
+const nativeTimers = global.__nativeTimers;
+if (nativeTimers != null) {
+  for (const name of Object.keys(nativeTimers)) {
+    global[name] = nativeTimers[name];
+  }
+}